@@ -270,6 +270,7 @@ proc_decl_t ast_proc_decl(ident_t ident, block_t block)
     }
     *p = block;
     ret.block = p;
+    ret.attrs = NULL;
     return ret;
 }
 
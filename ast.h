@@ -237,6 +237,7 @@ typedef struct proc_decl_s {
     struct proc_decl_s *next; // for lists
     const char *name;
     struct block_s *block;
+    id_attrs *attrs; // its attributes (set by scope_check_procDecl)
 } proc_decl_t;
 
 // proc-decls ::= { proc-decl }
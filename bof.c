@@ -1,14 +1,107 @@
 /* $Id: bof.c,v 1.2 2024/10/23 13:38:20 leavens Exp $ */
+// fileno is only declared for -std=c17 with _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
 // #include <sys/types.h>
 #include <sys/stat.h>
 // #include <unistd.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdarg.h>
 #include <string.h>
+#include <stddef.h>
 #include "bof.h"
 #include "utilities.h"
 
+// Files opened by bof_map_open are mapped on hosts that have mmap,
+// and otherwise read into memory
+#if defined(__unix__) || defined(__APPLE__)
+#define BOF_MMAP 1
+#include <sys/mman.h>
+#endif
+
 #define MAGIC "BO32"
+#define MAGIC2 "BOF2"
+
+// the size of the buffer for an error message from bof_try_read_header
+#define BOF_ERROR_SIZE 256
+
+// the number of words the checksum's sums are added over
+// before they are reduced (so that they cannot overflow)
+#define CHECKSUM_BLOCK_WORDS 4096
+
+// The compressed form of a section is a sequence of runs, each starting
+// with a control byte c. If c < LZ_MAX_LITERALS, the c + 1 words
+// that follow are copied. Otherwise the 2 bytes that follow are
+// a distance d (low byte first), and the c - LZ_MAX_LITERALS + LZ_MIN_MATCH
+// words that start d words back in the output are copied
+// (one at a time, as they may overlap the words being written).
+#define LZ_MAX_LITERALS 128
+#define LZ_MIN_MATCH 2
+#define LZ_MAX_MATCH (LZ_MIN_MATCH + 127)
+#define LZ_MAX_DISTANCE 65535
+// (the compressor finds matches through a table of the last place
+// each hash of 2 words was seen, which has 2^LZ_HASH_BITS entries)
+#define LZ_HASH_BITS 12
+
+// how the bytes of a file opened by bof_map_open are held
+typedef enum { map_mapped, map_allocated, map_borrowed } map_owner_t;
+
+// the bytes of a file opened by bof_map_open (or bof_memory_open)
+struct bof_map_s {
+    // the bytes being read (the file's, or after the header of a file
+    // in version 2, those of its text section and then its data section),
+    // their number, and the offset of the next one to be read
+    const unsigned char *bytes;
+    size_t size;
+    size_t offset;
+    // the bytes of the data section (and their number), which are read
+    // after the text section of a file in version 2 (and otherwise NULL)
+    const unsigned char *next_bytes;
+    size_t next_size;
+    // all of the file's bytes, their number, and how they are held
+    const unsigned char *file_bytes;
+    size_t file_size;
+    map_owner_t owner;
+    // the version of the file's format (0 until its header is read)
+    unsigned int version;
+    // the text and data sections, if they were decompressed (else NULL)
+    unsigned char *decompressed[2];
+    // the section table of a file in version 2 (else NULL), the number
+    // of its entries, and the bytes (and their number) from the start
+    // of the file, which the offsets in the table are relative to
+    const unsigned char *table;
+    int num_sections;
+    const unsigned char *base;
+    size_t base_size;
+    // the message about the last error in reading the header
+    char error[BOF_ERROR_SIZE];
+};
+
+// a section (other than the text and data sections) to be written
+typedef struct {
+    bof_section_kind kind;
+    unsigned char *bytes;
+    size_t size;
+} extra_section_t;
+
+// what is written to a file opened by bof_write_open2,
+// which is kept until it is closed
+struct bof_writer_s {
+    bool compress;
+    bool have_header;
+    BOFHeader header;
+    // the bytes written after the header (the text and data sections),
+    // their number, and the size of the space allocated for them
+    unsigned char *bytes;
+    size_t size;
+    size_t capacity;
+    // the other sections (see bof_write_section), and their number
+    extra_section_t *extras;
+    unsigned int num_extras;
+};
+
+// the names of the sections read from a file in version 2
+static const char *section_names[2] = { "text", "data" };
 
 // a type for treating bytes as a word
 typedef union {
@@ -23,6 +116,8 @@ BOFFILE bof_read_open(const char *filename) {
     BOFFILE bf;
     bf.fileptr = fopen(filename, "rb");
     bf.filename = filename;
+    bf.map = NULL;
+    bf.writer = NULL;
 
     if (bf.fileptr == NULL) {
 	bail_with_error("Error opening file for reading: %s", filename);
@@ -31,9 +126,120 @@ BOFFILE bof_read_open(const char *filename) {
     return bf;
 }
 
+// Return a new bof_map_t for reading the size bytes at bytes,
+// which are held as owner says
+static bof_map_t *map_create(const char *name, const unsigned char *bytes,
+			     size_t size, map_owner_t owner)
+{
+    bof_map_t *map = calloc(1, sizeof(bof_map_t));
+    if (map == NULL) {
+	bail_with_error("Cannot allocate space to map %s!", name);
+    }
+    map->bytes = bytes;
+    map->size = size;
+    map->file_bytes = bytes;
+    map->file_size = size;
+    map->owner = owner;
+    return map;
+}
+
+// Open filename for reading as a binary file that is mapped into memory
+// (or read into memory all at once, on hosts without mmap).
+// Exit the program with an error if this fails,
+// otherwise return the BOFFILE for the file.
+BOFFILE bof_map_open(const char *filename)
+{
+    BOFFILE bf = bof_read_open(filename);
+    struct stat st;
+    if (fstat(fileno(bf.fileptr), &st) < 0) {
+	bail_with_error("Cannot stat %s to get its size!", filename);
+    }
+    size_t size = st.st_size;
+    void *bytes = NULL;
+    // (an empty file cannot be mapped, and has nothing to read)
+    if (size > 0) {
+#ifdef BOF_MMAP
+	bytes = mmap(NULL, size, PROT_READ, MAP_PRIVATE,
+		     fileno(bf.fileptr), 0);
+	if (bytes == MAP_FAILED) {
+	    bail_with_error("Cannot map %s into memory!", filename);
+	}
+#else
+	bytes = malloc(size);
+	if (bytes == NULL || fread(bytes, size, 1, bf.fileptr) != 1) {
+	    bail_with_error("Cannot read %s into memory!", filename);
+	}
+#endif
+    }
+    // the mapping does not need the file to stay open
+    if (fclose(bf.fileptr) != 0) {
+	bail_with_error("Could not close %s", filename);
+    }
+    bf.fileptr = NULL;
+#ifdef BOF_MMAP
+    bf.map = map_create(filename, bytes, size, map_mapped);
+#else
+    bf.map = map_create(filename, bytes, size, map_allocated);
+#endif
+    return bf;
+}
+
+// Return a BOFFILE (named name) for reading the size bytes at bytes,
+// in place, as if it were a file opened by bof_map_open.
+BOFFILE bof_memory_open(const char *name, const void *bytes, size_t size)
+{
+    BOFFILE bf;
+    bf.fileptr = NULL;
+    bf.filename = name;
+    bf.map = map_create(name, bytes, size, map_borrowed);
+    bf.writer = NULL;
+    return bf;
+}
+
+// Was bf opened by bof_map_open (or bof_memory_open)?
+bool bof_is_mapped(BOFFILE bf)
+{
+    return bf.map != NULL;
+}
+
+// If all of map's current bytes have been read, and the data section
+// of a file in version 2 is still to be read, start reading it.
+// Return whether there are bytes left to read.
+static bool next_part(bof_map_t *map)
+{
+    if (map->offset == map->size && map->next_bytes != NULL) {
+	map->bytes = map->next_bytes;
+	map->size = map->next_size;
+	map->offset = 0;
+	map->next_bytes = NULL;
+    }
+    return map->offset < map->size;
+}
+
+// Requires: bof_is_mapped(bf)
+// Return a pointer to the next bytes bytes of bf, in place, and skip them;
+// but if fewer than bytes bytes are left, return NULL and skip nothing.
+// (The text and data sections of a file in version 2 are read
+// with separate calls, as they are not next to each other.)
+const void *bof_read_view(BOFFILE bf, size_t bytes)
+{
+    assert(bof_is_mapped(bf));
+    bof_map_t *map = bf.map;
+    next_part(map);
+    if (bytes > map->size - map->offset) {
+	return NULL;
+    }
+    const void *ret = map->bytes + map->offset;
+    map->offset += bytes;
+    return ret;
+}
+
 // Return the size (in bytes) of bf
 size_t bof_file_bytes(BOFFILE bf)
 {
+    if (bof_is_mapped(bf)) {
+	return bf.map->file_size;
+    }
     struct stat st;
     if (stat(bf.filename, &st) < 0) {
 	bail_with_error("Cannot stat %s to get its size!", bf.filename);
@@ -44,6 +250,9 @@ size_t bof_file_bytes(BOFFILE bf)
 
 // Return true just when bf is at its end, false otherwise
 bool bof_at_eof(BOFFILE bf) {
+    if (bof_is_mapped(bf)) {
+	return !next_part(bf.map);
+    }
     return feof(bf.fileptr);
 }
 
@@ -53,9 +262,8 @@ bool bof_at_eof(BOFFILE bf) {
 word_type bof_read_word(BOFFILE bf)
 {
     word_pun_t b;
-    assert(!bof_at_eof(bf));
     size_t bytes_read = bof_read_bytes(bf, BYTES_PER_WORD, b.buf);
-    if (bytes_read == 0) {
+    if (bytes_read != BYTES_PER_WORD) {
 	bail_with_error(
 	  "Cannot read a word from %s (got %d bytes), at EOF: %d",
 	  bf.filename, bytes_read, bof_at_eof(bf));
@@ -63,12 +271,327 @@ word_type bof_read_word(BOFFILE bf)
     return b.w;
 }
 
-// Requires: bf.fileptr is open for reading in binary
+// Requires: bf is open for reading in binary
 // and buf is of size at least bytes
 // Read the given number of bytes into buf and return the number of bytes read
+// (which is less than bytes only at the end of bf)
 size_t bof_read_bytes(BOFFILE bf, size_t bytes, void *buf) {
-    int elems_read = fread(buf, bytes, 1, bf.fileptr);
-    return elems_read;
+    if (bof_is_mapped(bf)) {
+	bof_map_t *map = bf.map;
+	size_t done = 0;
+	while (done < bytes && next_part(map)) {
+	    size_t n = map->size - map->offset;
+	    if (n > bytes - done) {
+		n = bytes - done;
+	    }
+	    memcpy((unsigned char *) buf + done, map->bytes + map->offset, n);
+	    map->offset += n;
+	    done += n;
+	}
+	return done;
+    }
+    return fread(buf, 1, bytes, bf.fileptr);
+}
+
+// Format an error message about reading bf's header (as for printf)
+// into bf's map, or (if it has none) a buffer for the calling thread,
+// and return it
+static const char *header_error(BOFFILE bf, const char *fmt, ...)
+{
+    static _Thread_local char unmapped_error[BOF_ERROR_SIZE];
+    char *error = bof_is_mapped(bf) ? bf.map->error : unmapped_error;
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(error, BOF_ERROR_SIZE, fmt, args);
+    va_end(args);
+    return error;
+}
+
+// Set sums to the Fletcher-64 sums of the size bytes at bytes,
+// taken as words (the last of which is padded with zero bytes)
+static void checksum(const unsigned char *bytes, size_t size,
+		     uword_type sums[2])
+{
+    uint64_t a = 0;
+    uint64_t b = 0;
+    size_t words = size / BYTES_PER_WORD;
+    size_t i = 0;
+    while (i < words) {
+	size_t end = words - i < CHECKSUM_BLOCK_WORDS
+	    ? words : i + CHECKSUM_BLOCK_WORDS;
+	for (; i < end; i++) {
+	    uint32_t w;
+	    memcpy(&w, bytes + i * BYTES_PER_WORD, BYTES_PER_WORD);
+	    a += w;
+	    b += a;
+	}
+	a %= UINT32_MAX;
+	b %= UINT32_MAX;
+    }
+    if (size % BYTES_PER_WORD != 0) {
+	uint32_t w = 0;
+	memcpy(&w, bytes + words * BYTES_PER_WORD, size % BYTES_PER_WORD);
+	a = (a + w) % UINT32_MAX;
+	b = (b + a) % UINT32_MAX;
+    }
+    sums[0] = (uword_type) a;
+    sums[1] = (uword_type) b;
+}
+
+// Return the most bytes that lz_compress writes for n words
+static size_t lz_bound(size_t n)
+{
+    return n * BYTES_PER_WORD + n / LZ_MAX_LITERALS + 1;
+}
+
+// Return the index in the compressor's table of the words w1 and w2
+static unsigned int lz_hash(uword_type w1, uword_type w2)
+{
+    return ((w1 * 2654435761u) ^ (w2 * 2246822519u)) >> (32 - LZ_HASH_BITS);
+}
+
+// Write the literals words before in[i] as a run into out at offset o,
+// and return the offset after them
+static size_t lz_literals(const uword_type *in, size_t i, size_t literals,
+			  unsigned char *out, size_t o)
+{
+    if (literals > 0) {
+	out[o++] = (unsigned char) (literals - 1);
+	memcpy(out + o, in + i - literals, literals * BYTES_PER_WORD);
+	o += literals * BYTES_PER_WORD;
+    }
+    return o;
+}
+
+// Requires: out has room for lz_bound(n) bytes
+// Write the compressed form of the n words at in into out,
+// and return the number of bytes written
+static size_t lz_compress(const uword_type *in, size_t n, unsigned char *out)
+{
+    // the last place each hash was seen, plus 1 (or 0 if it was not seen)
+    size_t *last = calloc((size_t) 1 << LZ_HASH_BITS, sizeof(size_t));
+    if (last == NULL) {
+	bail_with_error("Cannot allocate space to compress a section!");
+    }
+    size_t o = 0;
+    size_t literals = 0;
+    size_t i = 0;
+    while (i < n) {
+	size_t match = 0;
+	size_t distance = 0;
+	if (n - i >= LZ_MIN_MATCH) {
+	    unsigned int h = lz_hash(in[i], in[i + 1]);
+	    if (last[h] != 0 && i - (last[h] - 1) <= LZ_MAX_DISTANCE) {
+		size_t from = last[h] - 1;
+		while (match < LZ_MAX_MATCH && i + match < n
+		       && in[from + match] == in[i + match]) {
+		    match++;
+		}
+		distance = i - from;
+	    }
+	    last[h] = i + 1;
+	}
+	if (match >= LZ_MIN_MATCH) {
+	    o = lz_literals(in, i, literals, out, o);
+	    literals = 0;
+	    out[o++] = (unsigned char) (LZ_MAX_LITERALS + match - LZ_MIN_MATCH);
+	    out[o++] = (unsigned char) (distance & 0xFF);
+	    out[o++] = (unsigned char) (distance >> 8);
+	    i += match;
+	} else {
+	    i++;
+	    literals++;
+	    if (literals == LZ_MAX_LITERALS) {
+		o = lz_literals(in, i, literals, out, o);
+		literals = 0;
+	    }
+	}
+    }
+    o = lz_literals(in, i, literals, out, o);
+    free(last);
+    return o;
+}
+
+// Decompress the size bytes at in into the n words at out,
+// and return whether they were the compressed form of exactly n words
+static bool lz_decompress(const unsigned char *in, size_t size,
+			  uword_type *out, size_t n)
+{
+    size_t i = 0;
+    size_t o = 0;
+    while (i < size) {
+	unsigned int c = in[i++];
+	if (c < LZ_MAX_LITERALS) {
+	    size_t count = c + 1;
+	    if (count > n - o || count * BYTES_PER_WORD > size - i) {
+		return false;
+	    }
+	    memcpy(out + o, in + i, count * BYTES_PER_WORD);
+	    i += count * BYTES_PER_WORD;
+	    o += count;
+	} else {
+	    size_t count = c - LZ_MAX_LITERALS + LZ_MIN_MATCH;
+	    if (size - i < 2) {
+		return false;
+	    }
+	    size_t distance = in[i] | (in[i + 1] << 8);
+	    i += 2;
+	    if (distance == 0 || distance > o || count > n - o) {
+		return false;
+	    }
+	    for (size_t k = 0; k < count; k++) {
+		out[o] = out[o - distance];
+		o++;
+	    }
+	}
+    }
+    return o == n;
+}
+
+// Return an error message if the entry sec (for the section named what)
+// in the section table of bf, whose offsets are relative to bytes
+// that are size long, is not valid, and otherwise NULL
+static const char *check_entry(BOFFILE bf, const BOFSection *sec,
+			       const char *what, size_t size)
+{
+    if (sec->offset % BOF_SECTION_ALIGNMENT != 0 || sec->offset > size
+	|| sec->stored_bytes > size - sec->offset) {
+	return header_error(bf, "The %s section of %s is not within it!",
+			    what, bf.filename);
+    }
+    if ((sec->flags & ~BOF_COMPRESSED) != 0
+	|| (!(sec->flags & BOF_COMPRESSED) && sec->stored_bytes != sec->length)) {
+	return header_error(bf, "The entry for the %s section of %s "
+			    "is not valid!", what, bf.filename);
+    }
+    return NULL;
+}
+
+// Requires: bf is mapped, and the bytes left in it start with MAGIC2
+// Read the header of bf (in version 2) into *bh, checking (and if need be
+// decompressing) its text and data sections, so that they are read next.
+// Return NULL if that worked, and otherwise an error message.
+static const char *read_header2(BOFFILE bf, BOFHeader *bh)
+{
+    bof_map_t *map = bf.map;
+    const unsigned char *base = map->bytes + map->offset;
+    size_t size = map->size - map->offset;
+    BOFHeader2 h2;
+    if (size < sizeof(h2)) {
+	return header_error(bf, "Cannot read header from %s", bf.filename);
+    }
+    memcpy(&h2, base, sizeof(h2));
+    if (h2.version != BOF_VERSION) {
+	return header_error(bf, "%s is in version %d of the format, "
+			    "which is not known!", bf.filename, h2.version);
+    }
+    if (h2.num_sections < 0 || (size_t) h2.num_sections
+	> (size - sizeof(h2)) / sizeof(BOFSection)) {
+	return header_error(bf, "The section table of %s (%d sections) "
+			    "does not fit in it!", bf.filename,
+			    h2.num_sections);
+    }
+    const unsigned char *parts[2] = { NULL, NULL };
+    size_t lengths[2] = { 0, 0 };
+    for (int s = 0; s < h2.num_sections; s++) {
+	BOFSection sec;
+	memcpy(&sec, base + sizeof(h2) + s * sizeof(sec), sizeof(sec));
+	if (sec.kind != bof_text_section && sec.kind != bof_data_section) {
+	    continue;
+	}
+	unsigned int which = sec.kind == bof_text_section ? 0 : 1;
+	const char *what = section_names[which];
+	if (parts[which] != NULL) {
+	    return header_error(bf, "%s has more than one %s section!",
+				bf.filename, what);
+	}
+	const char *error = check_entry(bf, &sec, what, size);
+	if (error != NULL) {
+	    return error;
+	}
+	if (sec.length % BYTES_PER_WORD != 0) {
+	    return header_error(bf, "The entry for the %s section of %s "
+				"is not valid!", what, bf.filename);
+	}
+	const unsigned char *bytes = base + sec.offset;
+	if (sec.flags & BOF_COMPRESSED) {
+	    // (at least 1 byte, so malloc returns a buffer)
+	    map->decompressed[which] = malloc(sec.length + 1);
+	    if (map->decompressed[which] == NULL) {
+		bail_with_error("Cannot allocate space to decompress %s!",
+				bf.filename);
+	    }
+	    if (!lz_decompress(bytes, sec.stored_bytes,
+			       (uword_type *) map->decompressed[which],
+			       sec.length / BYTES_PER_WORD)) {
+		return header_error(bf, "The %s section of %s cannot be "
+				    "decompressed!", what, bf.filename);
+	    }
+	    bytes = map->decompressed[which];
+	}
+	uword_type sums[2];
+	checksum(bytes, sec.length, sums);
+	if (sums[0] != sec.checksum[0] || sums[1] != sec.checksum[1]) {
+	    return header_error(bf, "The %s section of %s has the wrong "
+				"checksum!", what, bf.filename);
+	}
+	parts[which] = bytes;
+	lengths[which] = sec.length;
+    }
+    for (unsigned int which = 0; which < 2; which++) {
+	if (parts[which] == NULL) {
+	    return header_error(bf, "%s does not have a %s section!",
+				bf.filename, section_names[which]);
+	}
+    }
+
+    bof_write_magic_to_header(bh);
+    bh->text_start_address = h2.text_start_address;
+    bh->text_length = lengths[0] / BYTES_PER_WORD;
+    bh->data_start_address = h2.data_start_address;
+    bh->data_length = lengths[1] / BYTES_PER_WORD;
+    bh->stack_bottom_addr = h2.stack_bottom_addr;
+    map->bytes = parts[0];
+    map->size = lengths[0];
+    map->offset = 0;
+    map->next_bytes = parts[1];
+    map->next_size = lengths[1];
+    map->version = BOF_VERSION;
+    map->table = base + sizeof(h2);
+    map->num_sections = h2.num_sections;
+    map->base = base;
+    map->base_size = size;
+    return NULL;
+}
+
+// Requires: bf is open for reading in binary
+// Read the header of bf into *bh, as bof_read_header does, but return
+// an error message (valid until bf is closed) if that cannot be done;
+// return NULL if it worked.
+const char *bof_try_read_header(BOFFILE bf, BOFHeader *bh)
+{
+    if (bof_is_mapped(bf) && bf.map->size - bf.map->offset >= MAGIC_BUFFER_SIZE
+	&& memcmp(bf.map->bytes + bf.map->offset, MAGIC2,
+		  MAGIC_BUFFER_SIZE) == 0) {
+	return read_header2(bf, bh);
+    }
+    size_t rd = bof_read_bytes(bf, sizeof(*bh), bh) / sizeof(*bh);
+    if (rd != 1) {
+	return header_error(bf, "Cannot read header from %s", bf.filename);
+    }
+    if (!bof_has_correct_magic_number(*bh)) {
+	if (memcmp(bh->magic, MAGIC2, MAGIC_BUFFER_SIZE) == 0) {
+	    return header_error(bf, "%s is in version %d of the format, "
+				"so it must be opened with bof_map_open!",
+				bf.filename, BOF_VERSION);
+	}
+	return header_error(bf, "Wrong magic number code in file '%s'!",
+			    bf.filename);
+    }
+    if (bof_is_mapped(bf)) {
+	bf.map->version = 1;
+    }
+    return NULL;
 }
 
 // Requires: bf is open for reading in binary
@@ -76,13 +599,9 @@ size_t bof_read_bytes(BOFFILE bf, size_t bytes, void *buf) {
 // If any errors are encountered, exit with an error message.
 BOFHeader bof_read_header(BOFFILE bf) {
     BOFHeader ret;
-    size_t rd = fread(&ret, sizeof(ret), 1, bf.fileptr);
-    if (rd != 1) {
-	bail_with_error("Cannot read header from %s", bf.filename);
-    }
-    if (!bof_has_correct_magic_number(ret)) {
-	bail_with_error("Wrong magic number code in file '%s'!",
-			bf.filename);
+    const char *error = bof_try_read_header(bf, &ret);
+    if (error != NULL) {
+	bail_with_error("%s", error);
     }
     return ret;
     /*
@@ -100,6 +619,74 @@ BOFHeader bof_read_header(BOFFILE bf) {
     */
 }
 
+// Requires: bof_read_header(bf) has been called
+// Return the version of the format (1 or BOF_VERSION) that bf is in
+unsigned int bof_version(BOFFILE bf)
+{
+    return bof_is_mapped(bf) ? bf.map->version : 1;
+}
+
+// Requires: bof_read_header(bf) has been called
+// Set *bytes to point to the bytes of bf's section of the given kind
+// (not its text or data section), in place, and *size to their number,
+// after checking its checksum; but set *bytes to NULL if bf has no
+// such section. Return an error message (valid until bf is closed)
+// if the section is not valid, and otherwise NULL.
+const char *bof_try_read_section(BOFFILE bf, bof_section_kind kind,
+				 const void **bytes, size_t *size)
+{
+    assert(kind != bof_text_section && kind != bof_data_section);
+    *bytes = NULL;
+    *size = 0;
+    if (!bof_is_mapped(bf) || bf.map->table == NULL) {
+	return NULL;
+    }
+    bof_map_t *map = bf.map;
+    for (int s = 0; s < map->num_sections; s++) {
+	BOFSection sec;
+	memcpy(&sec, map->table + s * sizeof(sec), sizeof(sec));
+	if (sec.kind != kind) {
+	    continue;
+	}
+	const char *what = kind == bof_lines_section ? "line table"
+	    : kind == bof_symbols_section ? "symbols" : "extra";
+	const char *error = check_entry(bf, &sec, what, map->base_size);
+	if (error != NULL) {
+	    return error;
+	}
+	// (only the text and data sections are compressed)
+	if (sec.flags != 0) {
+	    return header_error(bf, "The entry for the %s section of %s "
+				"is not valid!", what, bf.filename);
+	}
+	uword_type sums[2];
+	checksum(map->base + sec.offset, sec.length, sums);
+	if (sums[0] != sec.checksum[0] || sums[1] != sec.checksum[1]) {
+	    return header_error(bf, "The %s section of %s has the wrong "
+				"checksum!", what, bf.filename);
+	}
+	*bytes = map->base + sec.offset;
+	*size = sec.length;
+	return NULL;
+    }
+    return NULL;
+}
+
+// Requires: bof_read_header(bf) has been called
+// Return a pointer to the bytes of bf's section of the given kind,
+// and set *size to their number, as bof_try_read_section does,
+// returning NULL if bf has no such section.
+// If the section is not valid, exit with an error message.
+const void *bof_read_section(BOFFILE bf, bof_section_kind kind, size_t *size)
+{
+    const void *ret;
+    const char *error = bof_try_read_section(bf, kind, &ret, size);
+    if (error != NULL) {
+	bail_with_error("%s", error);
+    }
+    return ret;
+}
+
 // Requires: f is open for writing
 // Write the magic number in hexadecimal notation on f, followed by a newline;
 // Note: this is just for help in writing the documentation
@@ -120,6 +707,8 @@ BOFFILE bof_write_open(const char *filename) {
     BOFFILE bf;
     bf.fileptr = fopen(filename, "wb");
     bf.filename = filename;
+    bf.map = NULL;
+    bf.writer = NULL;
 
     if (bf.fileptr == NULL) {
 	bail_with_error("Error opening file for writing: %s", filename);
@@ -128,11 +717,288 @@ BOFFILE bof_write_open(const char *filename) {
     return bf;
 }
 
+// Open filename for writing as a binary file in version 2 of the format,
+// whose text and data sections are compressed if compress is true.
+// Exit the program with an error if this fails,
+// otherwise return the BOFFILE for it.
+BOFFILE bof_write_open2(const char *filename, bool compress)
+{
+    BOFFILE bf = bof_write_open(filename);
+    bf.writer = calloc(1, sizeof(bof_writer_t));
+    if (bf.writer == NULL) {
+	bail_with_error("Cannot allocate space to write %s!", filename);
+    }
+    bf.writer->compress = compress;
+    return bf;
+}
+
+// Requires: bf is open for writing in binary
+// Write the size bytes at buf into bf's file (not its writer)
+// Exit the program with an error if this fails.
+static void write_raw(BOFFILE bf, size_t size, const void *buf)
+{
+    if (size > 0 && fwrite(buf, size, 1, bf.fileptr) != 1) {
+	bail_with_error("Cannot write %u bytes to %s", size, bf.filename);
+    }
+}
+
+// Return offset rounded up to a multiple of BOF_SECTION_ALIGNMENT
+static size_t section_align(size_t offset)
+{
+    return (offset + BOF_SECTION_ALIGNMENT - 1)
+	/ BOF_SECTION_ALIGNMENT * BOF_SECTION_ALIGNMENT;
+}
+
+// Requires: bf was opened by bof_write_open2
+// Write what was written to bf into its file, in version 2 of the format:
+// the header, the section table, and the (aligned) sections.
+// Exit the program with an error if this fails.
+static void write_file2(BOFFILE bf)
+{
+    bof_writer_t *w = bf.writer;
+    if (!w->have_header) {
+	bail_with_error("No header was written to %s!", bf.filename);
+    }
+    BOFHeader bh = w->header;
+    if (bh.text_length < 0 || bh.data_length < 0
+	|| ((size_t) bh.text_length + bh.data_length) * BYTES_PER_WORD
+	   != w->size) {
+	bail_with_error("The %u bytes written to %s do not match the "
+			"lengths in its header!", w->size, bf.filename);
+    }
+    unsigned int num_sections = 2 + w->num_extras;
+    BOFHeader2 h2;
+    memcpy(h2.magic, MAGIC2, MAGIC_BUFFER_SIZE);
+    h2.version = BOF_VERSION;
+    h2.text_start_address = bh.text_start_address;
+    h2.data_start_address = bh.data_start_address;
+    h2.stack_bottom_addr = bh.stack_bottom_addr;
+    h2.num_sections = num_sections;
+
+    BOFSection *table = calloc(num_sections, sizeof(BOFSection));
+    const unsigned char **stored = calloc(num_sections,
+					  sizeof(unsigned char *));
+    unsigned char *compressed[2] = { NULL, NULL };
+    if (table == NULL || stored == NULL) {
+	bail_with_error("Cannot allocate space to write %s!", bf.filename);
+    }
+    size_t offset = section_align(sizeof(h2)
+				  + num_sections * sizeof(BOFSection));
+    for (unsigned int s = 0; s < num_sections; s++) {
+	if (s < 2) {
+	    table[s].kind = s == 0 ? bof_text_section : bof_data_section;
+	    table[s].length = (s == 0 ? (size_t) bh.text_length
+			       : (size_t) bh.data_length) * BYTES_PER_WORD;
+	    stored[s] = s == 0 ? w->bytes : w->bytes + table[0].length;
+	} else {
+	    table[s].kind = w->extras[s - 2].kind;
+	    table[s].length = w->extras[s - 2].size;
+	    stored[s] = w->extras[s - 2].bytes;
+	}
+	table[s].flags = 0;
+	table[s].stored_bytes = table[s].length;
+	checksum(stored[s], table[s].length, table[s].checksum);
+	// (only the text and data sections are compressed)
+	if (s < 2 && w->compress && table[s].length > 0) {
+	    size_t words = table[s].length / BYTES_PER_WORD;
+	    compressed[s] = malloc(lz_bound(words));
+	    if (compressed[s] == NULL) {
+		bail_with_error("Cannot allocate space to compress %s!",
+				bf.filename);
+	    }
+	    // (the writer's bytes are allocated, so they are aligned)
+	    size_t size = lz_compress((const uword_type *) stored[s], words,
+				      compressed[s]);
+	    if (size < (size_t) table[s].length) {
+		table[s].flags = BOF_COMPRESSED;
+		table[s].stored_bytes = size;
+		stored[s] = compressed[s];
+	    }
+	}
+	table[s].offset = offset;
+	offset = section_align(offset + table[s].stored_bytes);
+    }
+
+    static const unsigned char padding[BOF_SECTION_ALIGNMENT];
+    write_raw(bf, sizeof(h2), &h2);
+    write_raw(bf, num_sections * sizeof(BOFSection), table);
+    size_t written = sizeof(h2) + num_sections * sizeof(BOFSection);
+    for (unsigned int s = 0; s < num_sections; s++) {
+	write_raw(bf, table[s].offset - written, padding);
+	write_raw(bf, table[s].stored_bytes, stored[s]);
+	written = table[s].offset + table[s].stored_bytes;
+    }
+    free(compressed[0]);
+    free(compressed[1]);
+    free(stored);
+    free(table);
+}
+
+// Requires: bf is open for writing in binary
+//           and the size of buf is at least bytes
+// Add a section of the given kind (not the text or data section)
+// holding the given number of bytes from buf to bf, which is written
+// when bf is closed, if bf was opened by bof_write_open2;
+// otherwise do nothing.
+// Exit the program with an error if this fails.
+void bof_write_section(BOFFILE bf, bof_section_kind kind,
+		       size_t bytes, const void *buf)
+{
+    assert(kind != bof_text_section && kind != bof_data_section);
+    bof_writer_t *w = bf.writer;
+    if (w == NULL) {
+	return;
+    }
+    extra_section_t *extras = realloc(w->extras, (w->num_extras + 1)
+				      * sizeof(extra_section_t));
+    // (at least 1 byte, so malloc returns a buffer)
+    unsigned char *copy = malloc(bytes + 1);
+    if (extras == NULL || copy == NULL) {
+	bail_with_error("Cannot allocate space to write %s!", bf.filename);
+    }
+    memcpy(copy, buf, bytes);
+    w->extras = extras;
+    w->extras[w->num_extras].kind = kind;
+    w->extras[w->num_extras].bytes = copy;
+    w->extras[w->num_extras].size = bytes;
+    w->num_extras++;
+}
+
+// Return the hash of the symbol name name (its FNV-1a hash)
+static uword_type symbol_name_hash(const char *name)
+{
+    uint32_t h = 2166136261u;
+    for (const unsigned char *c = (const unsigned char *) name; *c != '\0';
+	 c++) {
+	h = (h ^ *c) * 16777619u;
+    }
+    return h;
+}
+
+// Return the hash of the symbol address addr
+// (a multiplicative hash, which keeps nearby addresses apart)
+static uword_type symbol_addr_hash(address_type addr)
+{
+    return (uint32_t) addr * 2654435761u;
+}
+
+// Compare the bof_symbol_t values pointed to by a and b
+// by their addresses, then their kinds, then their names
+static int compare_symbols(const void *a, const void *b)
+{
+    const bof_symbol_t *x = a;
+    const bof_symbol_t *y = b;
+    if (x->addr != y->addr) {
+	return x->addr < y->addr ? -1 : 1;
+    }
+    if (x->kind != y->kind) {
+	return x->kind < y->kind ? -1 : 1;
+    }
+    return strcmp(x->name, y->name);
+}
+
+// Requires: bf is open for writing in binary
+// Add a symbols section holding the count symbols to bf,
+// as bof_write_section does (so if bf was not opened by
+// bof_write_open2, do nothing). The symbols may be in any order.
+// Exit the program with an error if this fails.
+void bof_write_symbols(BOFFILE bf, const bof_symbol_t *symbols,
+		       unsigned int count)
+{
+    if (bf.writer == NULL) {
+	return;
+    }
+    BOFSymbolsHeader sh;
+    sh.count = count;
+    sh.num_buckets = 1;
+    while (sh.num_buckets < count) {
+	sh.num_buckets *= 2;
+    }
+    size_t names_size = 0;
+    for (unsigned int i = 0; i < count; i++) {
+	names_size += strlen(symbols[i].name) + 1;
+    }
+    size_t table_offset = sizeof(sh);
+    size_t buckets_offset = table_offset + count * sizeof(BOFSymbol);
+    size_t names_offset = buckets_offset
+	+ 2 * (size_t) sh.num_buckets * sizeof(uword_type);
+    size_t size = names_offset + names_size;
+    // (at least 1 of each, so malloc does not return NULL)
+    unsigned char *sec = malloc(size);
+    bof_symbol_t *sorted = malloc((count + 1) * sizeof(bof_symbol_t));
+    if (sec == NULL || sorted == NULL) {
+	bail_with_error("Cannot allocate space for the %u symbols of %s!",
+			count, bf.filename);
+    }
+    memcpy(sorted, symbols, count * sizeof(bof_symbol_t));
+    qsort(sorted, count, sizeof(bof_symbol_t), compare_symbols);
+
+    // (the section is built in allocated space, so it is aligned)
+    memcpy(sec, &sh, sizeof(sh));
+    BOFSymbol *table = (BOFSymbol *) (sec + table_offset);
+    uword_type *name_buckets = (uword_type *) (sec + buckets_offset);
+    uword_type *addr_buckets = name_buckets + sh.num_buckets;
+    char *names = (char *) sec + names_offset;
+    for (uword_type b = 0; b < sh.num_buckets; b++) {
+	name_buckets[b] = BOF_NO_SYMBOL;
+	addr_buckets[b] = BOF_NO_SYMBOL;
+    }
+    size_t name = 0;
+    for (unsigned int i = 0; i < count; i++) {
+	table[i].addr = sorted[i].addr;
+	table[i].kind = sorted[i].kind;
+	table[i].name = name;
+	size_t len = strlen(sorted[i].name) + 1;
+	memcpy(names + name, sorted[i].name, len);
+	name += len;
+    }
+    // chain each bucket's symbols in increasing order
+    uword_type mask = sh.num_buckets - 1;
+    for (unsigned int i = count; i-- > 0; ) {
+	uword_type nb = symbol_name_hash(sorted[i].name) & mask;
+	uword_type ab = symbol_addr_hash(sorted[i].addr) & mask;
+	table[i].name_next = name_buckets[nb];
+	name_buckets[nb] = i;
+	table[i].addr_next = addr_buckets[ab];
+	addr_buckets[ab] = i;
+    }
+    bof_write_section(bf, bof_symbols_section, size, sec);
+    free(sorted);
+    free(sec);
+}
+
 // Requres: bf is open
 // Close the given binary file
+// (writing a file opened by bof_write_open2 first).
 // Exit the program with an error if this fails.
 void bof_close(BOFFILE bf)
 {
+    if (bof_is_mapped(bf)) {
+	bof_map_t *map = bf.map;
+	if (map->file_size > 0) {
+#ifdef BOF_MMAP
+	    if (map->owner == map_mapped) {
+		munmap((void *) map->file_bytes, map->file_size);
+	    }
+#endif
+	    if (map->owner == map_allocated) {
+		free((void *) map->file_bytes);
+	    }
+	}
+	free(map->decompressed[0]);
+	free(map->decompressed[1]);
+	free(map);
+	return;
+    }
+    if (bf.writer != NULL) {
+	write_file2(bf);
+	for (unsigned int s = 0; s < bf.writer->num_extras; s++) {
+	    free(bf.writer->extras[s].bytes);
+	}
+	free(bf.writer->extras);
+	free(bf.writer->bytes);
+	free(bf.writer);
+    }
     if (fclose(bf.fileptr) != 0) {
 	bail_with_error("Could not close %s", bf.filename);
     }
@@ -155,16 +1021,40 @@ extern void bof_write_word(BOFFILE bf, word_type w)
 // Exit the program with an error if this fails.
 void bof_write_bytes(BOFFILE bf, size_t bytes,
 		     const void *buf) {
-    size_t wr = fwrite(buf, bytes, 1, bf.fileptr);
-    if (wr != 1) {
-	bail_with_error("Cannot write %u bytes to %s", bytes, bf.filename);
+    bof_writer_t *w = bf.writer;
+    if (w == NULL) {
+	size_t wr = fwrite(buf, bytes, 1, bf.fileptr);
+	if (wr != 1) {
+	    bail_with_error("Cannot write %u bytes to %s", bytes, bf.filename);
+	}
+	return;
+    }
+    if (bytes > w->capacity - w->size) {
+	size_t capacity = w->capacity == 0 ? 1024 : w->capacity;
+	while (bytes > capacity - w->size) {
+	    capacity *= 2;
+	}
+	unsigned char *grown = realloc(w->bytes, capacity);
+	if (grown == NULL) {
+	    bail_with_error("Cannot allocate space to write %s!",
+			    bf.filename);
+	}
+	w->bytes = grown;
+	w->capacity = capacity;
     }
+    memcpy(w->bytes + w->size, buf, bytes);
+    w->size += bytes;
 }
 
 // Requires: bf is open for writing in binary
 // Write the given header to f
 // Exit the program with an error if this fails.
 void bof_write_header(BOFFILE bf, const BOFHeader hdr) {
+    if (bf.writer != NULL) {
+	bf.writer->header = hdr;
+	bf.writer->have_header = true;
+	return;
+    }
     size_t wr = fwrite(&hdr, sizeof(BOFHeader), 1, bf.fileptr);
     if (wr != 1) {
 	bail_with_error("Canot write header to %s", bf.filename);
@@ -191,3 +1081,134 @@ bool bof_has_correct_magic_number(BOFHeader bh)
     buf[MAGIC_BUFFER_SIZE] = '\0';
     return (0 == strncmp(buf, MAGIC, MAGIC_BUFFER_SIZE));
 }
+
+// Is the chain of symbols starting with first (through the next fields
+// at offset next in each symbol) of the count symbols in st increasing?
+static bool chain_okay(const bof_symbols_t *st, uword_type first,
+		       size_t next)
+{
+    for (uword_type i = first; i != BOF_NO_SYMBOL; ) {
+	if (i >= st->count) {
+	    return false;
+	}
+	uword_type n;
+	memcpy(&n, (const unsigned char *) &st->symbols[i] + next, sizeof(n));
+	if (n != BOF_NO_SYMBOL && n <= i) {
+	    return false;
+	}
+	i = n;
+    }
+    return true;
+}
+
+// Requires: bytes is aligned for words
+// Set *st to the symbols of the bof_symbols_section in the size bytes
+// at bytes. Return an error message if they are not a valid
+// symbols section, and otherwise NULL.
+const char *bof_symbols_open(bof_symbols_t *st, const void *bytes,
+			     size_t size)
+{
+    const unsigned char *b = bytes;
+    BOFSymbolsHeader sh;
+    if (size < sizeof(sh)) {
+	return "The symbols section has no header!";
+    }
+    memcpy(&sh, b, sizeof(sh));
+    if (sh.num_buckets == 0 || (sh.num_buckets & (sh.num_buckets - 1)) != 0
+	|| sh.count > (size - sizeof(sh)) / sizeof(BOFSymbol)
+	|| sh.num_buckets > (size - sizeof(sh) - sh.count * sizeof(BOFSymbol))
+	   / (2 * sizeof(uword_type))) {
+	return "The symbols and hash index of the symbols section "
+	    "do not fit in it!";
+    }
+    size_t names_offset = sizeof(sh) + sh.count * sizeof(BOFSymbol)
+	+ 2 * (size_t) sh.num_buckets * sizeof(uword_type);
+    size_t names_size = size - names_offset;
+    if (sh.count > 0 && (names_size == 0 || b[size - 1] != '\0')) {
+	return "The names of the symbols section "
+	    "do not end with a null character!";
+    }
+    st->count = sh.count;
+    st->num_buckets = sh.num_buckets;
+    st->symbols = (const BOFSymbol *) (b + sizeof(sh));
+    st->name_buckets = (const uword_type *)
+	(b + sizeof(sh) + sh.count * sizeof(BOFSymbol));
+    st->addr_buckets = st->name_buckets + sh.num_buckets;
+    st->names = (const char *) b + names_offset;
+    for (uword_type i = 0; i < st->count; i++) {
+	if (st->symbols[i].name >= names_size
+	    || (i > 0 && st->symbols[i].addr < st->symbols[i - 1].addr)) {
+	    return "The symbols of the symbols section are not valid!";
+	}
+    }
+    for (uword_type k = 0; k < st->num_buckets; k++) {
+	if (!chain_okay(st, st->name_buckets[k],
+			offsetof(BOFSymbol, name_next))
+	    || !chain_okay(st, st->addr_buckets[k],
+			   offsetof(BOFSymbol, addr_next))) {
+	    return "The hash index of the symbols section is not valid!";
+	}
+    }
+    return NULL;
+}
+
+// Return the name of symbol i of st (where i < st->count)
+const char *bof_symbols_name(const bof_symbols_t *st, uword_type i)
+{
+    return st->names + st->symbols[i].name;
+}
+
+// Return the index of the first symbol of st named name,
+// or BOF_NO_SYMBOL if there is none
+uword_type bof_symbols_find(const bof_symbols_t *st, const char *name)
+{
+    uword_type i = st->name_buckets[symbol_name_hash(name)
+				    & (st->num_buckets - 1)];
+    while (i != BOF_NO_SYMBOL
+	   && strcmp(bof_symbols_name(st, i), name) != 0) {
+	i = st->symbols[i].name_next;
+    }
+    return i;
+}
+
+// Return the index of the first symbol of st at addr,
+// or BOF_NO_SYMBOL if there is none
+uword_type bof_symbols_at(const bof_symbols_t *st, address_type addr)
+{
+    uword_type i = st->addr_buckets[symbol_addr_hash(addr)
+				    & (st->num_buckets - 1)];
+    while (i != BOF_NO_SYMBOL && st->symbols[i].addr != addr) {
+	i = st->symbols[i].addr_next;
+    }
+    return i;
+}
+
+// Return the index of the last symbol of st at or before addr
+// that is not a data symbol (or the first of those at its address),
+// or BOF_NO_SYMBOL if there is none
+uword_type bof_symbols_containing(const bof_symbols_t *st, address_type addr)
+{
+    // find the first symbol after addr (by binary search)
+    uword_type lo = 0;
+    uword_type hi = st->count;
+    while (lo < hi) {
+	uword_type mid = lo + (hi - lo) / 2;
+	if (st->symbols[mid].addr <= addr) {
+	    lo = mid + 1;
+	} else {
+	    hi = mid;
+	}
+    }
+    while (lo > 0 && st->symbols[lo - 1].kind == bof_data_symbol) {
+	lo--;
+    }
+    if (lo == 0) {
+	return BOF_NO_SYMBOL;
+    }
+    uword_type i = lo - 1;
+    while (i > 0 && st->symbols[i - 1].addr == st->symbols[i].addr
+	   && st->symbols[i - 1].kind != bof_data_symbol) {
+	i--;
+    }
+    return i;
+}
@@ -18,10 +18,123 @@ typedef struct { // Field magic should hold value of MAGIC (with no null char)
     word_type stack_bottom_addr;   // word address of stack "bottom" (FP)
 } BOFHeader;
 
+// Version 2 of the format starts with a BOFHeader2 (whose magic is "BOF2"),
+// followed by a table of its num_sections sections.
+// The bytes of each section start at a multiple of BOF_SECTION_ALIGNMENT
+// bytes from the start of the file, so a mapped file's sections
+// can be read in place. Each section has a checksum, and the text
+// and data sections may be compressed. Readers skip sections
+// of kinds that they do not know. Files in the first version
+// (with a BOFHeader, whose magic is "BO32") are still read.
+#define BOF_VERSION 2
+#define BOF_SECTION_ALIGNMENT 16
+
+typedef struct { // Field magic should hold "BOF2"
+    char      magic[MAGIC_BUFFER_SIZE];
+    word_type version;             // BOF_VERSION
+    word_type text_start_address;  // word address to start running (PC)
+    word_type data_start_address;  // word address of static data (GP)
+    word_type stack_bottom_addr;   // word address of stack "bottom" (FP)
+    word_type num_sections;        // number of entries in the section table
+} BOFHeader2;
+
+// the kinds of sections in version 2
+typedef enum {
+    bof_text_section = 1, bof_data_section = 2, bof_lines_section = 3,
+    bof_symbols_section = 4
+} bof_section_kind;
+
+// the flag of a section whose bytes are compressed (see bof.c)
+#define BOF_COMPRESSED 1
+
+typedef struct { // an entry in the section table of version 2
+    uword_type kind;          // a bof_section_kind
+    uword_type flags;         // BOF_COMPRESSED or 0
+    uword_type offset;        // byte offset of its bytes in the file
+    uword_type stored_bytes;  // number of its bytes in the file
+    uword_type length;        // its size in bytes, when not compressed
+    uword_type checksum[2];   // Fletcher-64 sums of its uncompressed bytes
+} BOFSection;
+
+// A section of kind bof_lines_section (which is optional) maps
+// the addresses in the text section to the lines of the source files
+// that their instructions were compiled from. It holds a word
+// giving the number of entries, then the entries (in increasing order
+// of their start addresses), and then the names of the source files,
+// each ending with a null character (so the section does too).
+// An entry's line is that of the addresses from its start up to the
+// start of the next entry (or the end of the text section);
+// the addresses of a line of 0 do not come from any line in the source.
+typedef struct {
+    uword_type start;  // the first word address of the entry
+    uword_type line;   // the line number in the file (counting from 1)
+    uword_type file;   // the offset of the file's name from that of the first
+} BOFLineEntry;
+
+// A section of kind bof_symbols_section (which is optional) names
+// addresses in the text and data sections. It holds a BOFSymbolsHeader,
+// then the symbols (in increasing order of their addresses), then a hash
+// index of their names and one of their addresses (num_buckets words
+// each, giving the first symbol whose name, or address, hashes to that
+// bucket, see bof_symbols_find and bof_symbols_at), and then their names,
+// each ending with a null character (so the section does too).
+// The symbols in a bucket are chained (in increasing order)
+// through their name_next or addr_next fields.
+typedef struct {
+    uword_type count;        // the number of symbols
+    uword_type num_buckets;  // the size of each hash index (a power of 2)
+} BOFSymbolsHeader;
+
+// the kinds of symbols (in the order they are listed at one address)
+typedef enum {
+    bof_procedure_symbol = 1, bof_label_symbol = 2, bof_data_symbol = 3
+} bof_symbol_kind;
+
+// the end of a chain of symbols (and the bucket of an empty chain)
+#define BOF_NO_SYMBOL ((uword_type) 0xFFFFFFFF)
+
+typedef struct { // a symbol in a bof_symbols_section
+    uword_type addr;       // the word address it names
+    uword_type kind;       // a bof_symbol_kind
+    uword_type name;       // the offset of its name from that of the first
+    uword_type name_next;  // the next symbol in its name's bucket
+    uword_type addr_next;  // the next symbol in its address's bucket
+} BOFSymbol;
+
+// a symbol to be written by bof_write_symbols
+typedef struct {
+    const char *name;
+    address_type addr;
+    bof_symbol_kind kind;
+} bof_symbol_t;
+
+// the symbols of a bof_symbols_section, read in place
+// (see bof_symbols_open)
+typedef struct {
+    uword_type count;
+    uword_type num_buckets;
+    const BOFSymbol *symbols;
+    const uword_type *name_buckets;
+    const uword_type *addr_buckets;
+    const char *names;
+} bof_symbols_t;
+
+// the bytes of a file opened by bof_map_open (see bof.c)
+typedef struct bof_map_s bof_map_t;
+
+// what is written to a file opened by bof_write_open2 (see bof.c)
+typedef struct bof_writer_s bof_writer_t;
+
 // a type for Binary Output Files
 typedef struct {
     FILE *fileptr;
     const char *filename;
+    // the file's bytes and the offset of the next one read,
+    // if it was opened by bof_map_open (and otherwise NULL)
+    bof_map_t *map;
+    // what has been written, if it was opened by bof_write_open2
+    // (and otherwise NULL)
+    bof_writer_t *writer;
 } BOFFILE;
 
 // Open filename for reading as a binary file
@@ -29,6 +142,31 @@ typedef struct {
 // otherwise return the FILE pointer to the open file.
 extern BOFFILE bof_read_open(const char *filename);
 
+// Open filename for reading as a binary file that is mapped into memory
+// (or, on hosts without mmap, read into memory all at once),
+// so that it can be read without a system call or a copy per word,
+// and its sections can be walked in place (see bof_read_view).
+// All of the reading functions below work on the result.
+// Exit the program with an error if this fails,
+// otherwise return the BOFFILE for the file.
+extern BOFFILE bof_map_open(const char *filename);
+
+// Return a BOFFILE (named name) for reading the size bytes at bytes,
+// in place, as if it were a file opened by bof_map_open.
+// The bytes must stay unchanged until it is closed.
+extern BOFFILE bof_memory_open(const char *name, const void *bytes,
+			       size_t size);
+
+// Was bf opened by bof_map_open (or bof_memory_open)?
+extern bool bof_is_mapped(BOFFILE bf);
+
+// Requires: bof_is_mapped(bf)
+// Return a pointer to the next bytes bytes of bf, in place
+// (they are read-only, and valid until bf is closed), and skip them;
+// but if fewer than bytes bytes are left, return NULL and skip nothing.
+// (The pointer is only as aligned as bytes from the file's start are.)
+extern const void *bof_read_view(BOFFILE bf, size_t bytes);
+
 // Return the size (in bytes) of bf
 extern size_t bof_file_bytes(BOFFILE bf);
 
@@ -43,18 +181,82 @@ extern word_type bof_read_word(BOFFILE bf);
 // Requires: bf is open for reading in binary and
 // buf is of size at least bytes
 // Read the given number of bytes into buf and return the number of bytes read
-size_t bof_read_bytes(BOFFILE bf, size_t bytes, void *buf);
+// (which is less than bytes only at the end of bf)
+extern size_t bof_read_bytes(BOFFILE bf, size_t bytes, void *buf);
 
 // Requires: bf is open for reading in binary
 // Read the header of bf as a BOFHeader and return that header
 // If any errors are encountered, exit with an error message.
+// The header of a file in version 2 is returned as a BOFHeader
+// (with the magic number of the first version), after checking
+// the checksums of its text and data sections and decompressing them,
+// and then the reading functions read those sections (in that order)
+// as if they followed that header. A file in version 2 must have been
+// opened by bof_map_open (or bof_memory_open).
 extern BOFHeader bof_read_header(BOFFILE);
 
+// Requires: bf is open for reading in binary
+// Read the header of bf into *bh, as bof_read_header does,
+// but return an error message (valid until bf is closed)
+// if that cannot be done, instead of exiting; return NULL if it worked.
+extern const char *bof_try_read_header(BOFFILE bf, BOFHeader *bh);
+
+// Requires: bof_read_header(bf) has been called
+// Return the version of the format (1 or BOF_VERSION) that bf is in
+extern unsigned int bof_version(BOFFILE bf);
+
+// Requires: bof_read_header(bf) has been called
+// Set *bytes to point to the bytes of bf's section of the given kind
+// (not its text or data section), in place (they are read-only,
+// and valid until bf is closed), and *size to their number,
+// after checking its checksum; but set *bytes to NULL if bf has no
+// such section (as a file in the first version does not).
+// Return an error message (valid until bf is closed) if the section
+// is not valid, and otherwise NULL.
+extern const char *bof_try_read_section(BOFFILE bf, bof_section_kind kind,
+					const void **bytes, size_t *size);
+
+// Requires: bof_read_header(bf) has been called
+// Return a pointer to the bytes of bf's section of the given kind,
+// and set *size to their number, as bof_try_read_section does,
+// returning NULL if bf has no such section.
+// If the section is not valid, exit with an error message.
+extern const void *bof_read_section(BOFFILE bf, bof_section_kind kind,
+				    size_t *size);
+
 // Open filename for writing as a binary file
 // Exit the program with an error if this fails,
 // otherwise return the BOFFILE for it.
 extern BOFFILE bof_write_open(const char *filename);
 
+// Open filename for writing as a binary file in version 2 of the format,
+// whose text and data sections are compressed if compress is true
+// (and compressing them makes them smaller).
+// What is written is kept in memory until bof_close writes the file:
+// a header (see bof_write_header), then the words of the text section,
+// and then the words of the data section, as in the first version.
+// Exit the program with an error if this fails,
+// otherwise return the BOFFILE for it.
+extern BOFFILE bof_write_open2(const char *filename, bool compress);
+
+// Requires: bf is open for writing in binary
+//           and the size of buf is at least bytes
+// Add a section of the given kind (not the text or data section)
+// holding the given number of bytes from buf to bf,
+// which is written when bf is closed, if bf was opened by bof_write_open2;
+// otherwise do nothing (as the first version has no other sections).
+// Exit the program with an error if this fails.
+extern void bof_write_section(BOFFILE bf, bof_section_kind kind,
+			      size_t bytes, const void *buf);
+
+// Requires: bf is open for writing in binary
+// Add a symbols section (see above) holding the count symbols
+// to bf, as bof_write_section does (so if bf was not opened by
+// bof_write_open2, do nothing). The symbols may be in any order.
+// Exit the program with an error if this fails.
+extern void bof_write_symbols(BOFFILE bf, const bof_symbol_t *symbols,
+			      unsigned int count);
+
 // Requres: bf is open
 // Close the given binary file
 // Exit the program with an error if this fails.
@@ -83,6 +285,33 @@ extern void bof_write_magic_to_header(BOFHeader *bh);
 // Does the given header have the appropriate magic number?
 bool bof_has_correct_magic_number(BOFHeader bh);
 
+// Requires: bytes is aligned for words
+// Set *st to the symbols of the bof_symbols_section in the size bytes
+// at bytes (which must stay unchanged while *st is used).
+// Return an error message if they are not a valid symbols section,
+// and otherwise NULL.
+extern const char *bof_symbols_open(bof_symbols_t *st, const void *bytes,
+				    size_t size);
+
+// Return the name of symbol i of st (where i < st->count)
+extern const char *bof_symbols_name(const bof_symbols_t *st, uword_type i);
+
+// Return the index of the first symbol of st named name (through the hash
+// index of the names, so in constant time on average),
+// or BOF_NO_SYMBOL if there is none
+extern uword_type bof_symbols_find(const bof_symbols_t *st, const char *name);
+
+// Return the index of the first symbol of st at addr (through the hash
+// index of the addresses, so in constant time on average),
+// or BOF_NO_SYMBOL if there is none
+extern uword_type bof_symbols_at(const bof_symbols_t *st, address_type addr);
+
+// Return the index of the last symbol of st at or before addr
+// that is not a data symbol (the procedure or label that addr is in,
+// if it is in the text section), or BOF_NO_SYMBOL if there is none
+extern uword_type bof_symbols_containing(const bof_symbols_t *st,
+					 address_type addr);
+
 // The following line is for the manual (i.e., the document itself)y
 // ...
 #endif
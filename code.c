@@ -18,6 +18,7 @@ static code *code_create(bin_instr_t instr)
     }
     ret->next = NULL;
     ret->instr = instr;
+    ret->file_loc = NULL;
     return ret;
 }
 
@@ -4,11 +4,15 @@
 #include <stdbool.h>
 #include "machine_types.h"
 #include "instruction.h"
+#include "file_location.h"
 
 // SSM assembly language instructions (that can be in linked lists)
+// with the location in the source that they were generated for
+// (or NULL, if that is not known)
 typedef struct code_s {
     struct code_s *next;
     bin_instr_t instr;
+    file_location *file_loc;
 } code;
 
 // Code creation functions below
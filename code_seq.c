@@ -1,5 +1,6 @@
 /* $Id: code_seq.c,v 1.4 2024/11/08 21:01:43 leavens Exp $ */
 #include <stdlib.h>
+#include <string.h>
 #include <limits.h>
 #include <assert.h>
 #include "utilities.h"
@@ -133,3 +134,106 @@ void code_seq_debug_print(FILE *out, code_seq seq)
 	seq = code_seq_rest(seq);
     }
 }
+
+// Set the source location of each instruction in seq that has none to fl
+void code_seq_set_location(code_seq seq, file_location *fl)
+{
+    while (!code_seq_is_empty(seq)) {
+	code *c = code_seq_first(seq);
+	if (c->file_loc == NULL) {
+	    c->file_loc = fl;
+	}
+	seq = code_seq_rest(seq);
+    }
+}
+
+// Make the space *buf (of *capacity bytes, size of which are used)
+// big enough for more bytes after those, reallocating it if need be
+static void grow(unsigned char **buf, size_t *capacity, size_t size,
+		 size_t more)
+{
+    if (size + more <= *capacity) {
+	return;
+    }
+    size_t cap = *capacity == 0 ? 256 : *capacity;
+    while (size + more > cap) {
+	cap *= 2;
+    }
+    *buf = realloc(*buf, cap);
+    if (*buf == NULL) {
+	bail_with_error("Not enough space to build a line table!");
+    }
+    *capacity = cap;
+}
+
+// Return the offset of filename among the names (size bytes long)
+// in *names, adding it to the end of them if it is not there
+static uword_type name_offset(unsigned char **names, size_t *capacity,
+			      size_t *size, const char *filename)
+{
+    size_t off = 0;
+    while (off < *size) {
+	if (strcmp((const char *) *names + off, filename) == 0) {
+	    return off;
+	}
+	off += strlen((const char *) *names + off) + 1;
+    }
+    size_t len = strlen(filename) + 1;
+    grow(names, capacity, *size, len);
+    memcpy(*names + *size, filename, len);
+    *size += len;
+    return off;
+}
+
+// Requires: bf is open for writing in binary,
+//           and seq is the whole text section of the program, in order
+// Add a line table (see bof.h) to bf, giving the source line
+// of each instruction in seq that has a source location.
+void code_seq_write_line_table(BOFFILE bf, code_seq seq)
+{
+    unsigned char *entries = NULL;
+    size_t entries_cap = 0;
+    size_t entries_size = 0;
+    unsigned char *names = NULL;
+    size_t names_cap = 0;
+    size_t names_size = 0;
+    uword_type count = 0;
+    BOFLineEntry last = { 0, 0, 0 };
+    // (instructions without a location are on line 0 of the first file)
+    for (uword_type addr = 0; !code_seq_is_empty(seq);
+	 addr++, seq = code_seq_rest(seq)) {
+	const file_location *fl = code_seq_first(seq)->file_loc;
+	BOFLineEntry e = { addr, 0, 0 };
+	if (fl != NULL) {
+	    e.line = fl->line;
+	    e.file = name_offset(&names, &names_cap, &names_size,
+				 fl->filename);
+	}
+	if (count > 0 && e.line == last.line && e.file == last.file) {
+	    continue;
+	}
+	if (count == 0 && e.line == 0) {
+	    // (addresses before the first entry have no source line)
+	    continue;
+	}
+	grow(&entries, &entries_cap, entries_size, sizeof(e));
+	memcpy(entries + entries_size, &e, sizeof(e));
+	entries_size += sizeof(e);
+	count++;
+	last = e;
+    }
+    if (count > 0) {
+	size_t bytes = sizeof(count) + entries_size + names_size;
+	unsigned char *sec = malloc(bytes);
+	if (sec == NULL) {
+	    bail_with_error("Not enough space to build a line table!");
+	}
+	memcpy(sec, &count, sizeof(count));
+	memcpy(sec + sizeof(count), entries, entries_size);
+	memcpy(sec + sizeof(count) + entries_size, names, names_size);
+	bof_write_section(bf, bof_lines_section, bytes, sec);
+	free(sec);
+    }
+    free(entries);
+    free(names);
+}
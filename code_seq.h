@@ -3,6 +3,7 @@
 #define _CODE_SEQ_H
 #include <stdbool.h>
 #include "code.h"
+#include "bof.h"
 
 // code sequences are linked lists
 // with an additional last pointer to the last node
@@ -50,4 +51,16 @@ extern void code_seq_concat(code_seq *s1, code_seq s2);
 // in assembly language format
 extern void code_seq_debug_print(FILE *out, code_seq seq);
 
+// Set the source location of each instruction in seq that has none to fl
+// (so the code generated for an AST can be given the AST's file_loc
+// after the code for its parts has been given theirs)
+extern void code_seq_set_location(code_seq seq, file_location *fl);
+
+// Requires: bf is open for writing in binary,
+//           and seq is the whole text section of the program, in order
+// Add a line table (see bof.h) to bf, giving the source line
+// of each instruction in seq that has a source location.
+// (This does nothing unless bf was opened by bof_write_open2.)
+extern void code_seq_write_line_table(BOFFILE bf, code_seq seq);
+
 #endif
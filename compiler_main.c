@@ -10,27 +10,18 @@
 #include "utilities.h"
 #include "symtab.h"
 #include "scope_check.h"
-
-// The functions gen_code_initialize and gen_code_program
-// would normally be declared in gen_code.h,
-// but part of the homework is to write that gen_code module,
-// so they are declared below to make this file self-contained.
-
-// Initialize the code generator
-extern void gen_code_initialize();
-
-// Requires: bf is open for writing
-// Generate code for prog into bf
-extern void gen_code_program(BOFFILE bf, block_t prog);
+#include "gen_code.h"
 
 /* Print a usage message on stderr 
    and exit with failure. */
 static void usage(const char *cmdname)
 {
-    fprintf(stderr, "Usage: %s %s\n       %s %s\n       %s %s\n",
+    fprintf(stderr, "Usage: %s %s\n       %s %s\n       %s %s\n%s\n%s\n",
 	    cmdname, "-l codeFilename.spl",
 	    cmdname, "-u codeFilename.spl",
-	    cmdname, " codeFilename.spl"
+	    cmdname, "[-2 | -z] codeFilename.spl",
+	    "where -2 writes version 2 of the binary object file format,",
+	    "and -z writes version 2 with compressed sections"
 	    );
     exit(EXIT_FAILURE);
 }
@@ -44,10 +35,13 @@ int main(int argc, char *argv[])
     bool lexer_print_output = false;
     // should the unparse of the AST be shown?
     bool parser_unparse = false;
+    // should version 2 of the BOF format be written (compressed)?
+    bool bof_version2 = false;
+    bool bof_compress = false;
     const char *cmdname = argv[0];
     argc--;
     argv++;
-    // possible options: -l, and -u
+    // possible options: -l, -u, -2, and -z
     while (argc > 0 && strlen(argv[0]) >= 2 && argv[0][0] == '-') {
 	if (strcmp(argv[0],"-l") == 0) {
 	    lexer_print_output = true;
@@ -57,6 +51,15 @@ int main(int argc, char *argv[])
 	    parser_unparse = true;
 	    argc--;
 	    argv++;
+	} else if (strcmp(argv[0],"-2") == 0) {
+	    bof_version2 = true;
+	    argc--;
+	    argv++;
+	} else if (strcmp(argv[0],"-z") == 0) {
+	    bof_version2 = true;
+	    bof_compress = true;
+	    argc--;
+	    argv++;
 	} else {
 	    // bad option!
 	    usage(cmdname);
@@ -113,8 +116,11 @@ int main(int argc, char *argv[])
 
     // generate code from the ASTs
     gen_code_initialize();
-    BOFFILE bf = bof_write_open(boffilename);
+    BOFFILE bf = bof_version2 ? bof_write_open2(boffilename, bof_compress)
+	: bof_write_open(boffilename);
     gen_code_program(bf, progast);
+    // (a file in version 2 is only written when it is closed)
+    bof_close(bf);
 
     return EXIT_SUCCESS;
 }
@@ -1,267 +1,616 @@
 /* $Id: gen_code.c,v 1.10 2023/03/30 21:28:07 leavens Exp $ */
+#include <stdlib.h>
+#include <assert.h>
 #include "utilities.h"
 #include "gen_code.h"
+#include "spl.tab.h"
+#include "id_use.h"
+#include "literal_table.h"
+#include "regname.h"
+#include "code.h"
+#include "code_utils.h"
+
+// Each instruction is given the location of the smallest AST
+// that it was generated for (see code_seq_set_location),
+// for the line table of the text section.
+// The code is laid out with the code of all the procedures first
+// (in the order they are finished, so nested ones before the one
+// they are declared in), followed by the code for the program's block,
+// where execution starts.
+// The program's constants and variables are the first words
+// of the data section (at their offset_count from $gp),
+// followed by the literal table.
+// The constants and variables of every other block are in its
+// activation record (at their offset_count from its $fp).
+
+// number of words for the stack, after the data section
+#define STACK_SPACE 4096
+
+// The code of the procedures so far
+static code_seq procs;
+
+// The number of blocks that the block being generated is nested in
+// (so 0 for the program's block)
+static unsigned int nesting_level;
+
+// The number of constants and variables declared in the program's block
+// (the literal table follows them in the data section)
+static unsigned int global_count;
+
+// The procedures placed in procs so far, with their addresses
+typedef struct proc_entry_s {
+    struct proc_entry_s *next;
+    const char *name;
+    id_attrs *attrs;
+    address_type address;
+} proc_entry;
+static proc_entry *proc_entries;
+static unsigned int proc_count;
+
+// The calls generated so far, to be given their targets
+// once every procedure has been placed
+typedef struct call_site_s {
+    struct call_site_s *next;
+    code *call;
+    id_attrs *callee;
+} call_site;
+static call_site *call_sites;
 
 // Initialize the code generator
 void gen_code_initialize()
 {
-    literal_table_initialize()
+    literal_table_initialize();
+    procs = code_seq_empty();
+    nesting_level = 0;
+    global_count = 0;
+    proc_entries = NULL;
+    proc_count = 0;
+    call_sites = NULL;
+}
+
+// Return the number of constants and variables declared in blk
+static unsigned int block_loc_count(block_t *blk)
+{
+    unsigned int ret = 0;
+    for (const_decl_t *cd = blk->const_decls.start; cd != NULL;
+	 cd = cd->next) {
+	for (const_def_t *def = cd->const_def_list.start; def != NULL;
+	     def = def->next) {
+	    ret++;
+	}
+    }
+    for (var_decl_t *vd = blk->var_decls.var_decls; vd != NULL;
+	 vd = vd->next) {
+	for (ident_t *id = vd->ident_list.start; id != NULL; id = id->next) {
+	    ret++;
+	}
+    }
+    return ret;
+}
+
+// Return the offset of the literal n from $gp
+static offset_type literal_offset(number_t n)
+{
+    return global_count + literal_table_lookup(n.text, n.value);
 }
 
-code_seq gen_code_program(AST *prog)
+// Return the code that puts into *reg the register that the
+// constant or variable used (as described by idu) is at an offset from
+// (its offset_count): $gp for the program's own,
+// $fp for those of the current block,
+// and otherwise $r3, set to the $fp of the block that declares it
+static code_seq gen_code_base(id_use *idu, reg_num_type *reg)
+{
+    assert(id_use_get_attrs(idu)->kind != procedure_idk);
+    if (idu->levelsOutward == nesting_level) {
+	*reg = GP;
+	return code_seq_empty();
+    } else if (idu->levelsOutward == 0) {
+	*reg = FP;
+	return code_seq_empty();
+    }
+    *reg = 3;
+    return code_utils_compute_fp(3, idu->levelsOutward);
+}
+
+// Return the address in procs of the procedure with the given attributes
+static address_type proc_address(id_attrs *attrs)
+{
+    for (proc_entry *pe = proc_entries; pe != NULL; pe = pe->next) {
+	if (pe->attrs == attrs) {
+	    return pe->address;
+	}
+    }
+    bail_with_error("No code was generated for the procedure called!");
+    return 0;
+}
+
+// Add the names of the procedures, of the program's code (as "main",
+// which starts at main_address), and of the program's constants and
+// variables (in the data section, starting at data_start) to bf
+// (as a symbols section, which is only written in version 2 of the format)
+static void gen_code_symbols(BOFFILE bf, block_t prog,
+			     address_type main_address,
+			     address_type data_start)
+{
+    unsigned int count = proc_count + 1 + global_count;
+    bof_symbol_t *symbols = malloc(count * sizeof(bof_symbol_t));
+    if (symbols == NULL) {
+	bail_with_error("Not enough space for the %u symbols!", count);
+    }
+    unsigned int i = 0;
+    for (proc_entry *pe = proc_entries; pe != NULL; pe = pe->next) {
+	symbols[i].name = pe->name;
+	symbols[i].kind = bof_procedure_symbol;
+	symbols[i].addr = pe->address;
+	i++;
+    }
+    symbols[i].name = "main";
+    symbols[i].kind = bof_procedure_symbol;
+    symbols[i].addr = main_address;
+    i++;
+    // (the declarations' offset_counts number them in order)
+    unsigned int ofst = 0;
+    for (const_decl_t *cd = prog.const_decls.start; cd != NULL;
+	 cd = cd->next) {
+	for (const_def_t *def = cd->const_def_list.start; def != NULL;
+	     def = def->next) {
+	    symbols[i].name = def->ident.name;
+	    symbols[i].kind = bof_data_symbol;
+	    symbols[i].addr = data_start + ofst++;
+	    i++;
+	}
+    }
+    for (var_decl_t *vd = prog.var_decls.var_decls; vd != NULL;
+	 vd = vd->next) {
+	for (ident_t *id = vd->ident_list.start; id != NULL; id = id->next) {
+	    symbols[i].name = id->name;
+	    symbols[i].kind = bof_data_symbol;
+	    symbols[i].addr = data_start + ofst++;
+	    i++;
+	}
+    }
+    assert(i == count);
+    bof_write_symbols(bf, symbols, count);
+    free(symbols);
+}
+
+// Requires: bf is open for writing
+// Generate code for prog into bf
+void gen_code_program(BOFFILE bf, block_t prog)
+{
+    global_count = block_loc_count(&prog);
+    nesting_level = 0;
+    gen_code_proc_decls(prog.proc_decls);
+
+    code_seq main_code = code_utils_set_up_program();
+    code_seq_concat(&main_code, gen_code_stmts(&prog.stmts));
+    code_seq_concat(&main_code, code_utils_tear_down_program());
+    code_seq_set_location(main_code, prog.file_loc);
+
+    address_type main_address = code_seq_size(procs);
+    code_seq text = procs;
+    code_seq_concat(&text, main_code);
+    for (call_site *cs = call_sites; cs != NULL; cs = cs->next) {
+	cs->call->instr.jump.addr = proc_address(cs->callee);
+    }
+
+    BOFHeader bh;
+    bof_write_magic_to_header(&bh);
+    bh.text_start_address = main_address;
+    bh.text_length = code_seq_size(text);
+    bh.data_start_address = (bh.text_length < 1024) ? 1024 : bh.text_length;
+    bh.data_length = global_count + literal_table_size();
+    bh.stack_bottom_addr = bh.data_start_address + bh.data_length
+	+ STACK_SPACE;
+    bof_write_header(bf, bh);
+
+    for (code *c = code_seq_first(text); c != NULL; c = c->next) {
+	instruction_write_bin_instr(bf, c->instr);
+    }
+
+    // the program's constants and variables
+    word_type *globals = calloc(global_count + 1, sizeof(word_type));
+    if (globals == NULL) {
+	bail_with_error("No space for the %u global words!", global_count);
+    }
+    // (the declarations' offset_counts number them in order)
+    unsigned int ofst = 0;
+    for (const_decl_t *cd = prog.const_decls.start; cd != NULL;
+	 cd = cd->next) {
+	for (const_def_t *def = cd->const_def_list.start; def != NULL;
+	     def = def->next) {
+	    globals[ofst++] = def->number.value;
+	}
+    }
+    for (unsigned int i = 0; i < global_count; i++) {
+	bof_write_word(bf, globals[i]);
+    }
+    free(globals);
+
+    literal_table_start_iteration();
+    while (literal_table_iteration_has_next()) {
+	bof_write_word(bf, literal_table_iteration_next());
+    }
+    literal_table_end_iteration();
+
+    code_seq_write_line_table(bf, text);
+    gen_code_symbols(bf, prog, main_address, bh.data_start_address);
+}
+
+// Generate code for the block blk, which is not the program's
+// (so it has its own activation record, and expects the static link
+// for it in register $r3)
+code_seq gen_code_block(block_t *blk)
 {
     /* design:
-       [code to make space for the static link, INC 1]
-       [code to allocate space for all the vars declared.]
-       [code for the statement]
-       HLT
+       SRI $sp, n          # space for its n constants and variables
+       [initialize each]
+       [save registers, making $fp point to the AR]
+       [code for its statements]
+       [restore registers]
+       ARI $sp, n
      */
-    code_seq ret = code_seq_singleton(code_inc(BLOCK_LINKS_SIZE));
-    ret = code_seq_concat(ret, gen_code_varDecls(prog->data.program.vds));
-    ret = code_seq_concat(ret, gen_code_stmt(prog->data.program.stmt));
-    ret = code_seq_add_to_end(ret, code_hlt());
+    nesting_level++;
+    unsigned int n = block_loc_count(blk);
+    gen_code_proc_decls(blk->proc_decls);
+
+    code_seq ret = code_utils_allocate_stack_space(n);
+    // (the declarations' offset_counts number them in order)
+    unsigned int ofst = 0;
+    for (const_decl_t *cd = blk->const_decls.start; cd != NULL;
+	 cd = cd->next) {
+	for (const_def_t *def = cd->const_def_list.start; def != NULL;
+	     def = def->next) {
+	    code_seq_add_to_end(&ret, code_cpw(SP, ofst++,
+					       GP, literal_offset(def->number)));
+	}
+    }
+    for (var_decl_t *vd = blk->var_decls.var_decls; vd != NULL;
+	 vd = vd->next) {
+	for (ident_t *id = vd->ident_list.start; id != NULL; id = id->next) {
+	    code_seq_add_to_end(&ret, code_lit(SP, ofst++, 0));
+	}
+    }
+    code_seq_concat(&ret, code_utils_save_registers_for_AR());
+    code_seq_concat(&ret, gen_code_stmts(&blk->stmts));
+    code_seq_concat(&ret, code_utils_restore_registers_from_AR());
+    code_seq_concat(&ret, code_utils_deallocate_stack_space(n));
+    code_seq_set_location(ret, blk->file_loc);
+    nesting_level--;
     return ret;
 }
 
-// generate code for the declarations in vds
-code_seq gen_code_varDecls(AST_list vds)
+// Generate code for the procedures declared in pds,
+// adding it to the end of the procedures' code
+void gen_code_proc_decls(proc_decls_t pds)
 {
-    code_seq ret = code_seq_empty();
-    while (!ast_list_is_empty(vds)) {
-	ret = code_seq_concat(ret,
-			      gen_code_varDecl(ast_list_first(vds)));
-	vds = ast_list_rest(vds);
+    for (proc_decl_t *pd = pds.proc_decls; pd != NULL; pd = pd->next) {
+	gen_code_proc_decl(pd);
     }
-    return ret;
 }
 
-// generate code for the var declaration vd
-code_seq gen_code_varDecl(AST *vd)
+// Generate code for the procedure pd,
+// adding it to the end of the procedures' code
+void gen_code_proc_decl(proc_decl_t *pd)
 {
-    return code_seq_singleton(code_inc(1));
+    assert(pd->attrs != NULL);
+    code_seq body = gen_code_block(pd->block);
+    code_seq_add_to_end(&body, code_rtn());
+    code_seq_set_location(body, pd->file_loc);
+
+    proc_entry *pe = (proc_entry *) malloc(sizeof(proc_entry));
+    if (pe == NULL) {
+	bail_with_error("No space to record procedure %s!", pd->name);
+    }
+    pe->name = pd->name;
+    pe->attrs = pd->attrs;
+    pe->address = code_seq_size(procs);
+    pe->next = proc_entries;
+    proc_entries = pe;
+    proc_count++;
+    code_seq_concat(&procs, body);
+}
+
+// Generate code for the statements in stmts
+code_seq gen_code_stmts(stmts_t *stmts)
+{
+    code_seq ret = code_seq_empty();
+    if (stmts->stmts_kind == empty_stmts_e) {
+	return ret;
+    }
+    for (stmt_t *s = stmts->stmt_list.start; s != NULL; s = s->next) {
+	code_seq_concat(&ret, gen_code_stmt(s));
+    }
+    return ret;
 }
 
-// generate code for the statement
-code_seq gen_code_stmt(AST *stmt)
+// Generate code for the statement s
+code_seq gen_code_stmt(stmt_t *s)
 {
-    switch (stmt->type_tag) {
-    case assign_ast:
-	return gen_code_assignStmt(stmt);
+    code_seq ret = code_seq_empty();
+    switch (s->stmt_kind) {
+    case assign_stmt:
+	ret = gen_code_assign_stmt(s->data.assign_stmt);
+	break;
+    case call_stmt:
+	ret = gen_code_call_stmt(s->data.call_stmt);
 	break;
-    case begin_ast:
-	return gen_code_beginStmt(stmt);
+    case if_stmt:
+	ret = gen_code_if_stmt(s->data.if_stmt);
 	break;
-    case if_ast:
-	return gen_code_ifStmt(stmt);
+    case while_stmt:
+	ret = gen_code_while_stmt(s->data.while_stmt);
 	break;
-    case read_ast:
-	return gen_code_readStmt(stmt);
+    case read_stmt:
+	ret = gen_code_read_stmt(s->data.read_stmt);
 	break;
-    case write_ast:
-	return gen_code_writeStmt(stmt);
+    case print_stmt:
+	ret = gen_code_print_stmt(s->data.print_stmt);
+	break;
+    case block_stmt:
+	ret = gen_code_block_stmt(s->data.block_stmt);
 	break;
     default:
-	bail_with_error("Bad AST passed to gen_code_stmt!");
-	// The following should never execute
-	return code_seq_empty();
+	bail_with_error("Call to gen_code_stmt with an AST that is not a statement!");
+	break;
     }
+    code_seq_set_location(ret, s->file_loc);
+    return ret;
 }
 
-// generate code for the statement
-code_seq gen_code_assignStmt(AST *stmt)
+// Generate code for the assignment statement s
+code_seq gen_code_assign_stmt(assign_stmt_t s)
 {
-    /* design of code seq:
-       [get fp for the variable on top of stack]
-       [get value of expression on top of stack]
-       STO([offset for the variable])
-     */
-    unsigned int outLevels
-	= stmt->data.assign_stmt.ident->data.ident.idu->levelsOutward;
-    code_seq ret = code_compute_fp(outLevels);
-    ret = code_seq_concat(ret,
-			  gen_code_expr(stmt->data.assign_stmt.exp));
-    unsigned int ofst
-	= stmt->data.assign_stmt.ident->data.ident.idu->attrs->loc_offset;
-    ret = code_seq_add_to_end(ret, code_sto(ofst));
+    code_seq ret = gen_code_expr(*s.expr);
+    reg_num_type base;
+    code_seq_concat(&ret, gen_code_base(s.idu, &base));
+    code_seq_add_to_end(&ret, code_cpw(base, id_use_get_attrs(s.idu)->offset_count,
+				       SP, 0));
+    code_seq_concat(&ret, code_utils_deallocate_stack_space(1));
     return ret;
 }
 
-// generate code for the statement
-code_seq gen_code_beginStmt(AST *stmt)
+// Generate code for the call statement s
+code_seq gen_code_call_stmt(call_stmt_t s)
 {
-    /* design of code_seq
-        [save old BP on stack, PBP]
-	[adjust the BP]
-        [allocate variables declared]
-	[concatenated code for each stmt]
-	[if there are variables, pop them off the stack]
-        [RBP]
-     */
-    // save the static link (surronging scope's BP) on stack
-    code_seq ret = code_seq_singleton(code_pbp());
-    // set the BP to SP-1
-    ret = code_seq_add_to_end(ret, code_psp());
-    ret = code_seq_add_to_end(ret, code_lit(1));
-    ret = code_seq_add_to_end(ret, code_sub());
-    ret = code_seq_add_to_end(ret, code_rbp());
-    // allocate any declared variables
-    AST_list vds = stmt->data.begin_stmt.vds;
-    int num_vds = ast_list_size(vds);
-    ret = code_seq_concat(ret, gen_code_varDecls(vds));
-    // add code for all the statements
-    AST_list stmts = stmt->data.begin_stmt.stmts;
-    while (!ast_list_is_empty(stmts)) {
-	ret = code_seq_concat(ret, gen_code_stmt(ast_list_first(stmts)));
-	stmts = ast_list_rest(stmts);
+    // the static link is the $fp of the block that declares the procedure
+    code_seq ret = code_utils_compute_fp(3, s.idu->levelsOutward);
+    code *call = code_call(0);
+    call_site *cs = (call_site *) malloc(sizeof(call_site));
+    if (cs == NULL) {
+	bail_with_error("No space to record a call of %s!", s.name);
     }
-    if (num_vds > 0) {
-	// if there are variables, trim the variables
-	ret = code_seq_add_to_end(ret, code_inc(- num_vds));
-    }
-    // restore the old BP
-    ret = code_seq_add_to_end(ret, code_rbp());
+    cs->call = call;
+    cs->callee = id_use_get_attrs(s.idu);
+    cs->next = call_sites;
+    call_sites = cs;
+    code_seq_add_to_end(&ret, call);
     return ret;
 }
 
-// generate code for the statement
-code_seq gen_code_ifStmt(AST *stmt)
+// Generate code for the if statement s
+code_seq gen_code_if_stmt(if_stmt_t s)
 {
     /* design:
-        [code for pushing the condition on top of stack]
-	JPC 2
-        JMP [around the body]
-        [code for the body]
+       [condition]         # branches to T if true
+       ARI $sp, 2
+       JREL E              # (or to after the then part, with no else)
+    T: ARI $sp, 2
+       [then part]
+       JREL D              # (only with an else part)
+    E: [else part]
+    D:
      */
-    code_seq condc = gen_code_expr(stmt->data.if_stmt.exp);
-    code_seq bodyc = gen_code_stmt(stmt->data.if_stmt.stmt);
-    code_seq ret = code_seq_add_to_end(condc, code_jpc(2));
-    ret = code_seq_add_to_end(ret, code_jmp(code_seq_size(bodyc)+1));
-    ret = code_seq_concat(ret, bodyc);
+    code_seq then_code = gen_code_stmts(s.then_stmts);
+    code_seq else_code = code_seq_empty();
+    if (s.else_stmts != NULL) {
+	else_code = gen_code_stmts(s.else_stmts);
+	code_seq_add_to_end(&then_code,
+			    code_jrel(code_seq_size(else_code) + 1));
+    }
+    code_seq ret = gen_code_condition(s.condition);
+    code_seq_concat(&ret, code_utils_deallocate_stack_space(2));
+    code_seq_add_to_end(&ret, code_jrel(code_seq_size(then_code) + 2));
+    code_seq_concat(&ret, code_utils_deallocate_stack_space(2));
+    code_seq_concat(&ret, then_code);
+    code_seq_concat(&ret, else_code);
     return ret;
 }
 
-// generate code for the statement
-code_seq gen_code_readStmt(AST *stmt)
+// Generate code for the while statement s
+code_seq gen_code_while_stmt(while_stmt_t s)
 {
     /* design:
-       [code to put the fp for the variable on top of stack]
-       CHI
-       STO [(variable offset)]
+    W: [condition]         # branches to T if true
+       ARI $sp, 2
+       JREL D
+    T: ARI $sp, 2
+       [body]
+       JREL W
+    D:
      */
-    id_use *idu = stmt->data.read_stmt.ident->data.ident.idu;
-    code_seq ret = code_compute_fp(idu->levelsOutward);
-    ret = code_seq_add_to_end(ret, code_chi());
-    ret = code_seq_add_to_end(ret, code_sto(idu->attrs->loc_offset));
+    code_seq body = gen_code_stmts(s.body);
+    code_seq ret = gen_code_condition(s.condition);
+    unsigned int cond_size = code_seq_size(ret);
+    unsigned int body_size = code_seq_size(body);
+    code_seq_concat(&ret, code_utils_deallocate_stack_space(2));
+    code_seq_add_to_end(&ret, code_jrel(body_size + 3));
+    code_seq_concat(&ret, code_utils_deallocate_stack_space(2));
+    code_seq_concat(&ret, body);
+    code_seq_add_to_end(&ret, code_jrel(-(int) (cond_size + 3 + body_size)));
     return ret;
 }
 
-// generate code for the statement
-code_seq gen_code_writeStmt(AST *stmt)
+// Generate code for the read statement s
+code_seq gen_code_read_stmt(read_stmt_t s)
 {
-    /* design:
-       [code to put the exp's value on top of stack
-       CHO
-     */
-    code_seq ret = gen_code_expr(stmt->data.write_stmt.exp);
-    return code_seq_add_to_end(ret, code_cho());
+    reg_num_type base;
+    code_seq ret = gen_code_base(s.idu, &base);
+    code_seq_add_to_end(&ret, code_rch(base, id_use_get_attrs(s.idu)->offset_count));
+    return ret;
 }
 
-// generate code for the expresion
-code_seq gen_code_expr(AST *exp)
+// Generate code for the print statement s
+code_seq gen_code_print_stmt(print_stmt_t s)
 {
-    switch (exp->type_tag) {
-    case number_ast:
-	return gen_code_number_expr(exp);
-	break;
-    case ident_ast:
-	return gen_code_ident_expr(exp);
-	break;
-    case bin_expr_ast:
-	return gen_code_bin_expr(exp);
+    code_seq ret = gen_code_expr(s.expr);
+    code_seq_add_to_end(&ret, code_pint(SP, 0));
+    code_seq_concat(&ret, code_utils_deallocate_stack_space(1));
+    return ret;
+}
+
+// Generate code for the block statement s
+code_seq gen_code_block_stmt(block_stmt_t s)
+{
+    // the static link is the $fp of the surrounding block
+    code_seq ret = code_utils_copy_regs(3, FP);
+    code_seq_concat(&ret, gen_code_block(s.block));
+    return ret;
+}
+
+// Generate code for the condition c, which pushes two words on the stack
+// and then branches (forward) over the next 3 instructions if c is true
+code_seq gen_code_condition(condition_t c)
+{
+    code_seq ret = code_seq_empty();
+    switch (c.cond_kind) {
+    case ck_db:
+	ret = gen_code_db_condition(c.data.db_cond);
 	break;
-    case not_expr_ast:
-	return gen_code_not_expr(exp);
+    case ck_rel:
+	ret = gen_code_rel_op_condition(c.data.rel_op_cond);
 	break;
     default:
-	bail_with_error("gen_code_expr passed bad AST!");
-	// The following should never execute
-	return code_seq_empty();
+	bail_with_error("Call to gen_code_condition with an AST that is not a condition!");
 	break;
     }
+    code_seq_set_location(ret, c.file_loc);
+    return ret;
 }
 
-// generate code for the expression (exp)
-code_seq gen_code_bin_expr(AST *exp)
+// Generate code for the divisibility condition c, as gen_code_condition
+code_seq gen_code_db_condition(db_condition_t c)
 {
-    /* design:
-        [code to push left exp's value on top of stack]
-	[code to push right exp's value on top of stack]
-	[instruction that implements the operation op]
-    */
-    code_seq ret = gen_code_expr(exp->data.bin_expr.leftexp);
-    ret = code_seq_concat(ret, gen_code_expr(exp->data.bin_expr.rightexp));
-    switch (exp->data.bin_expr.op) {
-    case eqeqop:
-	return code_seq_add_to_end(ret, code_eql());
+    code_seq ret = gen_code_expr(c.divisor);
+    code_seq_concat(&ret, gen_code_expr(c.dividend));
+    code_seq_add_to_end(&ret, code_div(SP, 1));
+    code_seq_add_to_end(&ret, code_cfhi(SP, 1));
+    code_seq_add_to_end(&ret, code_lit(SP, 0, 0));
+    code_seq_add_to_end(&ret, code_beq(SP, 1, 3));
+    return ret;
+}
+
+// Generate code for the relational condition c, as gen_code_condition
+code_seq gen_code_rel_op_condition(rel_op_condition_t c)
+{
+    code_seq ret = gen_code_expr(c.expr2);
+    code_seq_concat(&ret, gen_code_expr(c.expr1));
+    switch (c.rel_op.code) {
+    case eqeqsym:
+	code_seq_add_to_end(&ret, code_beq(SP, 1, 3));
+	return ret;
+    case neqsym:
+	code_seq_add_to_end(&ret, code_bne(SP, 1, 3));
+	return ret;
+    default:
 	break;
-    case neqop:
-	return code_seq_add_to_end(ret, code_neq());
+    }
+    // compare the difference of the two with 0
+    code_seq_add_to_end(&ret, code_sub(SP, 1, SP, 1));
+    switch (c.rel_op.code) {
+    case ltsym:
+	code_seq_add_to_end(&ret, code_bltz(SP, 1, 3));
 	break;
-    case ltop:
-	return code_seq_add_to_end(ret, code_lss());
+    case leqsym:
+	code_seq_add_to_end(&ret, code_blez(SP, 1, 3));
 	break;
-    case leqop:
-	return code_seq_add_to_end(ret, code_leq());
+    case gtsym:
+	code_seq_add_to_end(&ret, code_bgtz(SP, 1, 3));
 	break;
-    case plusop:
-	return code_seq_add_to_end(ret, code_add());
+    case geqsym:
+	code_seq_add_to_end(&ret, code_bgez(SP, 1, 3));
 	break;
-    case minusop:
-	return code_seq_add_to_end(ret, code_sub());
+    default:
+	bail_with_error("Unknown relational operator (%d) in gen_code_rel_op_condition",
+			c.rel_op.code);
 	break;
-    case multop:
-	return code_seq_add_to_end(ret, code_mul());
+    }
+    return ret;
+}
+
+// Generate code to push the value of the expression e on the stack
+code_seq gen_code_expr(expr_t e)
+{
+    code_seq ret = code_seq_empty();
+    switch (e.expr_kind) {
+    case expr_bin:
+	ret = gen_code_binary_op_expr(e.data.binary);
+	break;
+    case expr_negated:
+	ret = gen_code_expr(*e.data.negated.expr);
+	code_seq_add_to_end(&ret, code_neg(SP, 0, SP, 0));
 	break;
-    case divop:
-	return code_seq_add_to_end(ret, code_div());
+    case expr_ident:
+	ret = gen_code_ident(e.data.ident);
+	break;
+    case expr_number:
+	ret = gen_code_number(e.data.number);
 	break;
     default:
-	bail_with_error("gen_code_bin_expr passed AST with bad op!");
-	// The following should never execute
-	return code_seq_empty();
+	bail_with_error("Unexpected expr_kind_e (%d) in gen_code_expr",
+			e.expr_kind);
+	break;
     }
+    code_seq_set_location(ret, e.file_loc);
+    return ret;
 }
 
-// generate code for the logical not expression (!)
-code_seq gen_code_not_expr(AST *exp)
+// Generate code to push the value of the binary expression e on the stack
+code_seq gen_code_binary_op_expr(binary_op_expr_t e)
 {
-    /* design:
-       LIT 1
-       [code to put subexpression's value on top of stack]
-       SUB
-       RND
-     */
-    code_seq ret = code_seq_singleton(code_lit(1));
-    ret = code_seq_concat(ret, gen_code_expr(exp->data.not_expr.exp));
-    ret = code_seq_add_to_end(ret, code_sub());
-    return code_seq_add_to_end(ret, code_rnd());
+    // the first operand ends up on top, over the second
+    code_seq ret = gen_code_expr(*e.expr2);
+    code_seq_concat(&ret, gen_code_expr(*e.expr1));
+    switch (e.arith_op.code) {
+    case plussym:
+	code_seq_add_to_end(&ret, code_add(SP, 1, SP, 1));
+	break;
+    case minussym:
+	code_seq_add_to_end(&ret, code_sub(SP, 1, SP, 1));
+	break;
+    case multsym:
+	code_seq_add_to_end(&ret, code_mul(SP, 1));
+	code_seq_add_to_end(&ret, code_cflo(SP, 1));
+	break;
+    case divsym:
+	code_seq_add_to_end(&ret, code_div(SP, 1));
+	code_seq_add_to_end(&ret, code_cflo(SP, 1));
+	break;
+    default:
+	bail_with_error("Unknown arithmetic operator (%d) in gen_code_binary_op_expr",
+			e.arith_op.code);
+	break;
+    }
+    code_seq_concat(&ret, code_utils_deallocate_stack_space(1));
+    return ret;
 }
 
-// generate code for the ident expression (ident)
-code_seq gen_code_ident_expr(AST *ident)
+// Generate code to push the value of the identifier id on the stack
+code_seq gen_code_ident(ident_t id)
 {
-    /* design:
-       [code to load fp for the variable]
-       LOD [offset for the variable]
-     */
-    id_use *idu = ident->data.ident.idu;
-    lexical_address *la = lexical_address_create(idu->levelsOutward,
-						 idu->attrs->loc_offset);
-    return code_load_from_lexical_address(la);
+    reg_num_type base;
+    code_seq ret = gen_code_base(id.idu, &base);
+    code_seq_concat(&ret, code_utils_allocate_stack_space(1));
+    code_seq_add_to_end(&ret, code_cpw(SP, 0, base,
+				       id_use_get_attrs(id.idu)->offset_count));
+    return ret;
 }
 
-// generate code for the number expression (num)
-code_seq gen_code_number_expr(AST *num)
+// Generate code to push the value of the number n on the stack
+code_seq gen_code_number(number_t n)
 {
-    return code_seq_singleton(code_lit(word2float(num->data.number.value)));
+    code_seq ret = code_utils_allocate_stack_space(1);
+    code_seq_add_to_end(&ret, code_cpw(SP, 0, GP, literal_offset(n)));
+    return ret;
 }
@@ -0,0 +1,79 @@
+/* $Id$ */
+#ifndef _GEN_CODE_H
+#define _GEN_CODE_H
+#include <stdio.h>
+#include "ast.h"
+#include "bof.h"
+#include "machine_types.h"
+#include "code_seq.h"
+
+// Initialize the code generator
+extern void gen_code_initialize();
+
+// Requires: bf is open for writing
+// Generate code for prog into bf
+extern void gen_code_program(BOFFILE bf, block_t prog);
+
+// Generate code for the block blk, which is not the program's
+// (so it has its own activation record, and expects the static link
+// for it in register $r3)
+extern code_seq gen_code_block(block_t *blk);
+
+// Generate code for the procedures declared in pds,
+// adding it to the end of the procedures' code
+extern void gen_code_proc_decls(proc_decls_t pds);
+
+// Generate code for the procedure pd,
+// adding it to the end of the procedures' code
+extern void gen_code_proc_decl(proc_decl_t *pd);
+
+// Generate code for the statements in stmts
+extern code_seq gen_code_stmts(stmts_t *stmts);
+
+// Generate code for the statement s
+extern code_seq gen_code_stmt(stmt_t *s);
+
+// Generate code for the assignment statement s
+extern code_seq gen_code_assign_stmt(assign_stmt_t s);
+
+// Generate code for the call statement s
+extern code_seq gen_code_call_stmt(call_stmt_t s);
+
+// Generate code for the if statement s
+extern code_seq gen_code_if_stmt(if_stmt_t s);
+
+// Generate code for the while statement s
+extern code_seq gen_code_while_stmt(while_stmt_t s);
+
+// Generate code for the read statement s
+extern code_seq gen_code_read_stmt(read_stmt_t s);
+
+// Generate code for the print statement s
+extern code_seq gen_code_print_stmt(print_stmt_t s);
+
+// Generate code for the block statement s
+extern code_seq gen_code_block_stmt(block_stmt_t s);
+
+// Generate code for the condition c, which pushes two words on the stack
+// and then branches (forward) over the next 3 instructions if c is true
+extern code_seq gen_code_condition(condition_t c);
+
+// Generate code for the divisibility condition c, as gen_code_condition
+extern code_seq gen_code_db_condition(db_condition_t c);
+
+// Generate code for the relational condition c, as gen_code_condition
+extern code_seq gen_code_rel_op_condition(rel_op_condition_t c);
+
+// Generate code to push the value of the expression e on the stack
+extern code_seq gen_code_expr(expr_t e);
+
+// Generate code to push the value of the binary expression e on the stack
+extern code_seq gen_code_binary_op_expr(binary_op_expr_t e);
+
+// Generate code to push the value of the identifier id on the stack
+extern code_seq gen_code_ident(ident_t id);
+
+// Generate code to push the value of the number n on the stack
+extern code_seq gen_code_number(number_t n);
+
+#endif
@@ -50,7 +50,7 @@ instr_type instruction_type(bin_instr_t i) {
 bin_instr_t instruction_read(BOFFILE bf)
 {
     bin_instr_t bi;
-    size_t rd = fread(&bi, sizeof(bi), 1, bf.fileptr);
+    size_t rd = bof_read_bytes(bf, sizeof(bi), &bi) / sizeof(bi);
     if (rd != 1) {
 	bail_with_error("Cannot read instruction from %s (read %d instrs)",
 			bf.filename, rd);
@@ -63,10 +63,7 @@ bin_instr_t instruction_read(BOFFILE bf)
 // but exit with an error if there is a problem.
 static void write_bin_instr(BOFFILE bf, bin_instr_t i)
 {
-    size_t wr = fwrite(&i, sizeof(i), 1, bf.fileptr);
-    if (wr != 1) {
-	bail_with_error("Cannot write binary instr to %s", bf.filename);
-    }
+    bof_write_bytes(bf, sizeof(i), &i);
 }
 
 // Requires: bof is open for writing in binary
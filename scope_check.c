@@ -140,11 +140,13 @@ void scope_check_procDecls(proc_decls_t *pds)
 // check the procedure declaration pd
 // and add it to the current scope's symbol table
 // or produce an error if its name has already been declared
-// Modifies the given AST to have appropriate id_use pointers.
+// Modifies the given AST to have appropriate id_use pointers,
+// and pd to have (a pointer to) its attributes.
 void scope_check_procDecl(proc_decl_t *pd)
 {
     // add name to scope first, so that the procedure can be recursive
     add_ident_to_scope(pd->name, procedure_idk, *(pd->file_loc));
+    pd->attrs = id_use_get_attrs(symtab_lookup(pd->name));
     scope_check_block(pd->block);
 }
 
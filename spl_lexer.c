@@ -990,7 +990,7 @@ YY_RULE_SETUP
 case 13:
 YY_RULE_SETUP
 #line 132 "spl_lexer.l"
-{ tok2ast(eqsym); return eqeqsym; }
+{ tok2ast(eqeqsym); return eqeqsym; }
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
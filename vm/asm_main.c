@@ -41,11 +41,15 @@ char * cmdname;
 static const char *typicalFile = "file.asm";
 
 void usage() {
-    bail_with_error("Usage: %s %s\n       %s %s %s\n       %s %s %s\n       %s %s %s",
+    bail_with_error("Usage: %s %s\n       %s %s %s\n       %s %s %s\n       %s %s %s\n       %s %s %s\n%s\n%s\n%s",
 		    cmdname, typicalFile,
+		    cmdname, "[-2 | -z]", typicalFile,
 		    cmdname, "-l", typicalFile,
 		    cmdname, "-u", typicalFile,
-		    cmdname, "-s", typicalFile);
+		    cmdname, "-s", typicalFile,
+		    "where -2 writes version 2 of the binary object file format",
+		    "(with a line table, and the labels and data names as symbols),",
+		    "and -z writes version 2 with compressed sections");
     exit(EXIT_FAILURE);
 }
 
@@ -58,12 +62,15 @@ int main(int argc, char *argv[]) {
     bool parser_unparse = false;
     // should the symbol table be printed after pass 1?
     bool symbol_table_print = false;
+    // should version 2 of the BOF format be written (compressed)?
+    bool bof_version2 = false;
+    bool bof_compress = false;
 
     cmdname = argv[0];
     argc--;
     argv++;
 
-    // possible options: -l, -u, and -s
+    // possible options: -l, -u, -s, -2, and -z
     while (argc > 0 && strlen(argv[0]) >= 2 && argv[0][0] == '-') {
 	if (strcmp(argv[0],"-l") == 0) {
 	    lexer_print_output = true;
@@ -77,6 +84,15 @@ int main(int argc, char *argv[]) {
 	    symbol_table_print = true;
 	    argc--;
 	    argv++;
+	} else if (strcmp(argv[0],"-2") == 0) {
+	    bof_version2 = true;
+	    argc--;
+	    argv++;
+	} else if (strcmp(argv[0],"-z") == 0) {
+	    bof_version2 = true;
+	    bof_compress = true;
+	    argc--;
+	    argv++;
 	} else {
 	    // bad option!
 	    usage();
@@ -138,7 +154,8 @@ int main(int argc, char *argv[]) {
     char *bfn = strdup(file_name);
     change_to_bof_ext(bfn);
     
-    BOFFILE bf = bof_write_open(bfn);
+    BOFFILE bf = bof_version2 ? bof_write_open2(bfn, bof_compress)
+	: bof_write_open(bfn);
 
     // generate code from the ASTs
     assembleProgram(bf, progast);
@@ -44,6 +44,83 @@ void assembleProgram(BOFFILE bf, ast_program_t prog)
     assembleTextSection(bf, prog.textSection);
     assembleDataSection(bf, prog.dataSection);
     // nothing to do for the stack section, as it's all in the header
+    assembleLineTable(bf, prog.textSection.instrs);
+    assembleSymbols(bf, bh.data_start_address);
+}
+
+// Add a line table to bf (as a bof_lines_section, see bof.h, which is
+// only written in version 2 of the format), giving the line of the source
+// file that each instruction in instrs came from
+void assembleLineTable(BOFFILE bf, ast_asm_instrs_t instrs)
+{
+    if (instrs.instrs == NULL) {
+	return;
+    }
+    // all the instructions come from the file being assembled
+    const char *filename = instrs.instrs->file_loc->filename;
+    size_t name_size = strlen(filename) + 1;
+    unsigned int count = ast_list_length(instrs.instrs);
+    BOFLineEntry *entries = malloc(count * sizeof(BOFLineEntry));
+    if (entries == NULL) {
+	bail_with_error("Not enough space for a line table of %u entries!",
+			count);
+    }
+    uword_type n = 0;
+    address_type addr = 0;
+    for (ast_asm_instr_t *ip = instrs.instrs; ip != NULL; ip = ip->next) {
+	unsigned int line = ip->file_loc->line;
+	if (n == 0 || entries[n - 1].line != line) {
+	    entries[n].start = addr;
+	    entries[n].line = line;
+	    entries[n].file = 0;
+	    n++;
+	}
+	addr++;
+    }
+    size_t bytes = sizeof(n) + n * sizeof(BOFLineEntry) + name_size;
+    unsigned char *section = malloc(bytes);
+    if (section == NULL) {
+	bail_with_error("Not enough space for a line table of %u entries!",
+			count);
+    }
+    memcpy(section, &n, sizeof(n));
+    memcpy(section + sizeof(n), entries, n * sizeof(BOFLineEntry));
+    memcpy(section + sizeof(n) + n * sizeof(BOFLineEntry), filename,
+	   name_size);
+    bof_write_section(bf, bof_lines_section, bytes, section);
+    free(section);
+    free(entries);
+}
+
+// Add the labels and data names in the symbol table to bf
+// (as a symbols section, which is only written in version 2 of the
+// format), giving each data name the address of its word in the
+// data section, which starts at data_start
+void assembleSymbols(BOFFILE bf, address_type data_start)
+{
+    unsigned int count = symtab_size();
+    // (at least 1, so malloc does not return NULL)
+    bof_symbol_t *symbols = malloc((count + 1) * sizeof(bof_symbol_t));
+    if (symbols == NULL) {
+	bail_with_error("Not enough space for the %u symbols!", count);
+    }
+    unsigned int i = 0;
+    const char *name = symtab_first_name();
+    while (i < count && symtab_more_after(name)) {
+	id_attrs_assoc *assoc = symtab_lookup(name);
+	symbols[i].name = assoc->name;
+	if (assoc->kind == id_label) {
+	    symbols[i].kind = bof_label_symbol;
+	    symbols[i].addr = assoc->addr;
+	} else {
+	    symbols[i].kind = bof_data_symbol;
+	    symbols[i].addr = data_start + assoc->addr;
+	}
+	i++;
+	name = symtab_next_name(name);
+    }
+    bof_write_symbols(bf, symbols, i);
+    free(symbols);
 }
 
 // Assemble the code for the given AST, with output going to bf
@@ -8,6 +8,14 @@
 // Generate code for prog, with output going to bf
 extern void assembleProgram(BOFFILE bf, ast_program_t prog);
 
+// Add a line table to bf, giving the source line of each instruction
+// in instrs (which does nothing unless bf is in version 2)
+extern void assembleLineTable(BOFFILE bf, ast_asm_instrs_t instrs);
+
+// Add the symbol table's names to bf, with the data names' addresses
+// relative to data_start (which does nothing unless bf is in version 2)
+extern void assembleSymbols(BOFFILE bf, address_type data_start);
+
 // Generate code for the given AST, with output going to bf
 extern void assembleTextSection(BOFFILE bf, ast_text_section_t ts);
 
@@ -106,6 +106,7 @@ ast_asm_instrs_t ast_asm_instrs_singleton(ast_asm_instr_t asminstr)
     *p = asminstr;
     p->next = NULL;
     ret.instrs = p;
+    ret.last = p;
     return ret;
 }
 
@@ -120,12 +121,12 @@ ast_asm_instrs_t ast_asm_instrs_add(ast_asm_instrs_t lst, ast_asm_instr_t asmins
     *p = asminstr;
     p->next = NULL;
     // splice p onto the end of lst.instrs
-    ast_asm_instr_t *last = ast_last_list_elem(lst.instrs);
-    if (last == NULL) {
+    if (lst.instrs == NULL) {
 	ret.instrs = p;
     } else {
-	last->next = p;
+	lst.last->next = p;
     }
+    ret.last = p;
     return ret;
 }
 
@@ -303,6 +304,7 @@ ast_static_decls_t ast_static_decls_empty(ast_empty_t e)
     ret.file_loc = file_location_copy(e.file_loc);
     ret.type_tag = static_decls_ast;
     ret.decls = NULL;
+    ret.last = NULL;
     return ret;
 }
 
@@ -319,12 +321,12 @@ ast_static_decls_t ast_static_decls_add(ast_static_decls_t sds,
     *p = sd;
     p->next = NULL;
     // splice p onto the end of sds.decls
-    ast_static_decl_t *last = ast_last_list_elem(sds.decls);
-    if (last == NULL) {
+    if (sds.decls == NULL) {
 	ret.decls = p;
     } else {
-	last->next = p;
+	sds.last->next = p;
     }
+    ret.last = p;
     return ret;
 }
 
@@ -168,6 +168,8 @@ typedef struct {
     file_location *file_loc;
     AST_type type_tag;
     ast_asm_instr_t *instrs;
+    // the last element of instrs (so adding to the end takes constant time)
+    ast_asm_instr_t *last;
 } ast_asm_instrs_t;
 
 // initializer kinds
@@ -202,6 +204,8 @@ typedef struct {
     file_location *file_loc;
     AST_type type_tag;
     ast_static_decl_t *decls;
+    // the last element of decls (so adding to the end takes constant time)
+    ast_static_decl_t *last;
 } ast_static_decls_t;
 
 // text-section ::= entry-point asmInstr*
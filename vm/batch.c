@@ -0,0 +1,399 @@
+/* $Id$ */
+// clock_gettime and strdup are only declared for -std=c17
+// with _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "batch.h"
+#include "bof.h"
+#include "utilities.h"
+
+// the longest line in a job file
+#define BATCH_LINE_SIZE 4096
+
+// the most snapshots a worker keeps (each has an open image file)
+#define BATCH_SNAPSHOTS 8
+
+// A program a worker has loaded, and the snapshot of it taken after loading
+typedef struct {
+    const char *bof_name;
+    machine_snapshot_t *snapshot;
+} batch_snapshot_t;
+
+// A worker's queue of jobs, as the indexes (in the batch's array)
+// of the jobs jobs[front] .. jobs[back-1].
+// Its owner takes jobs from the back and thieves take them from the front.
+typedef struct {
+    pthread_mutex_t lock;
+    unsigned int *jobs;
+    unsigned int front;
+    unsigned int back;
+} batch_queue_t;
+
+struct batch_pool_s;
+
+// A worker thread, with its own queue and machine
+// (and, if the batch uses snapshots, the snapshots of the first
+// BATCH_SNAPSHOTS programs it loaded)
+typedef struct {
+    struct batch_pool_s *pool;
+    unsigned int id;
+    pthread_t thread;
+    batch_queue_t queue;
+    unsigned long steals;
+    batch_snapshot_t snapshots[BATCH_SNAPSHOTS];
+    unsigned int num_snapshots;
+    unsigned long restores;
+} batch_worker_t;
+
+// The workers running a batch of jobs
+typedef struct batch_pool_s {
+    batch_job_t *jobs;
+    const batch_options_t *opts;
+    batch_worker_t *workers;
+} batch_pool_t;
+
+// Return a copy of s (allocated with malloc),
+// exiting with an error message if there is no space for it
+static char *copy_string(const char *s)
+{
+    char *ret = strdup(s);
+    if (ret == NULL) {
+	bail_with_error("Cannot allocate space for the name %s!", s);
+    }
+    return ret;
+}
+
+// Read the jobs listed in the file named filename, one per line,
+// each of which is the name of a .bof file, optionally followed
+// (after white space) by the name of the file that is its input.
+// Blank lines and lines that start with # are ignored.
+// Return the jobs (allocated with malloc), and set *count to their number.
+// Exit with an error message if the file cannot be read.
+batch_job_t *batch_read_jobs(const char *filename, unsigned int *count)
+{
+    FILE *f = fopen(filename, "r");
+    if (f == NULL) {
+	bail_with_error("Cannot open job file %s!", filename);
+    }
+    unsigned int size = 16;
+    batch_job_t *jobs = malloc(size * sizeof(batch_job_t));
+    if (jobs == NULL) {
+	bail_with_error("Cannot allocate space for the jobs!");
+    }
+    *count = 0;
+    char line[BATCH_LINE_SIZE];
+    unsigned int line_number = 0;
+    while (fgets(line, BATCH_LINE_SIZE, f) != NULL) {
+	line_number++;
+	const char *bof_name = strtok(line, " \t\r\n");
+	if (bof_name == NULL || bof_name[0] == '#') {
+	    continue;
+	}
+	const char *input_name = strtok(NULL, " \t\r\n");
+	if (strtok(NULL, " \t\r\n") != NULL) {
+	    bail_with_error("%s: line %u has more than two file names!",
+			    filename, line_number);
+	}
+	if (*count == size) {
+	    size *= 2;
+	    jobs = realloc(jobs, size * sizeof(batch_job_t));
+	    if (jobs == NULL) {
+		bail_with_error("Cannot allocate space for the jobs!");
+	    }
+	}
+	batch_job_t *j = &jobs[(*count)++];
+	j->bof_name = copy_string(bof_name);
+	j->input_name = input_name == NULL ? NULL : copy_string(input_name);
+	j->exit_code = EXIT_SUCCESS;
+	j->output = NULL;
+	j->output_size = 0;
+    }
+    fclose(f);
+    return jobs;
+}
+
+// Requires: out is a temporary file
+// Set the output of job to the contents of out, and close out
+static void capture_output(batch_job_t *job, FILE *out)
+{
+    long size = ftell(out);
+    if (size < 0) {
+	bail_with_error("Cannot find the size of the output of %s!",
+			job->bof_name);
+    }
+    job->output_size = size;
+    job->output = malloc(job->output_size + 1);
+    if (job->output == NULL) {
+	bail_with_error("Cannot allocate space for the output of %s!",
+			job->bof_name);
+    }
+    rewind(out);
+    if (fread(job->output, 1, job->output_size, out) != job->output_size) {
+	bail_with_error("Cannot read back the output of %s!", job->bof_name);
+    }
+    fclose(out);
+}
+
+// Return the snapshot that w took of the program in the file
+// named bof_name, or NULL if it has none
+static machine_snapshot_t *find_snapshot(batch_worker_t *w,
+					 const char *bof_name)
+{
+    for (unsigned int i = 0; i < w->num_snapshots; i++) {
+	if (strcmp(w->snapshots[i].bof_name, bof_name) == 0) {
+	    return w->snapshots[i].snapshot;
+	}
+    }
+    return NULL;
+}
+
+// Get the machine m of the worker w ready to run job's program:
+// restore it from w's snapshot of the program, if it has one,
+// and otherwise load it (then, if the batch uses snapshots
+// and w has room, take a snapshot of it).
+// Return false (after an error message) if that fails.
+static bool load_job(batch_worker_t *w, machine_t *m, batch_job_t *job)
+{
+    machine_snapshot_t *s = find_snapshot(w, job->bof_name);
+    if (s != NULL) {
+	w->restores++;
+	return machine_restore(m, s);
+    }
+    BOFFILE bf = bof_map_open(job->bof_name);
+    bool loaded = machine_load(m, bf);
+    bof_close(bf);
+    if (loaded && w->pool->opts->snapshots
+	&& w->num_snapshots < BATCH_SNAPSHOTS) {
+	batch_snapshot_t *bs = &w->snapshots[w->num_snapshots++];
+	bs->bof_name = job->bof_name;
+	bs->snapshot = machine_snapshot(m, NULL);
+    }
+    return loaded;
+}
+
+// Run job on the machine m of the worker w,
+// capturing its output (and any error message)
+static void run_job(batch_worker_t *w, machine_t *m, batch_job_t *job)
+{
+    FILE *out = tmpfile();
+    if (out == NULL) {
+	bail_with_error("Cannot create a file for the output of %s!",
+			job->bof_name);
+    }
+    // bof_read_open exits if it cannot open the file,
+    // so report that for just this job
+    FILE *bof = fopen(job->bof_name, "rb");
+    if (bof == NULL) {
+	fprintf(out, "Cannot open %s!\n", job->bof_name);
+	job->exit_code = EXIT_FAILURE;
+	capture_output(job, out);
+	return;
+    }
+    fclose(bof);
+    // a program without an input reads an empty file
+    FILE *in = job->input_name == NULL ? tmpfile()
+	: fopen(job->input_name, "r");
+    if (in == NULL) {
+	fprintf(out, "Cannot open input file %s!\n",
+		job->input_name == NULL ? "(empty)" : job->input_name);
+	job->exit_code = EXIT_FAILURE;
+	capture_output(job, out);
+	return;
+    }
+    machine_set_streams(m, in, out, out);
+    if (load_job(w, m, job)) {
+	job->exit_code = machine_run(m, false);
+    } else {
+	job->exit_code = EXIT_FAILURE;
+    }
+    // the machine must not use the streams after they are closed
+    machine_set_streams(m, NULL, NULL, NULL);
+    fclose(in);
+    fflush(out);
+    capture_output(job, out);
+}
+
+// Take a job from the back of the queue q, putting its index in *job.
+// Return false if q is empty.
+static bool take_back(batch_queue_t *q, unsigned int *job)
+{
+    bool ret = false;
+    pthread_mutex_lock(&q->lock);
+    if (q->front < q->back) {
+	*job = q->jobs[--q->back];
+	ret = true;
+    }
+    pthread_mutex_unlock(&q->lock);
+    return ret;
+}
+
+// Take a job from the front of the queue q, putting its index in *job.
+// Return false if q is empty.
+static bool take_front(batch_queue_t *q, unsigned int *job)
+{
+    bool ret = false;
+    pthread_mutex_lock(&q->lock);
+    if (q->front < q->back) {
+	*job = q->jobs[q->front++];
+	ret = true;
+    }
+    pthread_mutex_unlock(&q->lock);
+    return ret;
+}
+
+// Steal a job for worker w from another worker's queue
+// (trying them in turn, starting with the next worker),
+// putting its index in *job. Return false if every queue is empty
+// (and so the batch is done, as running jobs add no jobs).
+static bool steal(batch_worker_t *w, unsigned int *job)
+{
+    unsigned int threads = w->pool->opts->threads;
+    for (unsigned int i = 1; i < threads; i++) {
+	batch_worker_t *victim = &w->pool->workers[(w->id + i) % threads];
+	if (take_front(&victim->queue, job)) {
+	    w->steals++;
+	    return true;
+	}
+    }
+    return false;
+}
+
+// The body of a worker thread (whose batch_worker_t is arg),
+// which runs jobs on its own machine until there are none left
+static void *work(void *arg)
+{
+    batch_worker_t *w = arg;
+    const batch_options_t *opts = w->pool->opts;
+    machine_t *m = machine_create();
+    machine_set_engine(m, opts->engine);
+    machine_set_fusion(m, opts->fusing);
+    machine_set_memory_size(m, opts->memory_words);
+    unsigned int job;
+    while (take_back(&w->queue, &job) || steal(w, &job)) {
+	run_job(w, m, &w->pool->jobs[job]);
+    }
+    machine_destroy(m);
+    for (unsigned int i = 0; i < w->num_snapshots; i++) {
+	machine_snapshot_destroy(w->snapshots[i].snapshot);
+    }
+    return NULL;
+}
+
+// Return the time, in seconds, from some fixed point in the past
+static double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Run the count jobs using opts, filling in their results.
+// Each worker thread has a queue of jobs (which start out dealt to them
+// in turn); a worker runs jobs from the back of its own queue,
+// and when that is empty it steals from the front of another's,
+// finishing when every queue is empty.
+// Set *stats to what happened.
+void batch_run(batch_job_t *jobs, unsigned int count,
+	       const batch_options_t *opts, batch_stats_t *stats)
+{
+    unsigned int threads = opts->threads;
+    batch_pool_t pool = {jobs, opts, NULL};
+    pool.workers = calloc(threads, sizeof(batch_worker_t));
+    if (pool.workers == NULL) {
+	bail_with_error("Cannot allocate space for %u workers!", threads);
+    }
+    for (unsigned int i = 0; i < threads; i++) {
+	batch_worker_t *w = &pool.workers[i];
+	w->pool = &pool;
+	w->id = i;
+	pthread_mutex_init(&w->queue.lock, NULL);
+	w->queue.jobs = malloc((count / threads + 1) * sizeof(unsigned int));
+	if (w->queue.jobs == NULL) {
+	    bail_with_error("Cannot allocate space for a queue of jobs!");
+	}
+    }
+    // deal the jobs out, so the first jobs are at the back of the queues
+    // (and run first)
+    for (unsigned int j = count; j > 0; j--) {
+	batch_queue_t *q = &pool.workers[(j - 1) % threads].queue;
+	q->jobs[q->back++] = j - 1;
+    }
+
+    double start = now();
+    for (unsigned int i = 0; i < threads; i++) {
+	if (pthread_create(&pool.workers[i].thread, NULL, work,
+			   &pool.workers[i]) != 0) {
+	    bail_with_error("Cannot start worker thread %u!", i);
+	}
+    }
+    for (unsigned int i = 0; i < threads; i++) {
+	pthread_join(pool.workers[i].thread, NULL);
+    }
+    stats->seconds = now() - start;
+    // only free the queues once no worker can be stealing from them
+    stats->steals = 0;
+    stats->restores = 0;
+    for (unsigned int i = 0; i < threads; i++) {
+	stats->steals += pool.workers[i].steals;
+	stats->restores += pool.workers[i].restores;
+	pthread_mutex_destroy(&pool.workers[i].queue.lock);
+	free(pool.workers[i].queue.jobs);
+    }
+    free(pool.workers);
+
+    stats->output_bytes = 0;
+    stats->failures = 0;
+    for (unsigned int j = 0; j < count; j++) {
+	stats->output_bytes += jobs[j].output_size;
+	if (jobs[j].exit_code != EXIT_SUCCESS) {
+	    stats->failures++;
+	}
+    }
+}
+
+// Print the output of each of the count jobs to out, in order,
+// each after a heading that names its files and gives its exit code
+void batch_print_outputs(FILE *out, const batch_job_t *jobs,
+			 unsigned int count)
+{
+    for (unsigned int j = 0; j < count; j++) {
+	fprintf(out, "==> %s < %s (exit code %d) <==\n", jobs[j].bof_name,
+		jobs[j].input_name == NULL ? "(empty)" : jobs[j].input_name,
+		jobs[j].exit_code);
+	fwrite(jobs[j].output, 1, jobs[j].output_size, out);
+	if (jobs[j].output_size > 0
+	    && jobs[j].output[jobs[j].output_size - 1] != '\n') {
+	    newline(out);
+	}
+    }
+    fflush(out);
+}
+
+// Print the number of jobs run, the time taken, and the throughput
+// (in jobs and bytes of output per second) given by stats to out
+void batch_print_throughput(FILE *out, unsigned int count,
+			    unsigned int threads, const batch_stats_t *stats)
+{
+    // avoid dividing by zero for a very fast batch
+    double seconds = stats->seconds > 0 ? stats->seconds : 1e-9;
+    fprintf(out, "%u jobs (%u failed) on %u threads in %.3f s: "
+	    "%.1f jobs/s, %.1f KB/s of output, %lu steals, %lu restores\n",
+	    count, stats->failures, threads, stats->seconds,
+	    count / seconds, stats->output_bytes / 1024.0 / seconds,
+	    stats->steals, stats->restores);
+}
+
+// Free the count jobs (and their outputs and names)
+void batch_free_jobs(batch_job_t *jobs, unsigned int count)
+{
+    for (unsigned int j = 0; j < count; j++) {
+	free((char *) jobs[j].bof_name);
+	free((char *) jobs[j].input_name);
+	free(jobs[j].output);
+    }
+    free(jobs);
+}
@@ -0,0 +1,92 @@
+/* $Id$ */
+// A batch runner, which runs many programs (each with its own input)
+// on a pool of worker threads, capturing the output of each
+#ifndef _BATCH_H
+#define _BATCH_H
+#include <stdio.h>
+#include <stdbool.h>
+#include "machine.h"
+
+// the most worker threads a batch can use
+#define BATCH_MAX_THREADS 256
+
+// A job: a program to run, the file it reads as its input,
+// and (after batch_run) what happened when it ran
+typedef struct {
+    // the name of the .bof file to run
+    const char *bof_name;
+    // the name of the file that is the program's input
+    // (NULL if the program has no input)
+    const char *input_name;
+    // the program's exit code (or EXIT_FAILURE after an error)
+    int exit_code;
+    // the program's output, followed by any error message,
+    // which is output_size bytes long (and not null-terminated)
+    char *output;
+    size_t output_size;
+} batch_job_t;
+
+// How to run the jobs of a batch
+typedef struct {
+    // the number of worker threads (from 1 to BATCH_MAX_THREADS)
+    unsigned int threads;
+    // the engine that runs each program (see machine.h)
+    engine_type engine;
+    // should superinstructions be formed?
+    bool fusing;
+    // should each worker snapshot the programs it loads, and restore
+    // the snapshot (instead of loading again) for later jobs
+    // that run the same program?
+    bool snapshots;
+    // the size of each machine's memory, in words
+    // (or 0 for the default size, see machine_set_memory_size)
+    address_type memory_words;
+} batch_options_t;
+
+// What happened when a batch ran, for its throughput
+typedef struct {
+    // the elapsed time, in seconds
+    double seconds;
+    // the number of jobs a worker took from another worker's queue
+    unsigned long steals;
+    // the number of jobs whose program was restored from a snapshot
+    unsigned long restores;
+    // the total size of the jobs' outputs, in bytes
+    unsigned long output_bytes;
+    // the number of jobs that did not exit with EXIT_SUCCESS
+    unsigned int failures;
+} batch_stats_t;
+
+// Read the jobs listed in the file named filename, one per line,
+// each of which is the name of a .bof file, optionally followed
+// (after white space) by the name of the file that is its input.
+// Blank lines and lines that start with # are ignored.
+// Return the jobs (allocated with malloc), and set *count to their number.
+// Exit with an error message if the file cannot be read.
+extern batch_job_t *batch_read_jobs(const char *filename,
+				    unsigned int *count);
+
+// Run the count jobs using opts, filling in their results.
+// Each worker thread has a queue of jobs (which start out dealt to them
+// in turn); a worker runs jobs from the back of its own queue,
+// and when that is empty it steals from the front of another's,
+// finishing when every queue is empty.
+// Set *stats to what happened.
+extern void batch_run(batch_job_t *jobs, unsigned int count,
+		      const batch_options_t *opts, batch_stats_t *stats);
+
+// Print the output of each of the count jobs to out, in order,
+// each after a heading that names its files and gives its exit code
+extern void batch_print_outputs(FILE *out, const batch_job_t *jobs,
+				unsigned int count);
+
+// Print the number of jobs run, the time taken, and the throughput
+// (in jobs and bytes of output per second) given by stats to out
+extern void batch_print_throughput(FILE *out, unsigned int count,
+				   unsigned int threads,
+				   const batch_stats_t *stats);
+
+// Free the count jobs (and their outputs and names)
+extern void batch_free_jobs(batch_job_t *jobs, unsigned int count);
+
+#endif
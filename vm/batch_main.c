@@ -0,0 +1,111 @@
+/* $Id$ */
+// sysconf is only declared for -std=c17 with _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "batch.h"
+#include "machine.h"
+#include "utilities.h"
+
+/* Print a usage message on stderr and exit with exit code 1. */
+static void usage(const char *cmdname)
+{
+    bail_with_error(
+		    "Usage: %s [-j threads] [-e engine] [-n] [-m words] [-s] [-q] jobs\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s",
+		    cmdname,
+		    "where each line of the file jobs is the name of a .bof file,",
+		    "optionally followed by the name of the file it reads as input,",
+		    "-j sets the number of worker threads (default: one per processor),",
+		    "engine is threaded (the default), tos, jit, or traced,",
+		    "-n turns off superinstructions (in the threaded engine),",
+		    "-m sets the size of each program's memory (default: 32768 words),",
+		    "-s snapshots each program after loading it, restoring that",
+		    "for later jobs (on the same thread) that run the same program,",
+		    "and -q does not print the jobs' outputs (only the throughput)");
+}
+
+// Run the jobs listed in a file on a pool of threads,
+// printing their outputs on stdout and the throughput on stderr
+int main(int argc, char *argv[])
+{
+    const char *cmdname = argv[0];
+    argc--;
+    argv++;
+
+    batch_options_t opts;
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    opts.threads = processors < 1 ? 1 : processors;
+    opts.engine = threaded_engine;
+    opts.fusing = true;
+    opts.snapshots = false;
+    opts.memory_words = 0;
+    bool quiet = false;
+    while (argc > 1 && argv[0][0] == '-') {
+	if (strcmp(argv[0], "-n") == 0) {
+	    opts.fusing = false;
+	    argc--;
+	    argv++;
+	} else if (strcmp(argv[0], "-s") == 0) {
+	    opts.snapshots = true;
+	    argc--;
+	    argv++;
+	} else if (strcmp(argv[0], "-q") == 0) {
+	    quiet = true;
+	    argc--;
+	    argv++;
+	} else if (strcmp(argv[0], "-j") == 0 && argc > 2) {
+	    int threads = atoi(argv[1]);
+	    if (threads < 1 || threads > BATCH_MAX_THREADS) {
+		usage(cmdname);
+	    }
+	    opts.threads = threads;
+	    argc -= 2;
+	    argv += 2;
+	} else if (strcmp(argv[0], "-m") == 0 && argc > 2) {
+	    long words = atol(argv[1]);
+	    if (words < 1 || words > MACHINE_MAX_MEMORY_WORDS) {
+		usage(cmdname);
+	    }
+	    opts.memory_words = (address_type) words;
+	    argc -= 2;
+	    argv += 2;
+	} else if (strcmp(argv[0], "-e") == 0 && argc > 2) {
+	    if (strcmp(argv[1], "threaded") == 0) {
+		opts.engine = threaded_engine;
+	    } else if (strcmp(argv[1], "tos") == 0) {
+		opts.engine = stack_cached_engine;
+	    } else if (strcmp(argv[1], "jit") == 0) {
+		opts.engine = jit_engine;
+	    } else if (strcmp(argv[1], "traced") == 0) {
+		opts.engine = traced_engine;
+	    } else {
+		usage(cmdname);
+	    }
+	    argc -= 2;
+	    argv += 2;
+	} else {
+	    usage(cmdname);
+	}
+    }
+    if (opts.threads > BATCH_MAX_THREADS) {
+	opts.threads = BATCH_MAX_THREADS;
+    }
+
+    // now there should be exactly 1 file argument
+    if (argc != 1 || argv[0][0] == '-') {
+	usage(cmdname);
+    }
+
+    unsigned int count;
+    batch_job_t *jobs = batch_read_jobs(argv[0], &count);
+    batch_stats_t stats;
+    batch_run(jobs, count, &opts, &stats);
+    if (!quiet) {
+	batch_print_outputs(stdout, jobs, count);
+    }
+    batch_print_throughput(stderr, count, opts.threads, &stats);
+    batch_free_jobs(jobs, count);
+    return stats.failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
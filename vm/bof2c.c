@@ -0,0 +1,540 @@
+/* $Id$ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bof2c.h"
+#include "bof.h"
+#include "decode.h"
+#include "lines.h"
+#include "machine.h"
+#include "regname.h"
+#include "utilities.h"
+
+// The declarations and functions at the start of every generated program.
+// The printing functions are those of machine.c, so that trace output
+// is the same as the VM's.
+static const char *prelude[] = {
+    "#include <stdio.h>",
+    "#include <stdlib.h>",
+    "#include <string.h>",
+    "#include <stdbool.h>",
+    "",
+    "#define GP 0",
+    "#define SP 1",
+    "#define FP 2",
+    "#define RA 7",
+    "#define NUM_REGISTERS 8",
+    "#define LO 0",
+    "#define HI 1",
+    "#define MAX_PRINT_WIDTH 59",
+    "",
+    "static union {",
+    "    int words[MEMORY_SIZE_IN_WORDS];",
+    "    unsigned int uwords[MEMORY_SIZE_IN_WORDS];",
+    "} memory;",
+    "static int GPR[NUM_REGISTERS];",
+    "static union {",
+    "    long result;",
+    "    int hilo[2];",
+    "} hilo_regs;",
+    "static bool tracing = false;",
+    "",
+    "static const char *regnames[NUM_REGISTERS] = {",
+    "    \"$gp\", \"$sp\", \"$fp\", \"$r3\", \"$r4\", \"$r5\", \"$r6\", \"$ra\" };",
+    "",
+    "static void bail(const char *msg, unsigned int n)",
+    "{",
+    "    fflush(stdout);",
+    "    fprintf(stderr, msg, n);",
+    "    fprintf(stderr, \"\\n\");",
+    "    fflush(stderr);",
+    "    exit(EXIT_FAILURE);",
+    "}",
+    "",
+    "static inline void check_store(unsigned int wa)",
+    "{",
+    "    if (wa < TEXT_LENGTH) {",
+    "        bail(\"The program stores into its text (at address %u), \"",
+    "             \"which its translation cannot do!\", wa);",
+    "    }",
+    "}",
+    "",
+    "static inline void store_word(unsigned int wa, int w)",
+    "{",
+    "    check_store(wa);",
+    "    memory.words[wa] = w;",
+    "}",
+    "",
+    "static inline void store_uword(unsigned int wa, unsigned int uw)",
+    "{",
+    "    check_store(wa);",
+    "    memory.uwords[wa] = uw;",
+    "}",
+    "",
+    "static void newline(FILE *out)",
+    "{",
+    "    fprintf(out, \"\\n\");",
+    "    fflush(out);",
+    "}",
+    "",
+    "static int print_loc(FILE *out, unsigned int wa)",
+    "{",
+    "    return fprintf(out, \"%8d: %d\\t\", wa, memory.words[wa]);",
+    "}",
+    "",
+    "static bool print_memory_nonzero(FILE *out, int start, int end)",
+    "{",
+    "    bool printed_trailing_newline = false;",
+    "    bool previously_zero = false;",
+    "    bool printed_dots = false;",
+    "    int lc = 0;",
+    "    for (int wa = start; wa <= end; wa++) {",
+    "        if (lc > MAX_PRINT_WIDTH) {",
+    "            newline(out);",
+    "            printed_trailing_newline = true;",
+    "            lc = 0;",
+    "        }",
+    "        if (memory.words[wa] != 0) {",
+    "            lc += print_loc(out, wa);",
+    "            previously_zero = false;",
+    "            printed_dots = false;",
+    "        } else if (!previously_zero) {",
+    "            lc += print_loc(out, wa);",
+    "            previously_zero = true;",
+    "            printed_dots = false;",
+    "        } else if (!printed_dots) {",
+    "            lc += fprintf(out, \"%s\", \"        ...     \");",
+    "            printed_dots = true;",
+    "        }",
+    "        printed_trailing_newline = false;",
+    "    }",
+    "    return printed_trailing_newline;",
+    "}",
+    "",
+    "static void print_state(unsigned int pc)",
+    "{",
+    "    FILE *out = stdout;",
+    "    fprintf(out, \"%8s: %u\", \"PC\", pc);",
+    "    if (hilo_regs.result != 0L) {",
+    "        fprintf(out, \"\\t%8s: %d\\t%8s: %d\",",
+    "                \"HI\", hilo_regs.hilo[HI], \"LO\", hilo_regs.hilo[LO]);",
+    "    }",
+    "    newline(out);",
+    "    for (int j = 0; j < NUM_REGISTERS; /* nothing */) {",
+    "        fprintf(out, \"GPR[%-3s]: %-5d\", regnames[j], GPR[j]);",
+    "        j++;",
+    "        for (int lc = 0; lc < 4 && j < NUM_REGISTERS; lc++) {",
+    "            fprintf(out, \"\\tGPR[%-3s]: %-5d\", regnames[j], GPR[j]);",
+    "            j++;",
+    "        }",
+    "        newline(out);",
+    "    }",
+    "    if (!print_memory_nonzero(out, GPR[GP], GPR[SP] - 1)) {",
+    "        newline(out);",
+    "    }",
+    "    if (!print_memory_nonzero(out, GPR[SP], STACK_BOTTOM)) {",
+    "        newline(out);",
+    "    }",
+    "}",
+    "",
+    "// the source line of the last instruction traced (see line_of)",
+    "static int traced_line = -1;",
+    "",
+    "static void trace_instr(unsigned int addr)",
+    "{",
+    "    int line = line_of[addr];",
+    "    if (line >= 0 && line != traced_line) {",
+    "        printf(\"\\n# %s\", source_lines[line]);",
+    "    }",
+    "    traced_line = line;",
+    "    printf(\"\\n==> %6d: %s\\n\", addr, assembly_forms[addr]);",
+    "}",
+    "",
+    "// trace output before and after the instruction at addr,",
+    "// where pc is the address of the next instruction",
+    "#define BEFORE(addr) if (tracing) { trace_instr(addr); }",
+    "#define AFTER(pc) if (tracing) { print_state(pc); }",
+    "",
+};
+
+#define PRELUDE_LINES (sizeof(prelude) / sizeof(prelude[0]))
+
+// Write the C string literal for str to out
+static void print_string_literal(FILE *out, const char *str)
+{
+    fputc('"', out);
+    for (const char *p = str; *p != '\0'; p++) {
+	if (*p == '"' || *p == '\\') {
+	    fputc('\\', out);
+	}
+	fputc(*p, out);
+    }
+    fputc('"', out);
+}
+
+// Write to out a statement that transfers control to target,
+// which is the address of the next instruction
+static void print_goto(FILE *out, address_type target,
+		       unsigned int text_length)
+{
+    fprintf(out, "AFTER(%u); ", target);
+    if (target < text_length) {
+	fprintf(out, "goto a%u;", target);
+    } else {
+	fprintf(out, "pc = %u; goto dispatch;", target);
+    }
+}
+
+// Write to out the expression for the memory word at GPR[r] + off
+// in the given view ("words" or "uwords")
+static void print_mem(FILE *out, const char *view, unsigned int r, int off)
+{
+    if (off == 0) {
+	fprintf(out, "memory.%s[GPR[%u]]", view, r);
+    } else {
+	fprintf(out, "memory.%s[GPR[%u] + %d]", view, r, off);
+    }
+}
+
+// Write to out the address GPR[r] + off
+static void print_addr(FILE *out, unsigned int r, int off)
+{
+    if (off == 0) {
+	fprintf(out, "GPR[%u]", r);
+    } else {
+	fprintf(out, "GPR[%u] + %d", r, off);
+    }
+}
+
+// Write to out the start of a store of a word (in the given view,
+// "words" or "uwords") into the memory at GPR[r] + off;
+// the caller prints the stored value and ends the statement with ");"
+static void print_store(FILE *out, const char *view, unsigned int r, int off)
+{
+    fprintf(out, "%s(", strcmp(view, "words") == 0 ? "store_word" : "store_uword");
+    print_addr(out, r, off);
+    fprintf(out, ", ");
+}
+
+// Write to out the C statement that executes the instruction bi,
+// which is found at address addr in a text section of text_length words
+void bof2c_instr(FILE *out, bin_instr_t bi, address_type addr,
+		 unsigned int text_length)
+{
+    decoded_instr_t d = decode_instr(addr, bi);
+    const char *binop = NULL;
+    const char *branch = NULL;
+    fprintf(out, "a%u:\tBEFORE(%u); ", addr, addr);
+    switch (d.op) {
+    case DOP_NOP:
+	break;
+    case DOP_ADD:
+	binop = "+";
+	break;
+    case DOP_SUB:
+	binop = "-";
+	break;
+    case DOP_AND:
+	binop = "&";
+	break;
+    case DOP_BOR: case DOP_NOR:
+	binop = "|";
+	break;
+    case DOP_XOR:
+	binop = "^";
+	break;
+    case DOP_CPW:
+	print_store(out, "words", d.ra, d.oa);
+	print_mem(out, "words", d.rb, d.ob);
+	fprintf(out, ");");
+	break;
+    case DOP_CPR:
+	fprintf(out, "GPR[%u] = GPR[%u];", d.ra, d.rb);
+	break;
+    case DOP_LWR:
+	fprintf(out, "GPR[%u] = ", d.ra);
+	print_mem(out, "words", d.rb, d.ob);
+	fprintf(out, ";");
+	break;
+    case DOP_SWR:
+	print_store(out, "words", d.ra, d.oa);
+	fprintf(out, "GPR[%u]);", d.rb);
+	break;
+    case DOP_SCA:
+	print_store(out, "words", d.ra, d.oa);
+	print_addr(out, d.rb, d.ob);
+	fprintf(out, ");");
+	break;
+    case DOP_LWI:
+	print_store(out, "words", d.ra, d.oa);
+	fprintf(out, "memory.words[");
+	print_mem(out, "words", d.rb, d.ob);
+	fprintf(out, "]);");
+	break;
+    case DOP_NEG:
+	print_store(out, "words", d.ra, d.oa);
+	fprintf(out, "- ");
+	print_mem(out, "words", d.rb, d.ob);
+	fprintf(out, ");");
+	break;
+    case DOP_LIT:
+	print_store(out, "words", d.ra, d.oa);
+	fprintf(out, "%d);", d.imm);
+	break;
+    case DOP_ARI:
+	fprintf(out, "GPR[%u] = GPR[%u] + %d;", d.ra, d.ra, d.imm);
+	break;
+    case DOP_SRI:
+	fprintf(out, "GPR[%u] = GPR[%u] - %d;", d.ra, d.ra, d.imm);
+	break;
+    case DOP_MUL:
+	fprintf(out, "hilo_regs.result = (long) memory.words[GPR[SP]] * (long) ");
+	print_mem(out, "words", d.ra, d.oa);
+	fprintf(out, ";");
+	break;
+    case DOP_DIV:
+	fprintf(out, "{ int divisor = ");
+	print_mem(out, "words", d.ra, d.oa);
+	fprintf(out, "; if (divisor == 0) { bail(\"Error: Attempt to divide by zero!\", 0); }"
+		" hilo_regs.hilo[HI] = memory.words[GPR[SP]] %% divisor;"
+		" hilo_regs.hilo[LO] = memory.words[GPR[SP]] / divisor; }");
+	break;
+    case DOP_CFHI: case DOP_CFLO:
+	print_store(out, "words", d.ra, d.oa);
+	fprintf(out, "hilo_regs.hilo[%s]);", d.op == DOP_CFHI ? "HI" : "LO");
+	break;
+    case DOP_SLL: case DOP_SRL:
+	// the VM shifts by a variable amount, which the x86 masks to 5 bits
+	print_store(out, "uwords", d.ra, d.oa);
+	fprintf(out, "memory.uwords[GPR[SP]] %s %d);",
+		d.op == DOP_SLL ? "<<" : ">>", d.imm & 31);
+	break;
+    case DOP_JMP:
+	fprintf(out, "pc = ");
+	print_mem(out, "uwords", d.ra, d.oa);
+	fprintf(out, "; AFTER(pc); goto dispatch;");
+	break;
+    case DOP_CSI:
+	fprintf(out, "GPR[RA] = %u; pc = ", addr + 1);
+	print_mem(out, "words", d.ra, d.oa);
+	fprintf(out, "; AFTER(pc); goto dispatch;");
+	break;
+    case DOP_JREL: case DOP_JMPA:
+	print_goto(out, d.target, text_length);
+	break;
+    case DOP_ADDI: case DOP_ANDI: case DOP_BORI: case DOP_NORI: case DOP_XORI:
+	{
+	    const char *view = d.op == DOP_ADDI ? "words" : "uwords";
+	    const char *op = d.op == DOP_ADDI ? "+"
+		: d.op == DOP_ANDI ? "&"
+		: d.op == DOP_XORI ? "^"
+		: "|";
+	    print_store(out, view, d.ra, d.oa);
+	    if (d.op == DOP_NORI) {
+		fprintf(out, "~(");
+	    }
+	    print_mem(out, view, d.ra, d.oa);
+	    if (d.op == DOP_ADDI) {
+		fprintf(out, " %s %d", op, d.imm);
+	    } else {
+		fprintf(out, " %s %uu", op, (uword_type) d.imm);
+	    }
+	    fprintf(out, d.op == DOP_NORI ? "));" : ");");
+	}
+	break;
+    case DOP_BEQ:
+	branch = "memory.words[GPR[SP]] ==";
+	break;
+    case DOP_BNE:
+	branch = "memory.words[GPR[SP]] !=";
+	break;
+    case DOP_BGEZ: case DOP_BGTZ: case DOP_BLEZ: case DOP_BLTZ:
+	fprintf(out, "if (");
+	print_mem(out, "words", d.ra, d.oa);
+	fprintf(out, " %s 0) { ",
+		d.op == DOP_BGEZ ? ">=" : d.op == DOP_BGTZ ? ">"
+		: d.op == DOP_BLEZ ? "<=" : "<");
+	print_goto(out, d.target, text_length);
+	fprintf(out, " }");
+	break;
+    case DOP_CALL:
+	fprintf(out, "GPR[RA] = %u; ", addr + 1);
+	print_goto(out, d.target, text_length);
+	break;
+    case DOP_RTN:
+	fprintf(out, "pc = GPR[RA]; AFTER(pc); goto dispatch;");
+	break;
+    case DOP_EXIT:
+	fprintf(out, "exit(%d);", d.imm);
+	break;
+    case DOP_PSTR:
+	fprintf(out, "store_word(GPR[SP], printf(\"%%s\", (char *) &");
+	print_mem(out, "words", d.ra, d.oa);
+	fprintf(out, "));");
+	break;
+    case DOP_PINT:
+	fprintf(out, "store_word(GPR[SP], printf(\"%%d\", ");
+	print_mem(out, "words", d.ra, d.oa);
+	fprintf(out, "));");
+	break;
+    case DOP_PCH:
+	fprintf(out, "store_word(GPR[SP], fputc(");
+	print_mem(out, "words", d.ra, d.oa);
+	fprintf(out, ", stdout));");
+	break;
+    case DOP_RCH:
+	print_store(out, "words", d.ra, d.oa);
+	fprintf(out, "getc(stdin));");
+	break;
+    case DOP_STRA:
+	fprintf(out, "tracing = true;");
+	break;
+    case DOP_NOTR:
+	fprintf(out, "tracing = false;");
+	break;
+    default:
+	fprintf(out, "bail(\"Invalid instruction at address %%u!\", %u);",
+		addr);
+	break;
+    }
+    if (binop != NULL) {
+	// ADD and SUB are signed, the logical operations unsigned
+	const char *view = d.op == DOP_ADD || d.op == DOP_SUB ? "words" : "uwords";
+	print_store(out, view, d.ra, d.oa);
+	fprintf(out, "%s", d.op == DOP_NOR ? "~(" : "");
+	fprintf(out, "memory.%s[GPR[SP]] %s ", view, binop);
+	print_mem(out, view, d.rb, d.ob);
+	fprintf(out, d.op == DOP_NOR ? "));" : ");");
+    }
+    if (branch != NULL) {
+	fprintf(out, "if (%s ", branch);
+	print_mem(out, "words", d.ra, d.oa);
+	fprintf(out, ") { ");
+	print_goto(out, d.target, text_length);
+	fprintf(out, " }");
+    }
+    // instructions that always jump have already left
+    switch (d.op) {
+    case DOP_JMP: case DOP_CSI: case DOP_JREL: case DOP_JMPA:
+    case DOP_CALL: case DOP_RTN: case DOP_EXIT:
+	break;
+    default:
+	fprintf(out, " AFTER(%u);", addr + 1);
+	break;
+    }
+    newline(out);
+}
+
+// Requires: bf is open for reading in binary and is at its beginning
+// Write to out a C program that does what the VM does when running bf.
+// Each instruction becomes a labeled statement on a memory array and
+// a GPR array; indirect jumps go through a switch on the target address.
+// The program takes an optional -t argument, which starts it tracing,
+// and then its output (including trace output) is the same as the VM's.
+// (Its trace shows the source lines from bf's line table, as the VM's does.)
+// Programs that store into their own text section stop with an error
+// when they do so, as their translation would no longer match them.
+void bof2c_program(FILE *out, BOFFILE bf)
+{
+    BOFHeader bh = bof_read_header(bf);
+    unsigned int text_length = bh.text_length;
+    bin_instr_t *text = malloc((text_length + 1) * sizeof(bin_instr_t));
+    if (text == NULL) {
+	bail_with_error("Cannot allocate space for %u instructions!",
+			text_length);
+    }
+    size_t text_bytes = text_length * sizeof(bin_instr_t);
+    if (bof_read_bytes(bf, text_bytes, text) != text_bytes) {
+	bail_with_error("Cannot read %u instructions from %s!",
+			text_length, bf.filename);
+    }
+
+    fprintf(out, "/* Generated by bof2c from %s */\n", bf.filename);
+    fprintf(out, "#define MEMORY_SIZE_IN_WORDS %d\n", MEMORY_SIZE_IN_WORDS);
+    fprintf(out, "#define TEXT_START %u\n", bh.text_start_address);
+    fprintf(out, "#define TEXT_LENGTH %u\n", text_length);
+    fprintf(out, "#define DATA_START %u\n", bh.data_start_address);
+    fprintf(out, "#define DATA_LENGTH %u\n", bh.data_length);
+    fprintf(out, "#define STACK_BOTTOM %u\n", bh.stack_bottom_addr);
+
+    // the initial contents of memory
+    fprintf(out, "\nstatic const unsigned int text_words[TEXT_LENGTH + 1] = {\n");
+    for (unsigned int a = 0; a < text_length; a++) {
+	uword_type w;
+	memcpy(&w, &text[a], sizeof(w));
+	fprintf(out, "    0x%08xu,\n", w);
+    }
+    fprintf(out, "    0 };\n");
+    fprintf(out, "\nstatic const int data_words[DATA_LENGTH + 1] = {\n");
+    for (unsigned int i = 0; i < bh.data_length; i++) {
+	fprintf(out, "    %d,\n", bof_read_word(bf));
+    }
+    fprintf(out, "    0 };\n");
+
+    // the assembly form of each instruction, for tracing
+    fprintf(out, "\nstatic const char *assembly_forms[TEXT_LENGTH + 1] = {\n");
+    for (unsigned int a = 0; a < text_length; a++) {
+	fprintf(out, "    ");
+	print_string_literal(out, instruction_assembly_form(a, text[a]));
+	fprintf(out, ",\n");
+    }
+    fprintf(out, "    \"\" };\n");
+
+    // the source line of each instruction (an index in source_lines,
+    // or -1 if it has none), for tracing, from bf's line table
+    lines_t *lines = NULL;
+    size_t size;
+    const void *bytes = bof_read_section(bf, bof_lines_section, &size);
+    if (bytes != NULL) {
+	const char *error = lines_create(&lines, bytes, size, text_length);
+	if (error != NULL) {
+	    bail_with_error("%s", error);
+	}
+    }
+    fprintf(out, "\nstatic const int line_of[TEXT_LENGTH + 1] = {\n");
+    for (unsigned int a = 0; a < text_length; a++) {
+	fprintf(out, "    %d,\n", lines == NULL ? -1 : lines_index(lines, a));
+    }
+    fprintf(out, "    -1 };\n");
+    fprintf(out, "\nstatic const char *source_lines[] = {\n");
+    for (unsigned int i = 0; lines != NULL && i < lines_count(lines); i++) {
+	fprintf(out, "    \"line %u of \" ", lines_number(lines, i));
+	print_string_literal(out, lines_file(lines, i));
+	fprintf(out, ",\n");
+    }
+    fprintf(out, "    \"\" };\n\n");
+    lines_destroy(lines);
+
+    for (unsigned int i = 0; i < PRELUDE_LINES; i++) {
+	fprintf(out, "%s\n", prelude[i]);
+    }
+
+    fprintf(out, "int main(int argc, char *argv[])\n{\n");
+    fprintf(out, "    unsigned int pc = TEXT_START;\n");
+    fprintf(out, "    if (argc == 2 && strcmp(argv[1], \"-t\") == 0) {\n");
+    fprintf(out, "        tracing = true;\n");
+    fprintf(out, "    } else if (argc != 1) {\n");
+    fprintf(out, "        bail(\"Usage: program [-t] (%%u arguments given)\", argc - 1);\n");
+    fprintf(out, "    }\n");
+    fprintf(out, "    memcpy(memory.uwords, text_words, TEXT_LENGTH * sizeof(int));\n");
+    fprintf(out, "    memcpy(&memory.words[DATA_START], data_words, DATA_LENGTH * sizeof(int));\n");
+    fprintf(out, "    GPR[GP] = DATA_START;\n");
+    fprintf(out, "    GPR[SP] = STACK_BOTTOM;\n");
+    fprintf(out, "    GPR[FP] = STACK_BOTTOM;\n");
+    fprintf(out, "    AFTER(pc);\n");
+    fprintf(out, "    goto dispatch;\n");
+    for (unsigned int a = 0; a < text_length; a++) {
+	bof2c_instr(out, text[a], a, text_length);
+    }
+    fprintf(out, "    pc = TEXT_LENGTH;\n");
+    // indirect jumps (and the start of the program) go through this switch
+    fprintf(out, " dispatch:\n    switch (pc) {\n");
+    for (unsigned int a = 0; a < text_length; a++) {
+	fprintf(out, "    case %u: goto a%u;\n", a, a);
+    }
+    fprintf(out, "    default:\n");
+    fprintf(out, "        bail(\"The program's PC (%%u) left its text section!\", pc);\n");
+    fprintf(out, "    }\n");
+    fprintf(out, "    return EXIT_SUCCESS;\n}\n");
+    free(text);
+}
@@ -0,0 +1,25 @@
+/* $Id$ */
+// Translation of binary object files into standalone C programs
+#ifndef _BOF2C_H
+#define _BOF2C_H
+#include <stdio.h>
+#include "bof.h"
+#include "instruction.h"
+
+// Requires: bf is open for reading in binary and is at its beginning
+// Write to out a C program that does what the VM does when running bf.
+// Each instruction becomes a labeled statement on a memory array and
+// a GPR array; indirect jumps go through a switch on the target address.
+// The program takes an optional -t argument, which starts it tracing,
+// and then its output (including trace output) is the same as the VM's.
+// (Its trace shows the source lines from bf's line table, as the VM's does.)
+// Programs that store into their own text section stop with an error
+// when they do so, as their translation would no longer match them.
+extern void bof2c_program(FILE *out, BOFFILE bf);
+
+// Write to out the C statement that executes the instruction bi,
+// which is found at address addr in a text section of text_length words
+extern void bof2c_instr(FILE *out, bin_instr_t bi, address_type addr,
+			unsigned int text_length);
+
+#endif
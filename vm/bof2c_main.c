@@ -0,0 +1,32 @@
+/* $Id$ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "bof.h"
+#include "bof2c.h"
+#include "utilities.h"
+
+static char *progname;
+
+void usage() {
+    bail_with_error("Usage: %s file.bof > file.c", progname);
+}
+
+int main(int argc, char *argv[]) {
+    // set the program's name
+    progname = argv[0];
+    argc--;
+    argv++;
+
+    if (argc != 1) {
+	usage();
+    }
+
+    // name of the file to read
+    const char *bofname = argv[0];
+
+    BOFFILE bf = bof_map_open(bofname);
+
+    bof2c_program(stdout, bf);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,240 @@
+/* $Id$ */
+// strdup is only declared for -std=c17 with _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "btrace.h"
+#include "utilities.h"
+
+// how many records are added between wake-ups of the writer
+#define WAKE_RECORDS (BTRACE_RING_RECORDS / 4)
+
+struct btrace_s {
+    FILE *out;
+    const char *filename;
+    // the records in ring[tail % BTRACE_RING_RECORDS] up to (but not
+    // including) ring[head % BTRACE_RING_RECORDS] are not yet written;
+    // only the VM changes head, and only the writer changes tail
+    btrace_record_t ring[BTRACE_RING_RECORDS];
+    atomic_ulong head;
+    atomic_ulong tail;
+    // the writer waits on has_records (while the ring is empty),
+    // and the VM waits on has_room (while it is full)
+    pthread_mutex_t lock;
+    pthread_cond_t has_records;
+    pthread_cond_t has_room;
+    // has the run ended (so the writer stops when the ring is empty)?
+    bool ended;
+    // did a write fail?
+    bool write_failed;
+    // the error message the run failed with (or NULL)
+    char *error;
+    pthread_t writer;
+};
+
+// The body of the writer thread (whose btrace_t is arg), which writes
+// the records in the ring to the trace file until the run has ended
+static void *write_records(void *arg)
+{
+    btrace_t *bt = arg;
+    for (;;) {
+	pthread_mutex_lock(&bt->lock);
+	unsigned long head = atomic_load_explicit(&bt->head,
+						  memory_order_acquire);
+	unsigned long tail = atomic_load_explicit(&bt->tail,
+						  memory_order_relaxed);
+	while (head == tail && !bt->ended) {
+	    pthread_cond_wait(&bt->has_records, &bt->lock);
+	    head = atomic_load_explicit(&bt->head, memory_order_acquire);
+	}
+	pthread_mutex_unlock(&bt->lock);
+	if (head == tail) {
+	    return NULL; // the run has ended, and all is written
+	}
+	// write the records up to head (in two pieces, if they wrap)
+	while (tail != head) {
+	    unsigned long start = tail % BTRACE_RING_RECORDS;
+	    unsigned long count = head - tail;
+	    if (count > BTRACE_RING_RECORDS - start) {
+		count = BTRACE_RING_RECORDS - start;
+	    }
+	    if (fwrite(&bt->ring[start], sizeof(btrace_record_t), count,
+		       bt->out) != count) {
+		bt->write_failed = true;
+	    }
+	    tail += count;
+	}
+	pthread_mutex_lock(&bt->lock);
+	atomic_store_explicit(&bt->tail, tail, memory_order_release);
+	pthread_cond_signal(&bt->has_room);
+	pthread_mutex_unlock(&bt->lock);
+    }
+}
+
+// Create the trace file named filename for a run of the program
+// in the bof_size bytes at bof (a binary object file) with a memory
+// of memory_words words, and start the thread that writes its records.
+// Exit with an error message if that is not possible.
+btrace_t *btrace_create(const char *filename, const void *bof,
+			size_t bof_size, address_type memory_words)
+{
+    btrace_t *bt = malloc(sizeof(btrace_t));
+    if (bt == NULL) {
+	bail_with_error("Cannot allocate a binary trace!");
+    }
+    bt->filename = filename;
+    bt->out = fopen(filename, "wb");
+    if (bt->out == NULL) {
+	bail_with_error("Cannot open trace file %s for writing!", filename);
+    }
+    btrace_header_t h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, BTRACE_MAGIC, sizeof(h.magic));
+    h.memory_words = memory_words;
+    h.bof_bytes = (uint32_t) bof_size;
+    if (fwrite(&h, sizeof(h), 1, bt->out) != 1
+	|| fwrite(bof, 1, bof_size, bt->out) != bof_size) {
+	bail_with_error("Cannot write trace file %s!", filename);
+    }
+    atomic_init(&bt->head, 0);
+    atomic_init(&bt->tail, 0);
+    pthread_mutex_init(&bt->lock, NULL);
+    pthread_cond_init(&bt->has_records, NULL);
+    pthread_cond_init(&bt->has_room, NULL);
+    bt->ended = false;
+    bt->write_failed = false;
+    bt->error = NULL;
+    if (pthread_create(&bt->writer, NULL, write_records, bt) != 0) {
+	bail_with_error("Cannot start the thread writing trace file %s!",
+			filename);
+    }
+    return bt;
+}
+
+// Wake the writer (which may be waiting for records)
+static void wake_writer(btrace_t *bt)
+{
+    pthread_mutex_lock(&bt->lock);
+    pthread_cond_signal(&bt->has_records);
+    pthread_mutex_unlock(&bt->lock);
+}
+
+// Return the next free record in the ring of bt (zeroed),
+// waiting for the writer if the ring is full
+static btrace_record_t *next_record(btrace_t *bt)
+{
+    unsigned long head = atomic_load_explicit(&bt->head,
+					      memory_order_relaxed);
+    if (head - atomic_load_explicit(&bt->tail, memory_order_acquire)
+	== BTRACE_RING_RECORDS) {
+	pthread_mutex_lock(&bt->lock);
+	pthread_cond_signal(&bt->has_records);
+	while (head - atomic_load_explicit(&bt->tail, memory_order_acquire)
+	       == BTRACE_RING_RECORDS) {
+	    pthread_cond_wait(&bt->has_room, &bt->lock);
+	}
+	pthread_mutex_unlock(&bt->lock);
+    }
+    btrace_record_t *r = &bt->ring[head % BTRACE_RING_RECORDS];
+    memset(r, 0, sizeof(*r));
+    return r;
+}
+
+// Add the record returned by next_record to those to be written
+static void add_record(btrace_t *bt)
+{
+    unsigned long head = atomic_load_explicit(&bt->head,
+					      memory_order_relaxed) + 1;
+    atomic_store_explicit(&bt->head, head, memory_order_release);
+    if (head % WAKE_RECORDS == 0) {
+	wake_writer(bt);
+    }
+}
+
+// Record the start of the run, which printed the state first
+// if print_state is true
+void btrace_start_run(btrace_t *bt, bool print_state)
+{
+    btrace_record_t *r = next_record(bt);
+    r->kind = btrace_start_record;
+    r->flags = print_state ? BTRACE_PRINT_STATE : 0;
+    add_record(bt);
+}
+
+// Record the changes c made by the execution of one instruction
+void btrace_step(btrace_t *bt, const btrace_changes_t *c)
+{
+    unsigned int reg = 0;
+    unsigned int word = 0;
+    btrace_kind kind = btrace_step_record;
+    do {
+	btrace_record_t *r = next_record(bt);
+	r->kind = kind;
+	r->flags = c->flags;
+	r->pc = c->pc;
+	r->instr = c->instr;
+	r->next_pc = c->next_pc;
+	while (r->num_regs < BTRACE_CHANGES && reg < c->num_regs) {
+	    r->regs[r->num_regs] = c->regs[reg];
+	    r->reg_values[r->num_regs++] = c->reg_values[reg++];
+	}
+	while (r->num_words < BTRACE_CHANGES && word < c->num_words) {
+	    r->addrs[r->num_words] = c->addrs[word];
+	    r->words[r->num_words++] = c->words[word++];
+	}
+	add_record(bt);
+	kind = btrace_more_record;
+    } while (reg < c->num_regs || word < c->num_words);
+}
+
+// Record the end of the run, which exited with exit_code, or,
+// if error is not NULL, failed with that error message
+// in the instruction instr at pc (which was printed in the text trace
+// if the BTRACE_PRINT_INSTR bit of flags is set)
+void btrace_end_run(btrace_t *bt, int exit_code, const char *error,
+		    address_type pc, uword_type instr, unsigned int flags)
+{
+    btrace_record_t *r = next_record(bt);
+    r->kind = btrace_end_record;
+    r->reg_values[0] = exit_code;
+    if (error != NULL) {
+	r->flags = (flags & BTRACE_PRINT_INSTR) | BTRACE_FAILED;
+	r->pc = pc;
+	r->instr = instr;
+	r->addrs[0] = (uint32_t) strlen(error);
+	free(bt->error);
+	bt->error = strdup(error);
+    }
+    add_record(bt);
+}
+
+// Wait for the records to be written, then close the trace file
+// and free bt (if it is not NULL).
+// Exit with an error message if the records cannot be written.
+void btrace_close(btrace_t *bt)
+{
+    if (bt == NULL) {
+	return;
+    }
+    pthread_mutex_lock(&bt->lock);
+    bt->ended = true;
+    pthread_cond_signal(&bt->has_records);
+    pthread_mutex_unlock(&bt->lock);
+    pthread_join(bt->writer, NULL);
+    if (bt->error != NULL) {
+	size_t len = strlen(bt->error);
+	if (fwrite(bt->error, 1, len, bt->out) != len) {
+	    bt->write_failed = true;
+	}
+    }
+    if (fclose(bt->out) != 0 || bt->write_failed) {
+	bail_with_error("Cannot write trace file %s!", bt->filename);
+    }
+    pthread_mutex_destroy(&bt->lock);
+    pthread_cond_destroy(&bt->has_records);
+    pthread_cond_destroy(&bt->has_room);
+    free(bt->error);
+    free(bt);
+}
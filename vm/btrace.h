@@ -0,0 +1,130 @@
+/* $Id$ */
+// Binary execution traces: the VM records a fixed-size record for each
+// instruction it executes (with the registers and memory words that
+// the instruction changed) in a ring buffer, which a background thread
+// writes to the trace file. The decoder (btrace_decode) reads a trace
+// and prints the same text as the VM's -t option, or filtered views.
+//
+// A trace file starts with a btrace_header_t, followed by the bytes
+// of the binary object file that was run, then the records.
+// The first record is a start record, and the last is an end record
+// (followed by its error message, if any).
+#ifndef _BTRACE_H
+#define _BTRACE_H
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "machine_types.h"
+#include "regname.h"
+
+// the magic number at the start of a trace file
+#define BTRACE_MAGIC "SSMTRACE"
+
+// the register numbers used in records for HI and LO
+#define BTRACE_HI NUM_REGISTERS
+#define BTRACE_LO (NUM_REGISTERS + 1)
+// the number of registers a record can show changes to
+#define BTRACE_NUM_REGISTERS (NUM_REGISTERS + 2)
+
+// the most memory words an instruction can write
+// (no instruction of the ISA writes more than one)
+#define BTRACE_MAX_WORDS 4
+
+// the number of changes of registers and of memory words
+// each record has room for (more go in btrace_more_record records)
+#define BTRACE_CHANGES 2
+
+// the number of records in the ring buffer
+#define BTRACE_RING_RECORDS 16384
+
+// the kinds of records
+typedef enum {btrace_start_record, btrace_step_record, btrace_more_record,
+	      btrace_end_record} btrace_kind;
+
+// the flags of a record, saying what the text trace prints:
+// the instruction (before running it), the state after running it,
+// and (for an end record) whether the program failed
+#define BTRACE_PRINT_INSTR 1
+#define BTRACE_PRINT_STATE 2
+#define BTRACE_FAILED 4
+
+// The header of a trace file
+typedef struct {
+    char magic[8];
+    // the size of the memory the program ran with (in words)
+    uint32_t memory_words;
+    // the length of the binary object file that follows (in bytes)
+    uint32_t bof_bytes;
+} btrace_header_t;
+
+// A record in a trace file.
+// A step record is for the instruction instr at address pc,
+// after which the PC was next_pc; it changed the registers in regs
+// (num_regs of them) to the values in reg_values, and the memory
+// words at addrs (num_words of them) to the values in words.
+// If it changed more, btrace_more_record records (with the same pc) follow.
+// A start record only has flags (BTRACE_PRINT_STATE,
+// if the state was printed before the first instruction).
+// An end record has the program's exit code in reg_values[0];
+// if the program failed (in the instruction at pc), the length
+// of the error message, which follows the record, is in addrs[0].
+typedef struct {
+    uint32_t pc;
+    uint32_t instr;
+    uint32_t next_pc;
+    uint8_t kind;
+    uint8_t flags;
+    uint8_t num_regs;
+    uint8_t num_words;
+    uint8_t regs[BTRACE_CHANGES];
+    int32_t reg_values[BTRACE_CHANGES];
+    uint32_t addrs[BTRACE_CHANGES];
+    int32_t words[BTRACE_CHANGES];
+} btrace_record_t;
+
+// The changes made by one instruction, as given to btrace_step
+// (which splits them into records)
+typedef struct {
+    address_type pc;
+    uword_type instr;
+    address_type next_pc;
+    unsigned int flags;
+    unsigned int num_regs;
+    unsigned int regs[BTRACE_NUM_REGISTERS];
+    word_type reg_values[BTRACE_NUM_REGISTERS];
+    unsigned int num_words;
+    address_type addrs[BTRACE_MAX_WORDS];
+    word_type words[BTRACE_MAX_WORDS];
+} btrace_changes_t;
+
+// A trace being written
+typedef struct btrace_s btrace_t;
+
+// Create the trace file named filename for a run of the program
+// in the bof_size bytes at bof (a binary object file) with a memory
+// of memory_words words, and start the thread that writes its records.
+// Exit with an error message if that is not possible.
+extern btrace_t *btrace_create(const char *filename, const void *bof,
+			       size_t bof_size, address_type memory_words);
+
+// Record the start of the run, which printed the state first
+// if print_state is true
+extern void btrace_start_run(btrace_t *bt, bool print_state);
+
+// Record the changes c made by the execution of one instruction
+extern void btrace_step(btrace_t *bt, const btrace_changes_t *c);
+
+// Record the end of the run, which exited with exit_code, or,
+// if error is not NULL, failed with that error message
+// in the instruction instr at pc (which was printed in the text trace
+// if the BTRACE_PRINT_INSTR bit of flags is set)
+extern void btrace_end_run(btrace_t *bt, int exit_code, const char *error,
+			   address_type pc, uword_type instr,
+			   unsigned int flags);
+
+// Wait for the records to be written, then close the trace file
+// and free bt (if it is not NULL).
+// Exit with an error message if the records cannot be written.
+extern void btrace_close(btrace_t *bt);
+
+#endif
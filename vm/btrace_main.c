@@ -0,0 +1,258 @@
+/* $Id$ */
+// strnlen is only declared for -std=c17 with _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+// The decoder for binary traces (written by the VM's -b option),
+// which prints the text trace that the VM's -t option would have
+// printed for the same run, or a compact view of the instructions
+// executed (optionally just those in a range of addresses)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "btrace.h"
+#include "machine.h"
+#include "instruction.h"
+#include "regname.h"
+#include "utilities.h"
+
+/* Print a usage message on stderr and exit with exit code 1. */
+static void usage(const char *cmdname)
+{
+    bail_with_error(
+		    "Usage: %s [-c] [-a low-high] trace\n%s\n%s\n%s\n%s",
+		    cmdname,
+		    "where trace was written by the VM's -b option;",
+		    "this prints what the VM's -t option would have, or with -c,",
+		    "one line for each instruction executed, with what it changed,",
+		    "and -a only shows the instructions at addresses low to high");
+}
+
+// the trace being decoded
+static FILE *trace = NULL;
+static const char *trace_name = NULL;
+
+// Read the next record of the trace into *r, exiting with an error
+// message if there is none (as every trace ends with an end record)
+static void read_record(btrace_record_t *r)
+{
+    if (fread(r, sizeof(*r), 1, trace) != 1) {
+	bail_with_error("Trace file %s is truncated!", trace_name);
+    }
+}
+
+// Return the name of register r (in a record)
+static const char *register_name(unsigned int r)
+{
+    if (r == BTRACE_HI) {
+	return "HI";
+    } else if (r == BTRACE_LO) {
+	return "LO";
+    }
+    return regname_get(r);
+}
+
+// the values of HI and LO (which are 0 when the program starts)
+static word_type hilo[2] = {0, 0};
+
+// Apply the changes in the record r to m,
+// printing them on stdout (after a space each) if printing
+static void apply_changes(machine_t *m, const btrace_record_t *r,
+			  bool printing)
+{
+    for (unsigned int i = 0; i < r->num_regs && i < BTRACE_CHANGES; i++) {
+	unsigned int reg = r->regs[i];
+	if (reg == BTRACE_HI || reg == BTRACE_LO) {
+	    hilo[reg - BTRACE_HI] = r->reg_values[i];
+	    machine_set_hi_lo(m, hilo[0], hilo[1]);
+	} else if (reg < NUM_REGISTERS) {
+	    machine_set_register(m, reg, r->reg_values[i]);
+	}
+	if (printing) {
+	    printf(" %s=%d", register_name(reg), r->reg_values[i]);
+	}
+    }
+    for (unsigned int i = 0; i < r->num_words && i < BTRACE_CHANGES; i++) {
+	word_type w = r->words[i];
+	if (!machine_write_memory(m, r->addrs[i], &w, 1)) {
+	    bail_with_error("Trace file %s writes outside of memory (%u)!",
+			    trace_name, r->addrs[i]);
+	}
+	if (printing) {
+	    printf(" [%u]=%d", r->addrs[i], w);
+	}
+    }
+}
+
+// Print on stdout what the instruction bi (about to be executed in m)
+// prints as the program's output, if it is a system call that prints
+static void print_output(machine_t *m, bin_instr_t bi)
+{
+    if (instruction_type(bi) != syscall_instr_type) {
+	return;
+    }
+    syscall_instr_t si = bi.syscall;
+    address_type wa = machine_register(m, si.reg)
+	+ machine_types_formOffset(si.offset);
+    word_type w = 0;
+    switch (si.code) {
+    case print_str_sc:
+	// the string ends at the first zero byte
+	while (machine_read_memory(m, wa, &w, 1)) {
+	    const char *bytes = (const char *) &w;
+	    size_t len = strnlen(bytes, sizeof(w));
+	    fwrite(bytes, 1, len, stdout);
+	    if (len < sizeof(w)) {
+		break;
+	    }
+	    wa++;
+	}
+	break;
+    case print_int_sc:
+	machine_read_memory(m, wa, &w, 1);
+	printf("%d", w);
+	break;
+    case print_char_sc:
+	machine_read_memory(m, wa, &w, 1);
+	putchar(w);
+	break;
+    default:
+	break;
+    }
+}
+
+// Decode the trace of the program loaded into m, printing
+// the text trace on stdout, or if compact, one line per instruction
+// executed (at an address from low to high).
+// Return the exit code of the run.
+static int decode(machine_t *m, bool compact, address_type low,
+		  address_type high)
+{
+    btrace_record_t r;
+    read_record(&r);
+    if (r.kind != btrace_start_record) {
+	bail_with_error("Trace file %s does not start with a run!",
+			trace_name);
+    }
+    if (!compact && (r.flags & BTRACE_PRINT_STATE)) {
+	machine_print_state(m, stdout);
+    }
+    // the flags of the last step (whose state is printed when
+    // all of its records have been applied)
+    unsigned int step_flags = 0;
+    bool showing = false;
+    for (;;) {
+	read_record(&r);
+	if (r.kind == btrace_more_record) {
+	    apply_changes(m, &r, showing);
+	    continue;
+	}
+	// the last step is complete
+	if (showing) {
+	    putchar('\n');
+	    showing = false;
+	}
+	if (!compact && (step_flags & BTRACE_PRINT_STATE)) {
+	    machine_print_state(m, stdout);
+	}
+	step_flags = 0;
+	bin_instr_t bi;
+	memcpy(&bi, &r.instr, sizeof(bi));
+	if (r.kind == btrace_end_record) {
+	    if (!(r.flags & BTRACE_FAILED)) {
+		return r.reg_values[0];
+	    }
+	    if (!compact && (r.flags & BTRACE_PRINT_INSTR)) {
+		machine_print_source_line(m, stdout, r.pc);
+		printf("\n==> %6d: %s\n", r.pc,
+		       instruction_assembly_form(r.pc, bi));
+	    }
+	    print_output(m, bi);
+	    char *message = calloc(r.addrs[0] + 1, 1);
+	    if (message == NULL
+		|| fread(message, 1, r.addrs[0], trace) != r.addrs[0]) {
+		bail_with_error("Trace file %s is truncated!", trace_name);
+	    }
+	    fflush(stdout);
+	    fprintf(stderr, "%s\n", message);
+	    free(message);
+	    return EXIT_FAILURE;
+	}
+	if (r.kind != btrace_step_record) {
+	    bail_with_error("Trace file %s has a bad record!", trace_name);
+	}
+	if (compact) {
+	    showing = low <= r.pc && r.pc <= high;
+	    if (showing) {
+		printf("%6d: %-24s", r.pc, instruction_assembly_form(r.pc, bi));
+	    }
+	} else {
+	    if (r.flags & BTRACE_PRINT_INSTR) {
+		machine_print_source_line(m, stdout, r.pc);
+		printf("\n==> %6d: %s\n", r.pc,
+		       instruction_assembly_form(r.pc, bi));
+	    }
+	    print_output(m, bi);
+	}
+	apply_changes(m, &r, showing);
+	machine_set_pc(m, r.next_pc);
+	step_flags = r.flags;
+    }
+}
+
+// Decode the binary trace named on the command line
+int main(int argc, char *argv[])
+{
+    const char *cmdname = argv[0];
+    argc--;
+    argv++;
+
+    bool compact = false;
+    address_type low = 0;
+    address_type high = UINT_MAX;
+    while (argc > 1 && argv[0][0] == '-') {
+	if (strcmp(argv[0], "-c") == 0) {
+	    compact = true;
+	    argc--;
+	    argv++;
+	} else if (strcmp(argv[0], "-a") == 0 && argc > 2) {
+	    if (sscanf(argv[1], "%u-%u", &low, &high) != 2 || low > high) {
+		usage(cmdname);
+	    }
+	    compact = true;
+	    argc -= 2;
+	    argv += 2;
+	} else {
+	    usage(cmdname);
+	}
+    }
+    if (argc != 1 || argv[0][0] == '-') {
+	usage(cmdname);
+    }
+
+    trace_name = argv[0];
+    trace = fopen(trace_name, "rb");
+    if (trace == NULL) {
+	bail_with_error("Cannot open trace file %s!", trace_name);
+    }
+    btrace_header_t h;
+    if (fread(&h, sizeof(h), 1, trace) != 1
+	|| memcmp(h.magic, BTRACE_MAGIC, sizeof(h.magic)) != 0) {
+	bail_with_error("%s is not a trace file!", trace_name);
+    }
+    void *bof = malloc(h.bof_bytes);
+    if (bof == NULL || fread(bof, 1, h.bof_bytes, trace) != h.bof_bytes) {
+	bail_with_error("Trace file %s is truncated!", trace_name);
+    }
+
+    // the program is loaded as it was for the run
+    machine_t *m = machine_create();
+    machine_set_memory_size(m, h.memory_words);
+    if (!machine_load_bytes(m, bof, h.bof_bytes)) {
+	return EXIT_FAILURE;
+    }
+    free(bof);
+    int exit_code = decode(m, compact, low, high);
+    machine_destroy(m);
+    fclose(trace);
+    return exit_code;
+}
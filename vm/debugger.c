@@ -0,0 +1,498 @@
+/* $Id$ */
+// fileno and isatty are only declared for -std=c17 with _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include "debugger.h"
+#include "instruction.h"
+#include "regname.h"
+
+// A watchpoint that was set (so the info command can list it)
+typedef struct {
+    address_type addr;
+    unsigned int count;
+} watch_t;
+
+// The state of a debugging session
+typedef struct {
+    machine_t *m;
+    FILE *out;
+    // what the last run ended with (machine_stepping before the first)
+    machine_status status;
+    // the breakpoints and watchpoints set, in the order they were set
+    address_type breaks[MACHINE_MAX_BREAKPOINTS];
+    unsigned int num_breaks;
+    watch_t watches[MACHINE_MAX_WATCHPOINTS];
+    unsigned int num_watches;
+    // should the session end (after a quit command)?
+    bool quitting;
+} debugger_t;
+
+// the function that carries out a command,
+// given its arguments (argc of them, after the command's name)
+typedef void (*command_fun)(debugger_t *d, int argc, char *argv[]);
+
+// A command: its name and abbreviation, the function that carries it out,
+// and its arguments and description (for the help command)
+typedef struct {
+    const char *name;
+    const char *abbrev;
+    command_fun run;
+    const char *args;
+    const char *help;
+} command_t;
+
+// Put the word address that text names in *addr: a number (decimal,
+// or hexadecimal if it starts with 0x), or a register ($gp, ..., $ra,
+// or $pc) or symbol of the program (a label, procedure, or data name,
+// if it has symbols) with an optional offset (as in $sp+2 or loop-1).
+// Return false (after saying why on d's output) if text is not one.
+static bool parse_address(debugger_t *d, const char *text,
+			  address_type *addr)
+{
+    const char *rest = text;
+    long base = 0;
+    if (text[0] == '$') {
+	size_t len = strcspn(text, "+-");
+	bool found = false;
+	if (len == 3 && strncmp(text, "$pc", len) == 0) {
+	    base = machine_pc(d->m);
+	    found = true;
+	}
+	for (unsigned int r = 0; r < NUM_REGISTERS && !found; r++) {
+	    if (strlen(regname_get(r)) == len
+		&& strncmp(text, regname_get(r), len) == 0) {
+		base = machine_register(d->m, r);
+		found = true;
+	    }
+	}
+	if (!found) {
+	    fprintf(d->out, "There is no register %.*s\n", (int) len, text);
+	    return false;
+	}
+	rest = text + len;
+	if (*rest == '\0') {
+	    *addr = (address_type) base;
+	    return base >= 0;
+	}
+    } else if (text[0] < '0' || text[0] > '9') {
+	const bof_symbols_t *symbols = machine_symbols(d->m);
+	if (symbols == NULL) {
+	    fprintf(d->out, "Cannot find the label %s %s\n", text,
+		    "(the program has no symbols, so give an address)");
+	    return false;
+	}
+	size_t len = strcspn(text, "+-");
+	char name[DEBUGGER_LINE_SIZE];
+	snprintf(name, sizeof(name), "%.*s", (int) len, text);
+	uword_type sym = bof_symbols_find(symbols, name);
+	if (sym == BOF_NO_SYMBOL) {
+	    fprintf(d->out, "Cannot find the label %s\n", name);
+	    return false;
+	}
+	base = symbols->symbols[sym].addr;
+	rest = text + len;
+	if (*rest == '\0') {
+	    *addr = (address_type) base;
+	    return true;
+	}
+    }
+    char *end;
+    long n = strtol(rest, &end, 0);
+    if (*end != '\0' || end == rest) {
+	fprintf(d->out, "%s is not an address\n", text);
+	return false;
+    }
+    if (base + n < 0 || base + n > (long) MACHINE_MAX_MEMORY_WORDS) {
+	fprintf(d->out, "%s is outside of memory\n", text);
+	return false;
+    }
+    *addr = (address_type) (base + n);
+    return true;
+}
+
+// Put the count that text gives (a positive number) in *count, or,
+// if text is NULL, put def there.
+// Return false (after saying why on d's output) if text is not one.
+static bool parse_count(debugger_t *d, const char *text, unsigned long def,
+			unsigned long *count)
+{
+    if (text == NULL) {
+	*count = def;
+	return true;
+    }
+    char *end;
+    long n = strtol(text, &end, 0);
+    if (*end != '\0' || end == text || n < 1) {
+	fprintf(d->out, "%s is not a positive count\n", text);
+	return false;
+    }
+    *count = (unsigned long) n;
+    return true;
+}
+
+// Is there a breakpoint at addr?
+static bool has_break(const debugger_t *d, address_type addr)
+{
+    for (unsigned int i = 0; i < d->num_breaks; i++) {
+	if (d->breaks[i] == addr) {
+	    return true;
+	}
+    }
+    return false;
+}
+
+// Print the instruction at addr (in assembly form) on d's output,
+// marking it with * if there is a breakpoint there
+// and with => if it is the next to execute
+// (after the name of its address, if the program has a symbol for it)
+static void print_instr(debugger_t *d, address_type addr)
+{
+    const bof_symbols_t *symbols = machine_symbols(d->m);
+    uword_type sym = symbols == NULL ? BOF_NO_SYMBOL
+	: bof_symbols_at(symbols, addr);
+    if (sym != BOF_NO_SYMBOL) {
+	fprintf(d->out, "%s:\n", bof_symbols_name(symbols, sym));
+    }
+    word_type w;
+    if (!machine_read_memory(d->m, addr, &w, 1)) {
+	fprintf(d->out, "   %6u: (outside of memory)\n", addr);
+	return;
+    }
+    bin_instr_t bi;
+    memcpy(&bi, &w, sizeof(bi));
+    fprintf(d->out, "%s%c %6u: %s\n",
+	    addr == machine_pc(d->m) ? "=>" : "  ",
+	    has_break(d, addr) ? '*' : ' ',
+	    addr, instruction_assembly_form(addr, bi));
+}
+
+// Is the program still running (and if not, say so)?
+static bool check_running(debugger_t *d)
+{
+    if (d->status == machine_exited || d->status == machine_failed) {
+	fprintf(d->out, "The program is not running\n");
+	return false;
+    }
+    return true;
+}
+
+// Run the program for at most steps instructions (or until it stops,
+// if steps is 0), then say why it stopped and where
+static void run(debugger_t *d, unsigned long steps)
+{
+    if (!check_running(d)) {
+	return;
+    }
+    d->status = machine_run_steps(d->m, steps);
+    address_type wa;
+    word_type old;
+    switch (d->status) {
+    case machine_exited:
+	fprintf(d->out, "The program exited with code %d\n",
+		machine_exit_code(d->m));
+	return;
+    case machine_failed:
+	fprintf(d->out, "The program stopped with an error\n");
+	return;
+    case machine_blocked:
+	fprintf(d->out, "The program's input is not ready\n");
+	break;
+    case machine_stopped:
+	if (machine_watch_hit(d->m, &wa, &old)) {
+	    word_type now = 0;
+	    machine_read_memory(d->m, wa, &now, 1);
+	    fprintf(d->out, "Watchpoint: memory[%u] was %d, now %d\n",
+		    wa, old, now);
+	} else {
+	    fprintf(d->out, "Breakpoint at %u\n", machine_pc(d->m));
+	}
+	break;
+    case machine_stepping:
+	break;
+    }
+    print_instr(d, machine_pc(d->m));
+}
+
+// break addr: stop before the instruction at addr
+static void cmd_break(debugger_t *d, int argc, char *argv[])
+{
+    address_type addr;
+    if (argc != 1) {
+	fprintf(d->out, "Usage: break addr\n");
+	return;
+    }
+    if (!parse_address(d, argv[0], &addr)) {
+	return;
+    }
+    if (has_break(d, addr)) {
+	fprintf(d->out, "There is already a breakpoint at %u\n", addr);
+    } else if (!machine_set_breakpoint(d->m, addr)) {
+	fprintf(d->out, "Cannot set a breakpoint at %u %s\n", addr,
+		"(outside of the text, too many, or the JIT engine)");
+    } else {
+	d->breaks[d->num_breaks++] = addr;
+	fprintf(d->out, "Breakpoint at %u\n", addr);
+    }
+}
+
+// watch addr [count]: stop after a store into the count words at addr
+static void cmd_watch(debugger_t *d, int argc, char *argv[])
+{
+    address_type addr;
+    unsigned long count;
+    if (argc < 1 || argc > 2) {
+	fprintf(d->out, "Usage: watch addr [count]\n");
+	return;
+    }
+    if (!parse_address(d, argv[0], &addr)
+	|| !parse_count(d, argc == 2 ? argv[1] : NULL, 1, &count)) {
+	return;
+    }
+    if (!machine_set_watchpoint(d->m, addr, (unsigned int) count)) {
+	fprintf(d->out, "Cannot watch %lu word(s) at %u %s\n", count, addr,
+		"(outside of memory, too many, or the tos or JIT engine)");
+    } else {
+	d->watches[d->num_watches].addr = addr;
+	d->watches[d->num_watches++].count = (unsigned int) count;
+	fprintf(d->out, "Watchpoint on %lu word(s) at %u\n", count, addr);
+    }
+}
+
+// delete addr: remove the breakpoint and the watchpoint at addr
+static void cmd_delete(debugger_t *d, int argc, char *argv[])
+{
+    address_type addr;
+    if (argc != 1) {
+	fprintf(d->out, "Usage: delete addr\n");
+	return;
+    }
+    if (!parse_address(d, argv[0], &addr)) {
+	return;
+    }
+    bool deleted = false;
+    if (machine_clear_breakpoint(d->m, addr)) {
+	for (unsigned int i = 0; i < d->num_breaks; i++) {
+	    if (d->breaks[i] == addr) {
+		d->breaks[i] = d->breaks[--d->num_breaks];
+	    }
+	}
+	fprintf(d->out, "Deleted the breakpoint at %u\n", addr);
+	deleted = true;
+    }
+    if (machine_clear_watchpoint(d->m, addr)) {
+	for (unsigned int i = 0; i < d->num_watches; i++) {
+	    if (d->watches[i].addr == addr) {
+		d->watches[i] = d->watches[--d->num_watches];
+	    }
+	}
+	fprintf(d->out, "Deleted the watchpoint at %u\n", addr);
+	deleted = true;
+    }
+    if (!deleted) {
+	fprintf(d->out, "There is no breakpoint or watchpoint at %u\n", addr);
+    }
+}
+
+// step [n]: execute n instructions (default 1)
+static void cmd_step(debugger_t *d, int argc, char *argv[])
+{
+    unsigned long steps;
+    if (argc > 1) {
+	fprintf(d->out, "Usage: step [n]\n");
+	return;
+    }
+    if (parse_count(d, argc == 1 ? argv[0] : NULL, 1, &steps)) {
+	run(d, steps);
+    }
+}
+
+// continue: run until a breakpoint, a watchpoint, or the end
+static void cmd_continue(debugger_t *d, int argc, char *argv[])
+{
+    run(d, 0);
+}
+
+// regs: print the registers
+static void cmd_regs(debugger_t *d, int argc, char *argv[])
+{
+    word_type hi, lo;
+    machine_hi_lo(d->m, &hi, &lo);
+    fprintf(d->out, "PC: %u  HI: %d  LO: %d\n", machine_pc(d->m), hi, lo);
+    for (unsigned int r = 0; r < NUM_REGISTERS; r++) {
+	fprintf(d->out, "%s: %-11d%s", regname_get(r),
+		machine_register(d->m, r),
+		r % 4 == 3 || r == NUM_REGISTERS - 1 ? "\n" : " ");
+    }
+}
+
+// mem addr [n]: print n words of memory starting at addr (default 1)
+static void cmd_mem(debugger_t *d, int argc, char *argv[])
+{
+    address_type addr;
+    unsigned long count;
+    if (argc < 1 || argc > 2) {
+	fprintf(d->out, "Usage: mem addr [n]\n");
+	return;
+    }
+    if (!parse_address(d, argv[0], &addr)
+	|| !parse_count(d, argc == 2 ? argv[1] : NULL, 1, &count)) {
+	return;
+    }
+    for (unsigned long i = 0; i < count; i++) {
+	word_type w;
+	if (!machine_read_memory(d->m, addr + i, &w, 1)) {
+	    fprintf(d->out, "%s%u is outside of memory\n",
+		    i % DEBUGGER_WORDS_PER_LINE == 0 ? "" : "\n",
+		    (unsigned int) (addr + i));
+	    return;
+	}
+	if (i % DEBUGGER_WORDS_PER_LINE == 0) {
+	    fprintf(d->out, "%6u:", (unsigned int) (addr + i));
+	}
+	fprintf(d->out, " %11d", w);
+	if (i % DEBUGGER_WORDS_PER_LINE == DEBUGGER_WORDS_PER_LINE - 1
+	    || i == count - 1) {
+	    fprintf(d->out, "\n");
+	}
+    }
+}
+
+// list [addr [n]]: print n instructions starting at addr
+// (by default, DEBUGGER_LIST_COUNT at the PC)
+static void cmd_list(debugger_t *d, int argc, char *argv[])
+{
+    address_type addr = machine_pc(d->m);
+    unsigned long count;
+    if (argc > 2) {
+	fprintf(d->out, "Usage: list [addr [n]]\n");
+	return;
+    }
+    if ((argc >= 1 && !parse_address(d, argv[0], &addr))
+	|| !parse_count(d, argc == 2 ? argv[1] : NULL, DEBUGGER_LIST_COUNT,
+			&count)) {
+	return;
+    }
+    for (unsigned long i = 0; i < count; i++) {
+	print_instr(d, addr + i);
+    }
+}
+
+// info: list the breakpoints and watchpoints
+static void cmd_info(debugger_t *d, int argc, char *argv[])
+{
+    if (d->num_breaks == 0 && d->num_watches == 0) {
+	fprintf(d->out, "There are no breakpoints or watchpoints\n");
+    }
+    for (unsigned int i = 0; i < d->num_breaks; i++) {
+	print_instr(d, d->breaks[i]);
+    }
+    for (unsigned int i = 0; i < d->num_watches; i++) {
+	fprintf(d->out, "Watchpoint on %u word(s) at %u\n",
+		d->watches[i].count, d->watches[i].addr);
+    }
+}
+
+// quit: end the session
+static void cmd_quit(debugger_t *d, int argc, char *argv[])
+{
+    d->quitting = true;
+}
+
+static void cmd_help(debugger_t *d, int argc, char *argv[]);
+
+// the commands (each can be abbreviated to its first letter)
+static const command_t commands[] = {
+    {"break", "b", cmd_break, "addr", "stop before the instruction at addr"},
+    {"watch", "w", cmd_watch, "addr [n]",
+     "stop after a store into the n words at addr (default 1)"},
+    {"delete", "d", cmd_delete, "addr",
+     "remove the breakpoint and watchpoint at addr"},
+    {"step", "s", cmd_step, "[n]", "execute n instructions (default 1)"},
+    {"continue", "c", cmd_continue, "",
+     "run until a breakpoint, a watchpoint, or the end"},
+    {"regs", "r", cmd_regs, "", "print the registers"},
+    {"mem", "m", cmd_mem, "addr [n]",
+     "print n words of memory at addr (default 1)"},
+    {"list", "l", cmd_list, "[addr [n]]",
+     "print n instructions at addr (default 5 at the PC)"},
+    {"info", "i", cmd_info, "", "list the breakpoints and watchpoints"},
+    {"help", "h", cmd_help, "", "print this list"},
+    {"quit", "q", cmd_quit, "", "end the session"},
+};
+#define NUM_COMMANDS (sizeof(commands) / sizeof(commands[0]))
+
+// help: print the commands
+static void cmd_help(debugger_t *d, int argc, char *argv[])
+{
+    for (unsigned int i = 0; i < NUM_COMMANDS; i++) {
+	fprintf(d->out, "%-8s %-10s  %s\n", commands[i].name, commands[i].args,
+		commands[i].help);
+    }
+    fprintf(d->out, "%s\n%s\n",
+	    "where addr is a number, a register ($sp, $pc, ...), or a label",
+	    "(if the program has symbols) with an optional offset (as in $fp-2)");
+}
+
+// Carry out the command on the line (if it is not blank)
+static void execute(debugger_t *d, char *line)
+{
+    char *argv[DEBUGGER_MAX_WORDS + 1];
+    int argc = 0;
+    for (char *word = strtok(line, " \t\r\n"); word != NULL;
+	 word = strtok(NULL, " \t\r\n")) {
+	if (argc == DEBUGGER_MAX_WORDS) {
+	    fprintf(d->out, "Too many arguments\n");
+	    return;
+	}
+	argv[argc++] = word;
+    }
+    if (argc == 0) {
+	return;
+    }
+    for (unsigned int i = 0; i < NUM_COMMANDS; i++) {
+	if (strcmp(argv[0], commands[i].name) == 0
+	    || strcmp(argv[0], commands[i].abbrev) == 0) {
+	    commands[i].run(d, argc - 1, argv + 1);
+	    return;
+	}
+    }
+    fprintf(d->out, "Unknown command %s (try help)\n", argv[0]);
+}
+
+// Requires: a program has been loaded into m
+// Run the program on m under the control of the commands read from cmds
+// (one a line, see the help command), writing a prompt before each
+// (and echoing it, unless cmds is a terminal) and the responses to out,
+// until a quit command or the end of cmds.
+// Return the program's exit code, or EXIT_FAILURE if it did not exit
+// (because of an error, or as the debugger quit first).
+int debugger_run(machine_t *m, FILE *cmds, FILE *out)
+{
+    debugger_t d;
+    memset(&d, 0, sizeof(d));
+    d.m = m;
+    d.out = out;
+    d.status = machine_stepping;
+    bool echo = !isatty(fileno(cmds));
+    print_instr(&d, machine_pc(m));
+    char line[DEBUGGER_LINE_SIZE];
+    while (!d.quitting) {
+	fprintf(out, "(vm) ");
+	fflush(out);
+	if (fgets(line, sizeof(line), cmds) == NULL) {
+	    fprintf(out, "\n");
+	    break;
+	}
+	if (echo) {
+	    fprintf(out, "%s%s", line,
+		    strchr(line, '\n') == NULL ? "\n" : "");
+	}
+	execute(&d, line);
+    }
+    fflush(out);
+    return d.status == machine_exited ? machine_exit_code(m) : EXIT_FAILURE;
+}
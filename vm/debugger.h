@@ -0,0 +1,34 @@
+/* $Id$ */
+// A debugger for the VM, which runs a loaded program under the control
+// of commands read from a terminal or a control file: they set
+// breakpoints and watchpoints (see machine_set_breakpoint
+// and machine_set_watchpoint), step through and continue the program,
+// and print its registers, memory, and instructions
+#ifndef _DEBUGGER_H
+#define _DEBUGGER_H
+#include <stdio.h>
+#include "machine.h"
+
+// the longest command line (longer ones are cut into several)
+#define DEBUGGER_LINE_SIZE 256
+
+// the most words in a command line (the command and its arguments)
+#define DEBUGGER_MAX_WORDS 4
+
+// the number of instructions listed by a list command that does not
+// give a count
+#define DEBUGGER_LIST_COUNT 5
+
+// the number of words of memory printed on each line
+#define DEBUGGER_WORDS_PER_LINE 4
+
+// Requires: a program has been loaded into m
+// Run the program on m under the control of the commands read from cmds
+// (one a line, see the help command), writing a prompt before each
+// (and echoing it, unless cmds is a terminal) and the responses to out,
+// until a quit command or the end of cmds.
+// Return the program's exit code, or EXIT_FAILURE if it did not exit
+// (because of an error, or as the debugger quit first).
+extern int debugger_run(machine_t *m, FILE *cmds, FILE *out);
+
+#endif
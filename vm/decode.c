@@ -0,0 +1,147 @@
+/* $Id$ */
+#include <stdlib.h>
+#include <string.h>
+#include "decode.h"
+#include "utilities.h"
+
+// decoded ops of computational instructions, indexed by function code
+static const decoded_op comp_ops[16] = {
+    DOP_NOP, DOP_ADD, DOP_SUB, DOP_CPW, DOP_CPR, DOP_AND, DOP_BOR,
+    DOP_NOR, DOP_XOR, DOP_LWR, DOP_SWR, DOP_SCA, DOP_LWI, DOP_NEG,
+    DOP_INVALID, DOP_INVALID
+};
+
+// decoded ops of other computational instructions, indexed by function code
+// (SYS_F is handled separately)
+static const decoded_op othc_ops[16] = {
+    DOP_INVALID, DOP_LIT, DOP_ARI, DOP_SRI, DOP_MUL, DOP_DIV, DOP_CFHI,
+    DOP_CFLO, DOP_SLL, DOP_SRL, DOP_JMP, DOP_CSI, DOP_JREL,
+    DOP_INVALID, DOP_INVALID, DOP_INVALID
+};
+
+// decoded ops of immediate and jump instructions, indexed by opcode
+static const decoded_op immed_ops[16] = {
+    DOP_INVALID, DOP_INVALID, DOP_ADDI, DOP_ANDI, DOP_BORI, DOP_NORI,
+    DOP_XORI, DOP_BEQ, DOP_BGEZ, DOP_BGTZ, DOP_BLEZ, DOP_BLTZ, DOP_BNE,
+    DOP_JMPA, DOP_CALL, DOP_RTN
+};
+
+// Return the decoded op for the system call with the given code
+static decoded_op syscall_op(syscall_type code)
+{
+    switch (code) {
+    case exit_sc:
+	return DOP_EXIT;
+    case print_str_sc:
+	return DOP_PSTR;
+    case print_int_sc:
+	return DOP_PINT;
+    case print_char_sc:
+	return DOP_PCH;
+    case read_char_sc:
+	return DOP_RCH;
+    case start_tracing_sc:
+	return DOP_STRA;
+    case stop_tracing_sc:
+	return DOP_NOTR;
+    default:
+	return DOP_INVALID;
+    }
+}
+
+// Return a decoded_instr_t that says its instruction must be decoded again
+decoded_instr_t decode_undecoded()
+{
+    decoded_instr_t ret;
+    memset(&ret, 0, sizeof(ret));
+    ret.op = DOP_UNDECODED;
+    return ret;
+}
+
+// Return the decoded form of bi, which is found at word address addr
+decoded_instr_t decode_instr(address_type addr, bin_instr_t bi)
+{
+    decoded_instr_t ret = decode_undecoded();
+    // instruction_type asserts that the function code of an OTHC_O
+    // instruction is not 0, but words that are never executed
+    // may be anything, so that case is handled here first
+    if (bi.othc.op == OTHC_O && bi.othc.func == NOP_F) {
+	ret.op = DOP_INVALID;
+	return ret;
+    }
+    switch (instruction_type(bi)) {
+    case comp_instr_type:
+	ret.op = comp_ops[bi.comp.func];
+	ret.ra = bi.comp.rt;
+	ret.oa = machine_types_formOffset(bi.comp.ot);
+	ret.rb = bi.comp.rs;
+	ret.ob = machine_types_formOffset(bi.comp.os);
+	break;
+    case other_comp_instr_type:
+	ret.op = othc_ops[bi.othc.func];
+	ret.ra = bi.othc.reg;
+	ret.oa = machine_types_formOffset(bi.othc.offset);
+	ret.imm = machine_types_sgnExt(bi.othc.arg);
+	ret.target = addr + machine_types_formOffset(bi.othc.arg);
+	break;
+    case syscall_instr_type:
+	ret.op = syscall_op(bi.syscall.code);
+	ret.ra = bi.syscall.reg;
+	ret.oa = machine_types_formOffset(bi.syscall.offset);
+	ret.imm = machine_types_sgnExt(bi.syscall.offset);
+	break;
+    case immed_instr_type:
+	ret.op = immed_ops[bi.immed.op];
+	ret.ra = bi.immed.reg;
+	ret.oa = machine_types_formOffset(bi.immed.offset);
+	switch (bi.immed.op) {
+	case ANDI_O: case BORI_O: case NORI_O: case XORI_O:
+	    ret.imm = machine_types_zeroExt(bi.uimmed.uimmed);
+	    break;
+	default:
+	    ret.imm = machine_types_sgnExt(bi.immed.immed);
+	    break;
+	}
+	ret.target = addr + machine_types_formOffset(bi.immed.immed);
+	break;
+    case jump_instr_type:
+	ret.op = immed_ops[bi.jump.op];
+	ret.target = machine_types_formAddress(addr, bi.jump.addr);
+	break;
+    default:
+	ret.op = DOP_INVALID;
+	break;
+    }
+    return ret;
+}
+
+// Allocate a cache-aligned array of count decoded instructions,
+// exiting with an error message if that is not possible.
+// The result should be freed with free().
+decoded_instr_t *decode_allocate(unsigned int count)
+{
+    // aligned_alloc requires the size to be a multiple of the alignment
+    size_t bytes = count * sizeof(decoded_instr_t);
+    bytes = (bytes + DECODE_CACHE_LINE_BYTES - 1)
+	& ~((size_t) DECODE_CACHE_LINE_BYTES - 1);
+    if (bytes == 0) {
+	bytes = DECODE_CACHE_LINE_BYTES;
+    }
+    decoded_instr_t *ret = aligned_alloc(DECODE_CACHE_LINE_BYTES, bytes);
+    if (ret == NULL) {
+	bail_with_error("Cannot allocate space for %u decoded instructions!",
+			count);
+    }
+    return ret;
+}
+
+// Requires: out has room for count entries
+// Decode the count instructions in instrs, which start at address 0,
+// into out
+void decode_text(decoded_instr_t *out, const bin_instr_t *instrs,
+		 unsigned int count)
+{
+    for (unsigned int a = 0; a < count; a++) {
+	out[a] = decode_instr(a, instrs[a]);
+    }
+}
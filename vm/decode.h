@@ -0,0 +1,88 @@
+/* $Id$ */
+// Pre-decoded instructions for the VM's run loops
+#ifndef _DECODE_H
+#define _DECODE_H
+#include "machine_types.h"
+#include "instruction.h"
+
+// the size (in bytes) of a cache line, used to align decoded arrays
+#define DECODE_CACHE_LINE_BYTES 64
+
+// handler ids for decoded instructions;
+// DOP_UNDECODED marks an entry whose instruction word has been
+// overwritten since it was decoded, so it must be decoded again,
+// DOP_CHECK marks an instruction that must be checked when it runs
+// (see verify.h), whose own op is in the entry's checked field,
+// DOP_BREAK marks a breakpoint and DOP_WATCH the instruction after
+// a store into a watched page (see machine_set_breakpoint
+// and machine_set_watchpoint), which replace the entry for a while,
+// and DOP_INVALID marks a word that is not a legal instruction
+// (executing it produces the same error as the reference interpreter)
+typedef enum {DOP_UNDECODED = 0,
+	      DOP_NOP, DOP_ADD, DOP_SUB, DOP_CPW, DOP_CPR,
+	      DOP_AND, DOP_BOR, DOP_NOR, DOP_XOR,
+	      DOP_LWR, DOP_SWR, DOP_SCA, DOP_LWI, DOP_NEG,
+	      DOP_LIT, DOP_ARI, DOP_SRI, DOP_MUL, DOP_DIV,
+	      DOP_CFHI, DOP_CFLO, DOP_SLL, DOP_SRL,
+	      DOP_JMP, DOP_CSI, DOP_JREL,
+	      DOP_ADDI, DOP_ANDI, DOP_BORI, DOP_NORI, DOP_XORI,
+	      DOP_BEQ, DOP_BGEZ, DOP_BGTZ, DOP_BLEZ, DOP_BLTZ, DOP_BNE,
+	      DOP_JMPA, DOP_CALL, DOP_RTN,
+	      DOP_EXIT, DOP_PSTR, DOP_PINT, DOP_PCH, DOP_RCH,
+	      DOP_STRA, DOP_NOTR,
+	      DOP_CHECK,
+	      DOP_BREAK, DOP_WATCH,
+	      DOP_INVALID,
+	      // superinstructions (see fusion.h), each of which executes
+	      // the instructions that start at its own address
+	      DOP_F_SAVE_AR, DOP_F_RESTORE_AR,
+	      DOP_F_CPR_LWR, DOP_F_LWR_LWR,
+	      DOP_F_SRI_CPW, DOP_F_SRI_LIT,
+	      DOP_F_ADD_ARI, DOP_F_SUB_ARI, DOP_F_CPW_ARI,
+	      DOP_NUM_OPS
+} decoded_op;
+
+// Is op a superinstruction (made by fusion_apply)?
+#define DECODE_IS_FUSED(op) ((op) > DOP_INVALID)
+
+// The op that the decoded instruction d executes (after any checks)
+#define DECODE_OP(d) ((d)->op == DOP_CHECK ? (d)->checked : (d)->op)
+
+// A binary instruction with all of its fields extracted and extended.
+// Field use depends on op:
+// ra/oa are the target register and offset (rt/ot, or reg/offset),
+// rb/ob are the source register and offset (rs/os) of computational
+// instructions, imm is the sign-extended arg (or shift), the
+// sign- or zero-extended immediate operand, or the exit code,
+// and target is the address a branch, JREL, JMPA, or CALL goes to.
+// checked is only used when op is DOP_CHECK.
+// The layout is 16 bytes, so 4 entries share a cache line.
+typedef struct {
+    unsigned char op;      // a decoded_op
+    unsigned char checked; // a decoded_op
+    unsigned char ra;
+    unsigned char rb;
+    short oa;
+    short ob;
+    word_type imm;
+    address_type target;
+} decoded_instr_t;
+
+// Return the decoded form of bi, which is found at word address addr
+extern decoded_instr_t decode_instr(address_type addr, bin_instr_t bi);
+
+// Return a decoded_instr_t that says its instruction must be decoded again
+extern decoded_instr_t decode_undecoded();
+
+// Allocate a cache-aligned array of count decoded instructions,
+// exiting with an error message if that is not possible.
+// The result should be freed with free().
+extern decoded_instr_t *decode_allocate(unsigned int count);
+
+// Requires: out has room for count entries
+// Decode the count instructions in instrs, which start at address 0,
+// into out
+extern void decode_text(decoded_instr_t *out, const bin_instr_t *instrs,
+			unsigned int count);
+
+#endif
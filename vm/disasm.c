@@ -6,6 +6,22 @@
 #include "utilities.h"
 #include "instruction.h"
 
+// Set *symbols to the symbols of bf (after its header has been read),
+// returning symbols, or return NULL if it has none
+static const bof_symbols_t *read_symbols(BOFFILE bf, bof_symbols_t *symbols)
+{
+    size_t size;
+    const void *bytes = bof_read_section(bf, bof_symbols_section, &size);
+    if (bytes == NULL) {
+	return NULL;
+    }
+    const char *error = bof_symbols_open(symbols, bytes, size);
+    if (error != NULL) {
+	bail_with_error("%s", error);
+    }
+    return symbols;
+}
+
 // Disassemble code from bf,
 // with output going to the file out
 void disasmProgram(FILE *out, BOFFILE bf)
@@ -20,19 +36,58 @@ void disasmProgram(FILE *out, BOFFILE bf)
 
 // Disassemble the text section
 // with output going to the file out
+// (with comments giving the source lines of its instructions,
+// if bf has a line table, and with the labels of its symbols
+// for the addresses that have them, if bf has symbols)
 void disasmTextSection(FILE *out, BOFFILE bf, BOFHeader bh)
 {
     fprintf(out, ".text\t%u", bh.text_start_address);
     newline(out);
-    disasmInstrs(out, bf, bh.text_length);
+    lines_t *lines = NULL;
+    size_t size;
+    const void *bytes = bof_read_section(bf, bof_lines_section, &size);
+    if (bytes != NULL) {
+	const char *error = lines_create(&lines, bytes, size, bh.text_length);
+	if (error != NULL) {
+	    bail_with_error("%s", error);
+	}
+    }
+    bof_symbols_t symbols;
+    disasmInstrs(out, bf, bh.text_length, lines, read_symbols(bf, &symbols));
+    lines_destroy(lines);
 }
 
 // Disassemble length instructions from bf
-// with output going to the file out
-void disasmInstrs(FILE *out, BOFFILE bf, int length)
+// with output going to the file out,
+// putting a comment giving the source line (from lines, if it is not NULL)
+// before each instruction from a different line than the one before,
+// and labelling each instruction with its symbol in symbols
+// (if that is not NULL and it has one) instead of a%d
+void disasmInstrs(FILE *out, BOFFILE bf, int length, const lines_t *lines,
+		  const bof_symbols_t *symbols)
 {
+    // (the instructions of a mapped file are read in place)
+    const bin_instr_t *instrs = !bof_is_mapped(bf) ? NULL
+	: bof_read_view(bf, length * sizeof(bin_instr_t));
+    int last_line = -1;
     for (int i = 0; i < length; i++) {
-	disasmInstr(out, instruction_read(bf), i);
+	int line = lines == NULL ? -1 : lines_index(lines, i);
+	if (line >= 0 && line != last_line) {
+	    fprintf(out, "# line %u of %s", lines_number(lines, line),
+		    lines_file(lines, line));
+	    newline(out);
+	}
+	last_line = line;
+	bin_instr_t bi = instrs != NULL ? instrs[i] : instruction_read(bf);
+	uword_type sym = symbols == NULL ? BOF_NO_SYMBOL
+	    : bof_symbols_at(symbols, i);
+	if (sym != BOF_NO_SYMBOL) {
+	    fprintf(out, "%s:\t%s", bof_symbols_name(symbols, sym),
+		    instruction_assembly_form(i, bi));
+	    newline(out);
+	} else {
+	    disasmInstr(out, bi, i);
+	}
     }
 }
 
@@ -46,20 +101,37 @@ void disasmInstr(FILE *out, bin_instr_t bi, address_type i)
 
 // Disassemble the data section from bf, based on the information in bh,
 // with output going to out
+// (naming the words that have data symbols by them, if bf has symbols)
 void disasmDataSection(FILE *out, BOFFILE bf, BOFHeader bh)
 {
     fprintf(out, ".data\t%u", bh.data_start_address);
     newline(out);
-    disasmStaticDecls(out, bf, bh.data_length);
+    bof_symbols_t symbols;
+    disasmStaticDecls(out, bf, bh.data_length, bh.data_start_address,
+		      read_symbols(bf, &symbols));
 }
 
-// Disassemble words_to_read static data words from bf,
-// with output going to out
-void disasmStaticDecls(FILE *out, BOFFILE bf, int words_to_read)
+// Disassemble words_to_read static data words from bf, which start
+// at the word address start, with output going to out,
+// naming each word by its data symbol in symbols
+// (if that is not NULL and it has one)
+void disasmStaticDecls(FILE *out, BOFFILE bf, int words_to_read,
+		       address_type start, const bof_symbols_t *symbols)
 {
-    while (words_to_read >= 1) {
-	disasmStaticDecl(out, bof_read_word(bf));
-	words_to_read--;
+    // (the words of a mapped file are read in place)
+    const word_type *words = !bof_is_mapped(bf) ? NULL
+	: bof_read_view(bf, words_to_read * BYTES_PER_WORD);
+    for (int i = 0; i < words_to_read; i++) {
+	word_type w = words != NULL ? words[i] : bof_read_word(bf);
+	uword_type sym = symbols == NULL ? BOF_NO_SYMBOL
+	    : bof_symbols_at(symbols, start + i);
+	if (sym != BOF_NO_SYMBOL
+	    && symbols->symbols[sym].kind == bof_data_symbol) {
+	    fprintf(out, "WORD %s = %d", bof_symbols_name(symbols, sym), w);
+	    newline(out);
+	} else {
+	    disasmStaticDecl(out, w);
+	}
     }
 }
 
@@ -2,6 +2,7 @@
 #ifndef _DISASM_H
 #define _DISASM_H
 #include "instruction.h"
+#include "lines.h"
 
 // Disassemble code from bf,
 // with output going to the file out
@@ -9,11 +10,19 @@ extern void disasmProgram(FILE *out, BOFFILE bf);
 
 // Disassemble the text section
 // with output going to the file out
+// (with comments giving the source lines of its instructions,
+// if bf has a line table, and with the labels of its symbols
+// for the addresses that have them, if bf has symbols)
 extern void disasmTextSection(FILE *out, BOFFILE bf, BOFHeader bh);
 
 // Disassemble length instructions from bf
-// with output going to the file out
-extern void disasmInstrs(FILE *out, BOFFILE bf, int length);
+// with output going to the file out,
+// putting a comment giving the source line (from lines, if it is not NULL)
+// before each instruction from a different line than the one before,
+// and labelling each instruction with its symbol in symbols
+// (if that is not NULL and it has one) instead of a%d
+extern void disasmInstrs(FILE *out, BOFFILE bf, int length,
+			 const lines_t *lines, const bof_symbols_t *symbols);
 
 // Disassemble the binary instruction bi, which would go at address i
 // each instruction has a label of the form a%d, where %d is the value of i
@@ -21,11 +30,16 @@ extern void disasmInstr(FILE *out, bin_instr_t bi, address_type i);
 
 // Disassemble the data section from bf, based on the information in bh,
 // with output going to out
+// (naming the words that have data symbols by them, if bf has symbols)
 extern void disasmDataSection(FILE *out, BOFFILE bf, BOFHeader bh);
 
-// Disassemble words_to_read static data words from bf,
-// with output going to out
-extern void disasmStaticDecls(FILE *out, BOFFILE bf, int words_to_read);
+// Disassemble words_to_read static data words from bf, which start
+// at the word address start, with output going to out,
+// naming each word by its data symbol in symbols
+// (if that is not NULL and it has one)
+extern void disasmStaticDecls(FILE *out, BOFFILE bf, int words_to_read,
+			      address_type start,
+			      const bof_symbols_t *symbols);
 
 // Disassemble the the given word as a static data declaration,
 // with output going to out
@@ -24,7 +24,7 @@ int main(int argc, char *argv[]) {
     // name of the file to read
     const char *bofname = argv[0];
     
-    BOFFILE bf = bof_read_open(bofname);
+    BOFFILE bf = bof_map_open(bofname);
 
     disasmProgram(stdout, bf);
     
@@ -0,0 +1,158 @@
+/* $Id$ */
+#include <stdio.h>
+#include "fusion.h"
+#include "utilities.h"
+
+// A pattern of decoded instructions that is replaced by a superinstruction
+typedef struct {
+    decoded_op fused;
+    const char *name;
+    unsigned int length;
+    decoded_op ops[FUSION_MAX_LENGTH];
+} fusion_pattern_t;
+
+// The patterns, longest first (so longer sequences win).
+// These are the sequences the SPL compiler emits most often:
+// the activation record prologue and epilogue (from
+// code_utils_save_registers_for_AR and code_utils_restore_registers_from_AR),
+// the frame pointer chains of code_utils_compute_fp,
+// and the pushes and pops around expressions.
+static const fusion_pattern_t patterns[] = {
+    {DOP_F_SAVE_AR, "SWR+SWR+SWR+SWR+CPR+SRI", 6,
+     {DOP_SWR, DOP_SWR, DOP_SWR, DOP_SWR, DOP_CPR, DOP_SRI}},
+    {DOP_F_RESTORE_AR, "LWR+LWR+LWR+CPR", 4,
+     {DOP_LWR, DOP_LWR, DOP_LWR, DOP_CPR}},
+    {DOP_F_CPR_LWR, "CPR+LWR", 2, {DOP_CPR, DOP_LWR}},
+    {DOP_F_LWR_LWR, "LWR+LWR", 2, {DOP_LWR, DOP_LWR}},
+    {DOP_F_SRI_CPW, "SRI+CPW", 2, {DOP_SRI, DOP_CPW}},
+    {DOP_F_SRI_LIT, "SRI+LIT", 2, {DOP_SRI, DOP_LIT}},
+    {DOP_F_ADD_ARI, "ADD+ARI", 2, {DOP_ADD, DOP_ARI}},
+    {DOP_F_SUB_ARI, "SUB+ARI", 2, {DOP_SUB, DOP_ARI}},
+    {DOP_F_CPW_ARI, "CPW+ARI", 2, {DOP_CPW, DOP_ARI}},
+};
+
+#define NUM_PATTERNS (sizeof(patterns) / sizeof(patterns[0]))
+
+// Return the pattern for the superinstruction op
+static const fusion_pattern_t *pattern_for(decoded_op op)
+{
+    for (int p = 0; p < NUM_PATTERNS; p++) {
+	if (patterns[p].fused == op) {
+	    return &patterns[p];
+	}
+    }
+    bail_with_error("No fusion pattern for decoded op %d!", op);
+    return NULL; // should never happen
+}
+
+// Requires: op is a superinstruction (DECODE_IS_FUSED(op))
+// Return the number of instructions that op executes
+unsigned int fusion_length(decoded_op op)
+{
+    return pattern_for(op)->length;
+}
+
+// Requires: op is a superinstruction (DECODE_IS_FUSED(op))
+//           and k < fusion_length(op)
+// Return the (plain) op of the k-th instruction that op executes
+decoded_op fusion_op(decoded_op op, unsigned int k)
+{
+    return pattern_for(op)->ops[k];
+}
+
+// Requires: op is a superinstruction (DECODE_IS_FUSED(op))
+// Return a printable name for op, such as "SRI+CPW"
+const char *fusion_name(decoded_op op)
+{
+    return pattern_for(op)->name;
+}
+
+// Does the pattern pat match the instructions in decoded
+// starting at index i (where decoded has count entries)?
+// (Instructions marked by the verifier match their own ops.)
+static bool matches(const fusion_pattern_t *pat,
+		    const decoded_instr_t *decoded, unsigned int count,
+		    unsigned int i)
+{
+    if (i + pat->length > count) {
+	return false;
+    }
+    for (int k = 0; k < pat->length; k++) {
+	if (DECODE_OP(&decoded[i+k]) != pat->ops[k]) {
+	    return false;
+	}
+    }
+    return true;
+}
+
+// Does any instruction in the sequence that the pattern pat matches
+// in decoded, starting at index i, need checks when it runs?
+static bool needs_checks(const fusion_pattern_t *pat,
+			 const decoded_instr_t *decoded, unsigned int i)
+{
+    for (int k = 0; k < pat->length; k++) {
+	if (decoded[i+k].op == DOP_CHECK) {
+	    return true;
+	}
+    }
+    return false;
+}
+
+// Requires: decoded holds the count decoded instructions of a text section
+//           and sites has DOP_NUM_OPS elements
+// Replace the op of the first instruction of each sequence in decoded
+// that matches a superinstruction's pattern with that superinstruction,
+// leaving the other instructions of the sequence decoded as they were
+// (so that jumps into the middle of a sequence still work).
+// Sequences do not overlap, and the longest pattern is tried first.
+// If an instruction of a sequence needs checks when it runs (see verify.h),
+// the superinstruction is put in its first entry's checked field instead.
+// For each superinstruction op, sites[op] is set to
+// the number of sequences replaced by it.
+void fusion_apply(decoded_instr_t *decoded, unsigned int count,
+		  unsigned int *sites)
+{
+    for (int op = 0; op < DOP_NUM_OPS; op++) {
+	sites[op] = 0;
+    }
+    unsigned int i = 0;
+    while (i < count) {
+	unsigned int advance = 1;
+	for (int p = 0; p < NUM_PATTERNS; p++) {
+	    if (matches(&patterns[p], decoded, count, i)) {
+		if (needs_checks(&patterns[p], decoded, i)) {
+		    decoded[i].op = DOP_CHECK;
+		    decoded[i].checked = patterns[p].fused;
+		} else {
+		    decoded[i].op = patterns[p].fused;
+		}
+		sites[patterns[p].fused]++;
+		advance = patterns[p].length;
+		break;
+	    }
+	}
+	i += advance;
+    }
+}
+
+// Requires: sites and executions have DOP_NUM_OPS elements
+// Print a table of the superinstructions, with the number of sites
+// where each was applied and the number of times each was executed, on out
+void fusion_print_stats(FILE *out, const unsigned int *sites,
+			const unsigned long *executions)
+{
+    unsigned long total_execs = 0;
+    unsigned long total_instrs = 0;
+    fprintf(out, "%-24s %8s %12s %12s\n",
+	    "Superinstruction", "Sites", "Executions", "Instructions");
+    for (int p = 0; p < NUM_PATTERNS; p++) {
+	decoded_op op = patterns[p].fused;
+	unsigned long instrs = executions[op] * patterns[p].length;
+	fprintf(out, "%-24s %8u %12lu %12lu\n",
+		patterns[p].name, sites[op], executions[op], instrs);
+	total_execs += executions[op];
+	total_instrs += instrs;
+    }
+    fprintf(out, "%-24s %8s %12lu %12lu\n",
+	    "Total", "", total_execs, total_instrs);
+}
@@ -0,0 +1,44 @@
+/* $Id$ */
+// Superinstructions: load-time fusion of common instruction sequences
+#ifndef _FUSION_H
+#define _FUSION_H
+#include <stdio.h>
+#include "decode.h"
+
+// the maximum number of instructions fused into one superinstruction
+#define FUSION_MAX_LENGTH 6
+
+// Requires: op is a superinstruction (DECODE_IS_FUSED(op))
+// Return the number of instructions that op executes
+extern unsigned int fusion_length(decoded_op op);
+
+// Requires: op is a superinstruction (DECODE_IS_FUSED(op))
+//           and k < fusion_length(op)
+// Return the (plain) op of the k-th instruction that op executes
+extern decoded_op fusion_op(decoded_op op, unsigned int k);
+
+// Requires: op is a superinstruction (DECODE_IS_FUSED(op))
+// Return a printable name for op, such as "SRI+CPW"
+extern const char *fusion_name(decoded_op op);
+
+// Requires: decoded holds the count decoded instructions of a text section
+//           and sites has DOP_NUM_OPS elements
+// Replace the op of the first instruction of each sequence in decoded
+// that matches a superinstruction's pattern with that superinstruction,
+// leaving the other instructions of the sequence decoded as they were
+// (so that jumps into the middle of a sequence still work).
+// Sequences do not overlap, and the longest pattern is tried first.
+// If an instruction of a sequence needs checks when it runs (see verify.h),
+// the superinstruction is put in its first entry's checked field instead.
+// For each superinstruction op, sites[op] is set to
+// the number of sequences replaced by it.
+extern void fusion_apply(decoded_instr_t *decoded, unsigned int count,
+			 unsigned int *sites);
+
+// Requires: sites and executions have DOP_NUM_OPS elements
+// Print a table of the superinstructions, with the number of sites
+// where each was applied and the number of times each was executed, on out
+extern void fusion_print_stats(FILE *out, const unsigned int *sites,
+			       const unsigned long *executions);
+
+#endif
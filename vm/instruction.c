@@ -14,7 +14,7 @@
 extern char *strdup(const char *s);
 
 // space to hold one instruction's assembly language form
-static char instr_buf[INSTR_BUF_SIZE];
+static _Thread_local char instr_buf[INSTR_BUF_SIZE];
 
 // Return the instruction type of the given opcode 
 instr_type instruction_type(bin_instr_t i) {
@@ -51,7 +51,7 @@ instr_type instruction_type(bin_instr_t i) {
 bin_instr_t instruction_read(BOFFILE bf)
 {
     bin_instr_t bi;
-    size_t rd = fread(&bi, sizeof(bi), 1, bf.fileptr);
+    size_t rd = bof_read_bytes(bf, sizeof(bi), &bi) / sizeof(bi);
     if (rd != 1) {
 	bail_with_error("Cannot read instruction from %s (read %d instrs)",
 			bf.filename, rd);
@@ -64,10 +64,7 @@ bin_instr_t instruction_read(BOFFILE bf)
 // but exit with an error if there is a problem.
 static void write_bin_instr(BOFFILE bf, bin_instr_t i)
 {
-    size_t wr = fwrite(&i, sizeof(i), 1, bf.fileptr);
-    if (wr != 1) {
-	bail_with_error("Cannot write binary instr to %s", bf.filename);
-    }
+    bof_write_bytes(bf, sizeof(i), &i);
 }
 
 // Requires: bof is open for writing in binary
@@ -255,7 +252,7 @@ const char *instruction_mnemonic(bin_instr_t bi) {
     return NULL;  // should never happen
 }
 
-static char address_comment_buf[512];
+static _Thread_local char address_comment_buf[512];
 
 // return a comment string of the form
 // "# target is word address %u"
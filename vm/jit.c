@@ -0,0 +1,824 @@
+/* $Id$ */
+// mmap's MAP_ANONYMOUS is only declared for -std=c17 with _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "jit.h"
+#include "decode.h"
+#include "regname.h"
+#include "verify.h"
+#include "utilities.h"
+
+// Native code is only generated for x86-64 hosts that use
+// the System V calling convention (where the arguments of a jit_code_t
+// arrive in rdi, rsi, and rdx, and the result is returned in eax)
+#if defined(__x86_64__) && !defined(_WIN32)
+#define JIT_NATIVE 1
+#include <sys/mman.h>
+#endif
+
+// an upper bound on the bytes of native code for one instruction
+#define JIT_MAX_INSTR_BYTES 96
+
+// the bytes of native code for one exit from a block (see emit_exit)
+#define JIT_EXIT_BYTES 14
+
+// the bytes of native code that return to the interpreter
+// before an instruction (see emit_interpret)
+#define JIT_INTERPRET_BYTES 16
+
+// An exit from a block to the start of another block, whose jump
+// (a jmp rel32) goes to the other block's native code once there is some
+typedef struct {
+    unsigned char *rel;  // the 32-bit displacement of the jump
+    int next;		 // the index of the next exit to the same address
+} jit_site_t;
+
+struct jit_s {
+    // the text section (in the VM's memory) and its length in words
+    const bin_instr_t *text;
+    unsigned int text_words;
+    // what the verifier knows about the text section
+    const verify_state_t *vs;
+
+    // for each address in the text section: does a basic block start there,
+    // and what is the address of the start of the block that contains it?
+    bool *is_start;
+    address_type *block_start;
+
+    // for each address that starts a block, its native code (or NULL),
+    // the number of instructions translated into that code,
+    // and the number of times the block was entered while not translated
+    jit_code_t *native;
+    unsigned int *lengths;
+    unsigned int *entries;
+    // for each address that starts a block, where the other blocks
+    // jump into its native code (or NULL), and the index in sites
+    // of the first exit of a block that goes there (or -1)
+    unsigned char **chain_entry;
+    int *site_heads;
+
+    // the exits from blocks to the starts of blocks (chained through
+    // their next fields), the number of them, and the room for them
+    jit_site_t *sites;
+    unsigned int num_sites;
+    unsigned int sites_capacity;
+
+    // the start of the block being translated
+    address_type translating;
+
+    // the executable buffer, the number of bytes used in it,
+    // and where the next byte of native code goes
+    unsigned char *buffer;
+    size_t buffer_used;
+    unsigned char *emit_ptr;
+
+    // statistics, for jit_print_stats
+    unsigned long blocks_translated;
+    unsigned long blocks_invalidated;
+    unsigned long buffer_flushes;
+    unsigned long exits_chained;
+    size_t bytes_generated;
+};
+
+// Can native code be generated on this host?
+bool jit_available()
+{
+#ifdef JIT_NATIVE
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Does d go to the address d->target (when it jumps)?
+static bool has_target(const decoded_instr_t *d)
+{
+    switch (d->op) {
+    case DOP_BEQ: case DOP_BGEZ: case DOP_BGTZ: case DOP_BLEZ:
+    case DOP_BLTZ: case DOP_BNE:
+    case DOP_JMPA: case DOP_CALL: case DOP_JREL:
+	return true;
+    default:
+	return false;
+    }
+}
+
+// Does d go to an address it finds when it runs (in a register or memory)?
+static bool is_indirect(const decoded_instr_t *d)
+{
+    return d->op == DOP_JMP || d->op == DOP_CSI || d->op == DOP_RTN;
+}
+
+// Can d be translated into native code?
+// (System calls, illegal instructions, and instructions
+// that must be checked when they run (see verify.h)
+// are always executed by the interpreter.)
+static bool translatable(const jit_t *j, const decoded_instr_t *d)
+{
+    if (verify_checks(j->vs, d) != 0) {
+	return false;
+    }
+    switch (d->op) {
+    case DOP_CSI:
+	// (its address would depend on the RA it sets)
+	return d->ra != RA;
+    case DOP_EXIT: case DOP_PSTR: case DOP_PINT: case DOP_PCH: case DOP_RCH:
+    case DOP_STRA: case DOP_NOTR:
+    case DOP_INVALID: case DOP_UNDECODED:
+	return false;
+    default:
+	return true;
+    }
+}
+
+// Does d end a basic block (so a new one starts after it)?
+static bool ends_block(const jit_t *j, const decoded_instr_t *d)
+{
+    return has_target(d) || is_indirect(d) || !translatable(j, d);
+}
+
+// Forget all native code, so the buffer can be reused
+static void forget_native_code(jit_t *j)
+{
+    for (unsigned int a = 0; a < j->text_words; a++) {
+	j->native[a] = NULL;
+	j->entries[a] = 0;
+	j->chain_entry[a] = NULL;
+	j->site_heads[a] = -1;
+    }
+    j->num_sites = 0;
+    j->buffer_used = 0;
+}
+
+// Return a zeroed array of count elements of the given size,
+// exiting with an error message if that is not possible
+static void *allocate(unsigned int count, size_t size)
+{
+    // calloc may return NULL for 0 elements
+    void *ret = calloc(count + 1, size);
+    if (ret == NULL) {
+	bail_with_error("Cannot allocate space for the JIT's tables!");
+    }
+    return ret;
+}
+
+// Return a new JIT, with no text section and no native code,
+// exiting with an error message if that is not possible
+jit_t *jit_create()
+{
+    jit_t *ret = calloc(1, sizeof(jit_t));
+    if (ret == NULL) {
+	bail_with_error("Cannot allocate a JIT!");
+    }
+    return ret;
+}
+
+// Free the JIT j and its native code
+void jit_destroy(jit_t *j)
+{
+    if (j == NULL) {
+	return;
+    }
+    free(j->is_start);
+    free(j->block_start);
+    free(j->native);
+    free(j->lengths);
+    free(j->entries);
+    free(j->chain_entry);
+    free(j->site_heads);
+    free(j->sites);
+#ifdef JIT_NATIVE
+    if (j->buffer != NULL) {
+	munmap(j->buffer, JIT_BUFFER_BYTES);
+    }
+#endif
+    free(j);
+}
+
+// Requires: instrs is the VM's memory, whose first count words
+// are the text section, which vs has verified
+// Find the basic blocks of the text section and forget all native code
+void jit_prepare(jit_t *j, const bin_instr_t *instrs, unsigned int count,
+		 const verify_state_t *vs)
+{
+    j->text = instrs;
+    j->text_words = count;
+    j->vs = vs;
+    free(j->is_start);
+    free(j->block_start);
+    free(j->native);
+    free(j->lengths);
+    free(j->entries);
+    free(j->chain_entry);
+    free(j->site_heads);
+    j->is_start = allocate(count, sizeof(bool));
+    j->block_start = allocate(count, sizeof(address_type));
+    j->native = allocate(count, sizeof(jit_code_t));
+    j->lengths = allocate(count, sizeof(unsigned int));
+    j->entries = allocate(count, sizeof(unsigned int));
+    j->chain_entry = allocate(count, sizeof(unsigned char *));
+    j->site_heads = allocate(count, sizeof(int));
+
+    // blocks start at address 0, at each jump target,
+    // and after each instruction that ends a block
+    if (count > 0) {
+	j->is_start[0] = true;
+    }
+    for (address_type a = 0; a < count; a++) {
+	decoded_instr_t d = decode_instr(a, instrs[a]);
+	if (has_target(&d) && d.target < count) {
+	    j->is_start[d.target] = true;
+	}
+	if (ends_block(j, &d) && a + 1 < count) {
+	    j->is_start[a + 1] = true;
+	}
+    }
+    address_type current = 0;
+    for (address_type a = 0; a < count; a++) {
+	if (j->is_start[a]) {
+	    current = a;
+	}
+	j->block_start[a] = current;
+    }
+
+#ifdef JIT_NATIVE
+    if (j->buffer == NULL) {
+	j->buffer = mmap(NULL, JIT_BUFFER_BYTES, PROT_READ | PROT_WRITE,
+			 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (j->buffer == MAP_FAILED) {
+	    j->buffer = NULL;
+	    bail_with_error("Cannot map %d bytes for the JIT's code!",
+			    JIT_BUFFER_BYTES);
+	}
+    }
+#endif
+    forget_native_code(j);
+}
+
+// Is the instruction at addr the first instruction of a basic block?
+bool jit_is_block_start(const jit_t *j, address_type addr)
+{
+    return addr < j->text_words && j->is_start[addr];
+}
+
+#ifdef JIT_NATIVE
+// The code templates.
+// While a block runs, rdi holds the address of the VM's memory,
+// rsi the address of the GPRs, r11 the address of the HI/LO registers,
+// r10 the address of the budget, and r9 the budget (which is stored
+// back when the code returns); eax, ecx, edx, and r8d are
+// scratch registers. Each exit from a block subtracts the number of
+// instructions it executed from the budget, and a block is only entered
+// (from another block) if the budget has room for all of its instructions.
+// A GPR is addressed as [rsi + 4*r] (with an 8-bit displacement)
+// and a memory word as [rdi + 4*rcx].
+
+// Emit the byte b
+static inline void emit1(jit_t *j, unsigned int b)
+{
+    *j->emit_ptr++ = (unsigned char) b;
+}
+
+// Emit the 32-bit word w, in little-endian order
+static inline void emit4(jit_t *j, uint32_t w)
+{
+    memcpy(j->emit_ptr, &w, sizeof(w));
+    j->emit_ptr += sizeof(w);
+}
+
+// Emit the 64-bit word w, in little-endian order
+static inline void emit8(jit_t *j, uint64_t w)
+{
+    memcpy(j->emit_ptr, &w, sizeof(w));
+    j->emit_ptr += sizeof(w);
+}
+
+// mov [r10], r9 ; ret (so the code returns, with the budget stored back)
+static void emit_ret(jit_t *j)
+{
+    emit1(j, 0x4D); emit1(j, 0x89); emit1(j, 0x0A);
+    emit1(j, 0xC3);
+}
+
+// mov eax, imm ; ret (so the block returns imm), in 9 bytes
+static void emit_return(jit_t *j, address_type imm)
+{
+    emit1(j, 0xB8); emit4(j, imm);
+    emit_ret(j);
+}
+
+// sub r9, n (so the budget counts n instructions executed)
+static void emit_count(jit_t *j, unsigned int n)
+{
+    emit1(j, 0x49); emit1(j, 0x81); emit1(j, 0xE9); emit4(j, n);
+}
+
+// Return from the block so that the interpreter executes
+// the instruction at addr (after those before it in the block),
+// in JIT_INTERPRET_BYTES bytes
+static void emit_interpret(jit_t *j, address_type addr)
+{
+    emit_count(j, addr - j->translating);
+    emit_return(j, addr | JIT_INTERPRET);
+}
+
+// Point the jump whose 32-bit displacement is at rel to dest
+static void set_jump(unsigned char *rel, const unsigned char *dest)
+{
+    int32_t disp = (int32_t) (dest - (rel + sizeof(disp)));
+    memcpy(rel, &disp, sizeof(disp));
+}
+
+// Remember that the jump whose displacement is at rel goes to
+// the native code of the block that starts at target, once it has some
+static void add_site(jit_t *j, address_type target, unsigned char *rel)
+{
+    if (j->num_sites == j->sites_capacity) {
+	unsigned int capacity = j->sites_capacity == 0
+	    ? 1024 : 2 * j->sites_capacity;
+	jit_site_t *s = realloc(j->sites, capacity * sizeof(jit_site_t));
+	if (s == NULL) {
+	    bail_with_error("Cannot allocate space for the JIT's tables!");
+	}
+	j->sites = s;
+	j->sites_capacity = capacity;
+    }
+    j->sites[j->num_sites].rel = rel;
+    j->sites[j->num_sites].next = j->site_heads[target];
+    j->site_heads[target] = j->num_sites;
+    j->num_sites++;
+}
+
+// Leave the block for the instruction at target (after subtracting
+// the instructions executed from the budget), in JIT_EXIT_BYTES bytes:
+// jmp rel32 ; mov eax, target ; ret. If target starts a block,
+// the jump goes straight to that block's native code whenever it has
+// some (so the blocks are chained); otherwise it goes to the return.
+static void emit_exit(jit_t *j, address_type target)
+{
+    emit1(j, 0xE9);
+    unsigned char *rel = j->emit_ptr;
+    emit4(j, 0);				// jmp to the return
+    emit_return(j, target);
+    if (target < j->text_words && j->is_start[target]) {
+	add_site(j, target, rel);
+	if (j->chain_entry[target] != NULL) {
+	    set_jump(rel, j->chain_entry[target]);
+	    j->exits_chained++;
+	}
+    }
+}
+
+// mov eax, GPR[r]
+static void emit_gpr_to_eax(jit_t *j, unsigned int r)
+{
+    emit1(j, 0x8B); emit1(j, 0x46); emit1(j, 4 * r);
+}
+
+// mov GPR[r], eax
+static void emit_eax_to_gpr(jit_t *j, unsigned int r)
+{
+    emit1(j, 0x89); emit1(j, 0x46); emit1(j, 4 * r);
+}
+
+// ecx = GPR[r] + off (the address of a memory operand)
+static void emit_address(jit_t *j, unsigned int r, int off)
+{
+    emit1(j, 0x8B); emit1(j, 0x4E); emit1(j, 4 * r);	// mov ecx, GPR[r]
+    if (off != 0) {
+	emit1(j, 0x81); emit1(j, 0xC1); emit4(j, off);	// add ecx, off
+    }
+}
+
+// eax = memory.words[GPR[r] + off]
+static void emit_load_eax(jit_t *j, unsigned int r, int off)
+{
+    emit_address(j, r, off);
+    emit1(j, 0x48); emit1(j, 0x63); emit1(j, 0xC9);	// movsxd rcx, ecx
+    emit1(j, 0x8B); emit1(j, 0x04); emit1(j, 0x8F);	// mov eax, [rdi + 4*rcx]
+}
+
+// r8d = memory.words[GPR[r] + off]
+static void emit_load_r8d(jit_t *j, unsigned int r, int off)
+{
+    emit_address(j, r, off);
+    emit1(j, 0x48); emit1(j, 0x63); emit1(j, 0xC9);	// movsxd rcx, ecx
+    emit1(j, 0x44); emit1(j, 0x8B); emit1(j, 0x04); emit1(j, 0x8F); // mov r8d, [...]
+}
+
+// memory.words[GPR[r] + off] = eax, for the instruction at addr;
+// a store into the text section instead returns to the interpreter,
+// which executes the instruction (and invalidates what it overwrites)
+static void emit_store_eax(jit_t *j, unsigned int r, int off, address_type addr)
+{
+    emit_address(j, r, off);
+    emit1(j, 0x81); emit1(j, 0xF9); emit4(j, j->text_words);	// cmp ecx, text_words
+    emit1(j, 0x73); emit1(j, JIT_INTERPRET_BYTES);	// jae over the return
+    emit_interpret(j, addr);
+    emit1(j, 0x89); emit1(j, 0x04); emit1(j, 0x8F);	// mov [rdi + 4*rcx], eax
+}
+
+// eax = eax op r8d, where op is the opcode of a
+// "op r/m32, r32" instruction (such as 0x01 for add)
+static void emit_op_eax_r8d(jit_t *j, unsigned int opcode)
+{
+    emit1(j, 0x44); emit1(j, opcode); emit1(j, 0xC0);
+}
+
+// the short conditional jump opcodes of the conditional branches
+#define JE 0x74
+#define JNE 0x75
+#define JL 0x7C
+#define JGE 0x7D
+#define JLE 0x7E
+#define JG 0x7F
+
+// Leave the block for d->target if the flags satisfy the condition
+// of the short jump opcode jcc, and for next otherwise
+// (the budget must already count the branch)
+static void emit_branch(jit_t *j, const decoded_instr_t *d, unsigned int jcc,
+			address_type next)
+{
+    emit1(j, jcc); emit1(j, JIT_EXIT_BYTES);	// jcc over the exit to next
+    emit_exit(j, next);
+    emit_exit(j, d->target);
+}
+
+// Return from the block so that the interpreter executes the jump at addr
+// (which leaves the text section) if the address in eax
+// is not in the text section
+static void emit_check_text(jit_t *j, address_type addr)
+{
+    emit1(j, 0x3D); emit4(j, j->text_words);	// cmp eax, text_words
+    emit1(j, 0x72); emit1(j, JIT_INTERPRET_BYTES);	// jb over the return
+    emit_interpret(j, addr);
+}
+
+// Leave the block for the instruction whose address (in the text section)
+// is in eax (the budget must already count the jump): jump straight
+// to the native code of the block that starts there, if it has some
+// (looking it up in chain_entry), and otherwise return eax
+static void emit_indirect_exit(jit_t *j)
+{
+    emit1(j, 0x48); emit1(j, 0xB9);		// mov rcx, chain_entry
+    emit8(j, (uint64_t) (uintptr_t) j->chain_entry);
+    emit1(j, 0x48); emit1(j, 0x8B); emit1(j, 0x0C); emit1(j, 0xC1); // mov rcx, [rcx + 8*rax]
+    emit1(j, 0x48); emit1(j, 0x85); emit1(j, 0xC9);	// test rcx, rcx
+    emit1(j, 0x74); emit1(j, 0x02);		// jz over the jmp
+    emit1(j, 0xFF); emit1(j, 0xE1);		// jmp rcx
+    emit_ret(j);
+}
+
+// Emit the template for the instruction d, found at addr.
+// Return true if the template ends the block (by returning).
+static bool emit_instr(jit_t *j, const decoded_instr_t *d, address_type addr)
+{
+    switch (d->op) {
+    case DOP_NOP:
+	break;
+    case DOP_ADD: case DOP_SUB: case DOP_AND: case DOP_BOR:
+    case DOP_NOR: case DOP_XOR:
+	emit_load_eax(j, SP, 0);
+	emit_load_r8d(j, d->rb, d->ob);
+	switch (d->op) {
+	case DOP_ADD:
+	    emit_op_eax_r8d(j, 0x01);
+	    break;
+	case DOP_SUB:
+	    emit_op_eax_r8d(j, 0x29);
+	    break;
+	case DOP_AND:
+	    emit_op_eax_r8d(j, 0x21);
+	    break;
+	case DOP_BOR:
+	    emit_op_eax_r8d(j, 0x09);
+	    break;
+	case DOP_NOR:
+	    emit_op_eax_r8d(j, 0x09);
+	    emit1(j, 0xF7); emit1(j, 0xD0);		// not eax
+	    break;
+	default: // DOP_XOR
+	    emit_op_eax_r8d(j, 0x31);
+	    break;
+	}
+	emit_store_eax(j, d->ra, d->oa, addr);
+	break;
+    case DOP_CPW:
+	emit_load_eax(j, d->rb, d->ob);
+	emit_store_eax(j, d->ra, d->oa, addr);
+	break;
+    case DOP_CPR:
+	emit_gpr_to_eax(j, d->rb);
+	emit_eax_to_gpr(j, d->ra);
+	break;
+    case DOP_LWR:
+	emit_load_eax(j, d->rb, d->ob);
+	emit_eax_to_gpr(j, d->ra);
+	break;
+    case DOP_SWR:
+	emit_gpr_to_eax(j, d->rb);
+	emit_store_eax(j, d->ra, d->oa, addr);
+	break;
+    case DOP_SCA:
+	emit_gpr_to_eax(j, d->rb);
+	emit1(j, 0x05); emit4(j, d->ob);		// add eax, ob
+	emit_store_eax(j, d->ra, d->oa, addr);
+	break;
+    case DOP_LWI:
+	emit_load_eax(j, d->rb, d->ob);
+	emit1(j, 0x48); emit1(j, 0x63); emit1(j, 0xC8);	// movsxd rcx, eax
+	emit1(j, 0x8B); emit1(j, 0x04); emit1(j, 0x8F);	// mov eax, [rdi + 4*rcx]
+	emit_store_eax(j, d->ra, d->oa, addr);
+	break;
+    case DOP_NEG:
+	emit_load_eax(j, d->rb, d->ob);
+	emit1(j, 0xF7); emit1(j, 0xD8);		// neg eax
+	emit_store_eax(j, d->ra, d->oa, addr);
+	break;
+    case DOP_LIT:
+	emit1(j, 0xB8); emit4(j, d->imm);		// mov eax, imm
+	emit_store_eax(j, d->ra, d->oa, addr);
+	break;
+    case DOP_ARI:
+	emit1(j, 0x81); emit1(j, 0x46); emit1(j, 4 * d->ra); emit4(j, d->imm); // add
+	break;
+    case DOP_SRI:
+	emit1(j, 0x81); emit1(j, 0x6E); emit1(j, 4 * d->ra); emit4(j, d->imm); // sub
+	break;
+    case DOP_MUL:
+	emit_load_eax(j, SP, 0);
+	emit_load_r8d(j, d->ra, d->oa);
+	emit1(j, 0x48); emit1(j, 0x63); emit1(j, 0xC0);	// movsxd rax, eax
+	emit1(j, 0x4D); emit1(j, 0x63); emit1(j, 0xC0);	// movsxd r8, r8d
+	emit1(j, 0x49); emit1(j, 0x0F); emit1(j, 0xAF); emit1(j, 0xC0); // imul rax, r8
+	emit1(j, 0x49); emit1(j, 0x89); emit1(j, 0x03);	// mov [r11], rax
+	break;
+    case DOP_DIV:
+	// division by zero is reported by the interpreter
+	emit_load_r8d(j, d->ra, d->oa);
+	emit1(j, 0x45); emit1(j, 0x85); emit1(j, 0xC0);	// test r8d, r8d
+	emit1(j, 0x75); emit1(j, JIT_INTERPRET_BYTES);	// jnz over the return
+	emit_interpret(j, addr);
+	emit_load_eax(j, SP, 0);
+	emit1(j, 0x99);				// cdq
+	emit1(j, 0x41); emit1(j, 0xF7); emit1(j, 0xF8);	// idiv r8d
+	emit1(j, 0x41); emit1(j, 0x89); emit1(j, 0x03);	// mov LO, eax
+	emit1(j, 0x41); emit1(j, 0x89); emit1(j, 0x53); emit1(j, 0x04); // mov HI, edx
+	break;
+    case DOP_CFHI:
+	emit1(j, 0x41); emit1(j, 0x8B); emit1(j, 0x43); emit1(j, 0x04); // mov eax, HI
+	emit_store_eax(j, d->ra, d->oa, addr);
+	break;
+    case DOP_CFLO:
+	emit1(j, 0x41); emit1(j, 0x8B); emit1(j, 0x03);	// mov eax, LO
+	emit_store_eax(j, d->ra, d->oa, addr);
+	break;
+    case DOP_SLL:
+	// the processor masks the shift count, as it does in the interpreter
+	emit_load_eax(j, SP, 0);
+	emit1(j, 0xC1); emit1(j, 0xE0); emit1(j, d->imm & 0xFF);	// shl eax, imm
+	emit_store_eax(j, d->ra, d->oa, addr);
+	break;
+    case DOP_SRL:
+	emit_load_eax(j, SP, 0);
+	emit1(j, 0xC1); emit1(j, 0xE8); emit1(j, d->imm & 0xFF);	// shr eax, imm
+	emit_store_eax(j, d->ra, d->oa, addr);
+	break;
+    case DOP_ADDI: case DOP_ANDI: case DOP_BORI: case DOP_NORI: case DOP_XORI:
+	emit_load_eax(j, d->ra, d->oa);
+	switch (d->op) {
+	case DOP_ADDI:
+	    emit1(j, 0x05);			// add eax, imm
+	    break;
+	case DOP_ANDI:
+	    emit1(j, 0x25);			// and eax, imm
+	    break;
+	case DOP_XORI:
+	    emit1(j, 0x35);			// xor eax, imm
+	    break;
+	default: // DOP_BORI and DOP_NORI
+	    emit1(j, 0x0D);			// or eax, imm
+	    break;
+	}
+	emit4(j, d->imm);
+	if (d->op == DOP_NORI) {
+	    emit1(j, 0xF7); emit1(j, 0xD0);		// not eax
+	}
+	emit_store_eax(j, d->ra, d->oa, addr);
+	break;
+    case DOP_BEQ: case DOP_BNE:
+	// (the count changes the flags, so it comes before the comparison)
+	emit_count(j, addr + 1 - j->translating);
+	emit_load_eax(j, SP, 0);
+	emit_load_r8d(j, d->ra, d->oa);
+	emit_op_eax_r8d(j, 0x39);			// cmp eax, r8d
+	emit_branch(j, d, d->op == DOP_BEQ ? JE : JNE, addr + 1);
+	return true;
+    case DOP_BGEZ: case DOP_BGTZ: case DOP_BLEZ: case DOP_BLTZ:
+	emit_count(j, addr + 1 - j->translating);
+	emit_load_eax(j, d->ra, d->oa);
+	emit1(j, 0x85); emit1(j, 0xC0);		// test eax, eax
+	switch (d->op) {
+	case DOP_BGEZ:
+	    emit_branch(j, d, JGE, addr + 1);
+	    break;
+	case DOP_BGTZ:
+	    emit_branch(j, d, JG, addr + 1);
+	    break;
+	case DOP_BLEZ:
+	    emit_branch(j, d, JLE, addr + 1);
+	    break;
+	default: // DOP_BLTZ
+	    emit_branch(j, d, JL, addr + 1);
+	    break;
+	}
+	return true;
+    case DOP_CALL:
+	emit1(j, 0xC7); emit1(j, 0x46); emit1(j, 4 * RA); emit4(j, addr + 1); // mov RA
+	emit_count(j, addr + 1 - j->translating);
+	emit_exit(j, d->target);
+	return true;
+    case DOP_JMPA: case DOP_JREL:
+	emit_count(j, addr + 1 - j->translating);
+	emit_exit(j, d->target);
+	return true;
+    case DOP_JMP:
+	emit_load_eax(j, d->ra, d->oa);
+	emit_check_text(j, addr);
+	emit_count(j, addr + 1 - j->translating);
+	emit_indirect_exit(j);
+	return true;
+    case DOP_CSI:
+	emit_load_eax(j, d->ra, d->oa);
+	emit_check_text(j, addr);
+	emit1(j, 0xC7); emit1(j, 0x46); emit1(j, 4 * RA); emit4(j, addr + 1); // mov RA
+	emit_count(j, addr + 1 - j->translating);
+	emit_indirect_exit(j);
+	return true;
+    case DOP_RTN:
+	emit_gpr_to_eax(j, RA);
+	emit_check_text(j, addr);
+	emit_count(j, addr + 1 - j->translating);
+	emit_indirect_exit(j);
+	return true;
+    default:
+	bail_with_error("No JIT template for decoded op %d!", d->op);
+	break;
+    }
+    return false;
+}
+
+// Translate the block that starts at start into native code,
+// and return that code (or NULL if its first instruction
+// must be executed by the interpreter). The exits of the blocks
+// already translated that go to start then jump straight to it.
+static jit_code_t translate(jit_t *j, address_type start)
+{
+    decoded_instr_t d = decode_instr(start, j->text[start]);
+    if (!translatable(j, &d)) {
+	return NULL;
+    }
+    // (the prologue and the last exit take less than one instruction)
+    size_t needed = (JIT_MAX_BLOCK_LENGTH + 1) * JIT_MAX_INSTR_BYTES;
+    if (j->buffer_used + needed > JIT_BUFFER_BYTES) {
+	forget_native_code(j);
+	j->buffer_flushes++;
+    }
+    if (mprotect(j->buffer, JIT_BUFFER_BYTES, PROT_READ | PROT_WRITE) != 0) {
+	bail_with_error("Cannot make the JIT's code buffer writable!");
+    }
+    unsigned char *code = j->buffer + j->buffer_used;
+    j->emit_ptr = code;
+    j->translating = start;
+    emit1(j, 0x49); emit1(j, 0x89); emit1(j, 0xD3);	// mov r11, rdx
+    emit1(j, 0x49); emit1(j, 0x89); emit1(j, 0xCA);	// mov r10, rcx
+    emit1(j, 0x4C); emit1(j, 0x8B); emit1(j, 0x09);	// mov r9, [rcx]
+    // where other blocks enter: return start if the budget has no room
+    // for this block (whose length is filled in below)
+    unsigned char *entry = j->emit_ptr;
+    emit1(j, 0x49); emit1(j, 0x81); emit1(j, 0xF9);	// cmp r9, length
+    unsigned char *length_ptr = j->emit_ptr;
+    emit4(j, 0);
+    emit1(j, 0x73); emit1(j, 0x09);			// jae over the return
+    emit_return(j, start);
+    address_type addr = start;
+    bool ended = false;
+    for (unsigned int n = 0; n < JIT_MAX_BLOCK_LENGTH; n++) {
+	if (addr >= j->text_words || (addr != start && j->is_start[addr])) {
+	    break;
+	}
+	d = decode_instr(addr, j->text[addr]);
+	if (!translatable(j, &d)) {
+	    break;
+	}
+	ended = emit_instr(j, &d, addr);
+	addr++;
+	if (ended) {
+	    break;
+	}
+    }
+    if (!ended) {
+	emit_count(j, addr - start);
+	emit_exit(j, addr);
+    }
+    j->lengths[start] = addr - start;
+    uint32_t length = addr - start;
+    memcpy(length_ptr, &length, sizeof(length));
+    j->chain_entry[start] = entry;
+    for (int s = j->site_heads[start]; s >= 0; s = j->sites[s].next) {
+	set_jump(j->sites[s].rel, entry);
+	j->exits_chained++;
+    }
+    j->buffer_used += j->emit_ptr - code;
+    j->bytes_generated += j->emit_ptr - code;
+    j->blocks_translated++;
+    if (mprotect(j->buffer, JIT_BUFFER_BYTES, PROT_READ | PROT_EXEC) != 0) {
+	bail_with_error("Cannot make the JIT's code buffer executable!");
+    }
+    // ISO C has no cast from an object pointer to a function pointer
+    jit_code_t ret;
+    memcpy(&ret, &code, sizeof(ret));
+    return ret;
+}
+
+// Make the exits of blocks that go to start return to the interpreter
+// again, as start's native code is being forgotten
+static void unchain(jit_t *j, address_type start)
+{
+    if (j->site_heads[start] < 0) {
+	return;
+    }
+    if (mprotect(j->buffer, JIT_BUFFER_BYTES, PROT_READ | PROT_WRITE) != 0) {
+	bail_with_error("Cannot make the JIT's code buffer writable!");
+    }
+    for (int s = j->site_heads[start]; s >= 0; s = j->sites[s].next) {
+	set_jump(j->sites[s].rel, j->sites[s].rel + sizeof(int32_t));
+    }
+    if (mprotect(j->buffer, JIT_BUFFER_BYTES, PROT_READ | PROT_EXEC) != 0) {
+	bail_with_error("Cannot make the JIT's code buffer executable!");
+    }
+}
+#else
+// Without native code generation, no block is ever translated
+static jit_code_t translate(jit_t *j, address_type start)
+{
+    return NULL;
+}
+
+// Without native code generation, no blocks are chained
+static void unchain(jit_t *j, address_type start)
+{
+}
+#endif
+
+// Requires: addr is the address of the next instruction to execute
+// Return the native code for the block that starts at addr,
+// translating it if it has now become hot, or NULL if there is none
+// (in which case the block should be interpreted)
+jit_code_t jit_enter(jit_t *j, address_type addr)
+{
+    if (!jit_is_block_start(j, addr)) {
+	return NULL;
+    }
+    if (j->native[addr] == NULL && ++j->entries[addr] >= JIT_HOT_THRESHOLD) {
+	j->native[addr] = translate(j, addr);
+	j->entries[addr] = 0;
+    }
+    return j->native[addr];
+}
+
+// Requires: jit_enter(j, addr) just returned native code
+// Return the number of instructions that the native code of the block
+// that starts at addr executes when it runs to its end
+unsigned int jit_block_length(const jit_t *j, address_type addr)
+{
+    return j->lengths[addr];
+}
+
+// Requires: addr is in the text section
+// Forget the native code for the block that contains addr
+// (and unchain the blocks that jump to it),
+// because the instruction at addr is being overwritten
+void jit_invalidate(jit_t *j, address_type addr)
+{
+    address_type start = j->block_start[addr];
+    if (j->native[start] != NULL) {
+	unchain(j, start);
+	j->native[start] = NULL;
+	j->chain_entry[start] = NULL;
+	j->entries[start] = 0;
+	j->blocks_invalidated++;
+    }
+}
+
+// Print the number of blocks translated, invalidated, and chained,
+// and the size of the generated code, to out
+void jit_print_stats(const jit_t *j, FILE *out)
+{
+    fprintf(out, "JIT: %lu blocks translated (%lu bytes of code), "
+	    "%lu invalidated, %lu exits chained, %lu buffer flushes\n",
+	    j->blocks_translated, (unsigned long) j->bytes_generated,
+	    j->blocks_invalidated, j->exits_chained, j->buffer_flushes);
+}
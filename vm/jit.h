@@ -0,0 +1,88 @@
+/* $Id$ */
+// A template JIT that translates hot basic blocks of the text section
+// into native x86-64 code
+#ifndef _JIT_H
+#define _JIT_H
+#include <stdio.h>
+#include <stdbool.h>
+#include "machine_types.h"
+#include "instruction.h"
+#include "verify.h"
+
+// the number of times a block is entered before it is translated
+#define JIT_HOT_THRESHOLD 50
+
+// the most instructions translated into one native block
+#define JIT_MAX_BLOCK_LENGTH 256
+
+// the size (in bytes) of the executable buffer for native code
+#define JIT_BUFFER_BYTES (4 * 1024 * 1024)
+
+// set in the address returned by a block when the interpreter
+// must execute the instruction at that address
+#define JIT_INTERPRET 0x80000000u
+
+// Native code for a block. It runs the block's instructions using
+// the VM's memory (words), registers (gpr), and HI/LO registers (hilo),
+// subtracting the number of instructions it executes from *budget,
+// and returns the address of the next instruction to execute.
+// Requires: *budget is at least the block's length (see jit_block_length).
+// A block whose jump, branch, or fall-through goes to a block
+// with native code jumps straight into that code (the blocks are chained),
+// if *budget has room for all of that block's instructions,
+// so one call may run many blocks. (A direct jump's code is patched
+// when its target is translated; JMP, CSI, and RTN look up the code
+// of their target when they run.)
+// A block never executes a system call;
+// it returns the address of such an instruction instead,
+// so the interpreter can execute it.
+// A block also stops before a DIV by zero or a store into the text section,
+// returning that instruction's address with JIT_INTERPRET set
+// (as the address may be the start of this block).
+typedef address_type (*jit_code_t)(word_type *words, word_type *gpr,
+				   long *hilo, unsigned long *budget);
+
+// The JIT's tables and native code for one machine's text section
+typedef struct jit_s jit_t;
+
+// Can native code be generated on this host?
+extern bool jit_available();
+
+// Return a new JIT, with no text section and no native code,
+// exiting with an error message if that is not possible
+extern jit_t *jit_create();
+
+// Free the JIT j and its native code
+extern void jit_destroy(jit_t *j);
+
+// Requires: instrs is the VM's memory, whose first count words
+// are the text section, which vs has verified
+// Find the basic blocks of the text section and forget all native code
+extern void jit_prepare(jit_t *j, const bin_instr_t *instrs,
+			unsigned int count, const verify_state_t *vs);
+
+// Is the instruction at addr the first instruction of a basic block?
+extern bool jit_is_block_start(const jit_t *j, address_type addr);
+
+// Requires: addr is the address of the next instruction to execute
+// Return the native code for the block that starts at addr,
+// translating it if it has now become hot, or NULL if there is none
+// (in which case the block should be interpreted)
+extern jit_code_t jit_enter(jit_t *j, address_type addr);
+
+// Requires: jit_enter(j, addr) just returned native code
+// Return the number of instructions that the native code of the block
+// that starts at addr executes when it runs to its end
+extern unsigned int jit_block_length(const jit_t *j, address_type addr);
+
+// Requires: addr is in the text section
+// Forget the native code for the block that contains addr
+// (and unchain the blocks that jump to it),
+// because the instruction at addr is being overwritten
+extern void jit_invalidate(jit_t *j, address_type addr);
+
+// Print the number of blocks translated, invalidated, and chained,
+// and the size of the generated code, to out
+extern void jit_print_stats(const jit_t *j, FILE *out);
+
+#endif
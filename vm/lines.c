@@ -0,0 +1,248 @@
+/* $Id$ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bof.h"
+#include "lines.h"
+#include "utilities.h"
+
+// a line of a source file
+typedef struct {
+    const char *file;
+    unsigned int line;
+} source_line_t;
+
+struct lines_s {
+    // the length of the text section
+    unsigned int text_words;
+    // for each address in the text section, the index in source
+    // of the line its instruction came from (or -1 if none)
+    int *of_addr;
+    // the different source lines (count of them), in order
+    // of their files' names and then their line numbers
+    source_line_t *source;
+    unsigned int count;
+    // the names of the source files (which source points into)
+    char *names;
+};
+
+// an entry of the table and its source line, for sorting
+typedef struct {
+    const char *file;
+    unsigned int line;
+    unsigned int entry;
+} entry_key_t;
+
+// a source line and its total count, for sorting
+typedef struct {
+    unsigned int index;
+    unsigned long total;
+} line_total_t;
+
+// Compare the entry_key_t values pointed to by a and b
+// by their files' names and then their line numbers
+static int compare_keys(const void *a, const void *b)
+{
+    const entry_key_t *x = a;
+    const entry_key_t *y = b;
+    int c = strcmp(x->file, y->file);
+    if (c != 0) {
+	return c;
+    }
+    return x->line < y->line ? -1 : (x->line > y->line);
+}
+
+// Compare the line_total_t values pointed to by a and b by their totals,
+// so qsort puts the largest first (and equal totals in order of index)
+static int compare_totals(const void *a, const void *b)
+{
+    const line_total_t *x = a;
+    const line_total_t *y = b;
+    if (x->total != y->total) {
+	return x->total > y->total ? -1 : 1;
+    }
+    return x->index < y->index ? -1 : (x->index > y->index);
+}
+
+// Free the line table lt (if it is not NULL)
+void lines_destroy(lines_t *lt)
+{
+    if (lt != NULL) {
+	free(lt->of_addr);
+	free(lt->source);
+	free(lt->names);
+	free(lt);
+    }
+}
+
+// Return the error message msg, after freeing lt and setting *result
+// to NULL
+static const char *fail(lines_t **result, lines_t *lt, const char *msg)
+{
+    lines_destroy(lt);
+    *result = NULL;
+    return msg;
+}
+
+// Read the line table of a program whose text section is text_words
+// words long from the size bytes at bytes (a bof_lines_section),
+// and set *result to it. Return an error message (and set *result to NULL)
+// if it is not a valid line table, otherwise return NULL.
+const char *lines_create(lines_t **result, const void *bytes,
+			 size_t size, unsigned int text_words)
+{
+    const unsigned char *b = bytes;
+    uword_type n;
+    if (size < sizeof(n)) {
+	return fail(result, NULL, "The line table has no number of entries!");
+    }
+    memcpy(&n, b, sizeof(n));
+    if (n > (size - sizeof(n)) / sizeof(BOFLineEntry)) {
+	return fail(result, NULL, "The entries of the line table "
+		    "do not fit in it!");
+    }
+    const unsigned char *names = b + sizeof(n) + n * sizeof(BOFLineEntry);
+    size_t names_size = size - sizeof(n) - n * sizeof(BOFLineEntry);
+    if (n > 0 && (names_size == 0 || names[names_size - 1] != '\0')) {
+	return fail(result, NULL, "The names of the files in the line table "
+		    "do not end with a null character!");
+    }
+
+    lines_t *lt = calloc(1, sizeof(lines_t));
+    if (lt == NULL) {
+	bail_with_error("Cannot allocate a line table!");
+    }
+    lt->text_words = text_words;
+    // (at least 1 of each, so malloc does not return NULL)
+    lt->of_addr = malloc((text_words + 1) * sizeof(int));
+    lt->names = malloc(names_size + 1);
+    lt->source = malloc((n + 1) * sizeof(source_line_t));
+    entry_key_t *keys = malloc((n + 1) * sizeof(entry_key_t));
+    BOFLineEntry *entries = malloc((n + 1) * sizeof(BOFLineEntry));
+    if (lt->of_addr == NULL || lt->names == NULL || lt->source == NULL
+	|| keys == NULL || entries == NULL) {
+	bail_with_error("Cannot allocate a line table of %u entries!", n);
+    }
+    memcpy(lt->names, names, names_size);
+    memcpy(entries, b + sizeof(n), n * sizeof(BOFLineEntry));
+
+    // check the entries, and sort them by their source lines
+    for (uword_type e = 0; e < n; e++) {
+	if (entries[e].start >= text_words
+	    || (e > 0 && entries[e].start <= entries[e - 1].start)) {
+	    free(keys);
+	    free(entries);
+	    return fail(result, lt, "The entries of the line table are not "
+			"in order of their addresses in the text section!");
+	}
+	if (entries[e].file >= names_size) {
+	    free(keys);
+	    free(entries);
+	    return fail(result, lt, "An entry of the line table names a file "
+			"that is not in it!");
+	}
+	keys[e].file = lt->names + entries[e].file;
+	keys[e].line = entries[e].line;
+	keys[e].entry = e;
+    }
+    qsort(keys, n, sizeof(entry_key_t), compare_keys);
+
+    // number the different source lines, and give each entry its number
+    int *index = malloc((n + 1) * sizeof(int));
+    if (index == NULL) {
+	bail_with_error("Cannot allocate a line table of %u entries!", n);
+    }
+    for (uword_type k = 0; k < n; k++) {
+	if (keys[k].line == 0) {
+	    index[keys[k].entry] = -1;
+	    continue;
+	}
+	if (lt->count == 0 || compare_keys(&keys[k], &keys[k - 1]) != 0
+	    || keys[k - 1].line == 0) {
+	    lt->source[lt->count].file = keys[k].file;
+	    lt->source[lt->count].line = keys[k].line;
+	    lt->count++;
+	}
+	index[keys[k].entry] = lt->count - 1;
+    }
+
+    // each entry's source line is that of the addresses up to the next
+    for (address_type a = 0; a < text_words; a++) {
+	lt->of_addr[a] = -1;
+    }
+    for (uword_type e = 0; e < n; e++) {
+	address_type end = e + 1 < n ? entries[e + 1].start : text_words;
+	for (address_type a = entries[e].start; a < end; a++) {
+	    lt->of_addr[a] = index[e];
+	}
+    }
+    free(index);
+    free(keys);
+    free(entries);
+    *result = lt;
+    return NULL;
+}
+
+// Return the number of different source lines in lt
+unsigned int lines_count(const lines_t *lt)
+{
+    return lt->count;
+}
+
+// Return the index of the source line that the instruction at addr
+// came from, or -1 if addr is not in the text section or has no source line
+int lines_index(const lines_t *lt, address_type addr)
+{
+    return addr < lt->text_words ? lt->of_addr[addr] : -1;
+}
+
+// Requires: 0 <= index < lines_count(lt)
+// Return the name of the file of the source line with the given index
+const char *lines_file(const lines_t *lt, int index)
+{
+    return lt->source[index].file;
+}
+
+// Requires: 0 <= index < lines_count(lt)
+// Return the line number of the source line with the given index
+unsigned int lines_number(const lines_t *lt, int index)
+{
+    return lt->source[index].line;
+}
+
+// Requires: counts has an entry for each address in the text section of lt
+// Print to out the counts totalled by source line, the largest
+// LINES_HOT_COUNT first, in the form "line 12 of sieve.spl: 38.00% of what"
+void lines_print_totals(const lines_t *lt, FILE *out,
+			const unsigned long *counts, const char *what)
+{
+    line_total_t *totals = calloc(lt->count + 1, sizeof(line_total_t));
+    if (totals == NULL) {
+	bail_with_error("Cannot allocate space to total the source lines!");
+    }
+    unsigned long total = 0;
+    for (unsigned int i = 0; i < lt->count; i++) {
+	totals[i].index = i;
+    }
+    for (address_type a = 0; a < lt->text_words; a++) {
+	total += counts[a];
+	if (lt->of_addr[a] >= 0) {
+	    totals[lt->of_addr[a]].total += counts[a];
+	}
+    }
+    if (total == 0) {
+	free(totals);
+	return;
+    }
+    qsort(totals, lt->count, sizeof(line_total_t), compare_totals);
+    fprintf(out, "By source line:\n");
+    for (unsigned int i = 0; i < LINES_HOT_COUNT && i < lt->count; i++) {
+	if (totals[i].total == 0) {
+	    break;
+	}
+	const source_line_t *s = &lt->source[totals[i].index];
+	fprintf(out, "line %u of %s: %.2f%% of %s (%lu)\n", s->line, s->file,
+		100.0 * totals[i].total / total, what, totals[i].total);
+    }
+    free(totals);
+}
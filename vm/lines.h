@@ -0,0 +1,53 @@
+/* $Id$ */
+// Line tables: the lines of the source files that the instructions
+// of a program's text section were compiled from (read from the
+// optional bof_lines_section of its binary object file, see bof.h),
+// so that traces and profiles can be read in terms of the source
+#ifndef _LINES_H
+#define _LINES_H
+#include <stdio.h>
+#include "machine_types.h"
+
+// the number of the most executed source lines printed by lines_print_totals
+#define LINES_HOT_COUNT 20
+
+// The line table of one program
+typedef struct lines_s lines_t;
+
+// Read the line table of a program whose text section is text_words
+// words long from the size bytes at bytes (a bof_lines_section),
+// which need not stay around afterwards, and set *lt to it.
+// Return an error message (and set *lt to NULL)
+// if it is not a valid line table, otherwise return NULL.
+// Exit with an error message if there is no space for it.
+extern const char *lines_create(lines_t **lt, const void *bytes,
+				size_t size, unsigned int text_words);
+
+// Free the line table lt (if it is not NULL)
+extern void lines_destroy(lines_t *lt);
+
+// Return the number of different source lines (pairs of a file's name
+// and a line number) in lt
+extern unsigned int lines_count(const lines_t *lt);
+
+// Return the index (less than lines_count(lt)) of the source line
+// that the instruction at addr came from,
+// or -1 if addr is not in the text section or has no source line
+extern int lines_index(const lines_t *lt, address_type addr);
+
+// Requires: 0 <= index < lines_count(lt)
+// Return the name of the file of the source line with the given index
+extern const char *lines_file(const lines_t *lt, int index);
+
+// Requires: 0 <= index < lines_count(lt)
+// Return the line number of the source line with the given index
+extern unsigned int lines_number(const lines_t *lt, int index);
+
+// Requires: counts has an entry for each address in the text section of lt
+// Print to out the counts totalled by source line, the largest
+// LINES_HOT_COUNT first, in the form "line 12 of sieve.spl: 38.00% of what"
+// (as a percentage of the counts in the text section)
+extern void lines_print_totals(const lines_t *lt, FILE *out,
+			       const unsigned long *counts, const char *what);
+
+#endif
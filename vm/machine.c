@@ -1,260 +1,2329 @@
 /* $Id: machine.c,v 1.49 2024/11/10 22:47:50 leavens Exp leavens $ */
+// mmap's MAP_ANONYMOUS is only declared for -std=c17 with _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
+#include <stdarg.h>
+#include <limits.h>
+#include <setjmp.h>
 #include <assert.h>
+#include <stdatomic.h>
 #include "machine_types.h"
 #include "machine.h"
+#include "decode.h"
+#include "fusion.h"
+#include "jit.h"
+#include "verify.h"
+#include "profile.h"
+#include "sampler.h"
+#include "lines.h"
+#include "vmio.h"
+#include "btrace.h"
 #include "regname.h"
 #include "utilities.h"
 
+// The memory is mapped (so untouched pages take no space, a snapshot
+// can be mapped over it copy-on-write, and a guard page follows it)
+// on hosts that have mmap, and otherwise allocated
+#if defined(__unix__) || defined(__APPLE__)
+#define MACHINE_MMAP 1
+#include <sys/mman.h>
+#include <signal.h>
+#include <unistd.h>
+#endif
+
 #define MAX_PRINT_WIDTH 59
 
+#define    REGFORMAT1 "GPR[%-3s]: %-5d"
+#define    REGFORMAT2 "\tGPR[%-3s]: %-5d"
+
 // the VM's memory, in signed and unsigned word and binary instruction views.
-static union mem_u {
-    word_type words[MEMORY_SIZE_IN_WORDS];
-    uword_type uwords[MEMORY_SIZE_IN_WORDS];
-    bin_instr_t instrs[MEMORY_SIZE_IN_WORDS];
-} memory;
-
-// general purpose registers
-static word_type GPR[NUM_REGISTERS];
+// Its size is only known when a program is loaded, so these arrays are
+// as long as the largest memory, of which just the machine's memory_words
+// (followed by the guard words, see verify.h) are mapped.
+union mem_u {
+    word_type words[MACHINE_MAX_MEMORY_WORDS];
+    uword_type uwords[MACHINE_MAX_MEMORY_WORDS];
+    bin_instr_t instrs[MACHINE_MAX_MEMORY_WORDS];
+};
+
+// where the memory starts in a snapshot's image file
+// (a multiple of the page size of every host)
+#define IMAGE_MEMORY_OFFSET 65536
+
+// the words in a page of the memory, for recording which pages are written
+// (so restoring a snapshot need only copy those)
+#define PAGE_WORDS 1024
+
+// the flight recorder keeps the address and encoding of the last
+// FLIGHT_RECORDS instructions dispatched (a power of 2), with the
+// registers before every FLIGHT_SNAPSHOT_INTERVAL-th one, to print
+// when the program fails (see machine_print_flight_record).
+// Building with -DMACHINE_NO_FLIGHT_RECORDER turns it off.
+#define FLIGHT_RECORDS 64
+#define FLIGHT_SNAPSHOT_INTERVAL 16
+
+// the value a run's on_error jump has when the program's input would block
+// (machine_error's has the value 1)
+#define BLOCKED_JUMP 2
+
+// A breakpoint: the address of its instruction, and the decoded entry
+// that its DOP_BREAK entry replaced
+typedef struct {
+    address_type addr;
+    decoded_instr_t saved;
+} breakpoint_t;
+
+// A watchpoint: the count words starting at word address addr
+typedef struct {
+    address_type addr;
+    unsigned int count;
+} watchpoint_t;
+
+// An instruction dispatched, as kept by the flight recorder
+typedef struct {
+    address_type pc;
+    uword_type instr;
+} flight_entry_t;
+
+// The registers (and HI and LO) before an instruction dispatched
+typedef struct {
+    word_type GPR[NUM_REGISTERS];
+    long hilo;
+} flight_registers_t;
+
 // hi and lo registers used in multiplication and division.
 // A view as a (signed) long int (result, 64 bits)
 // and as an array (hilo) of 2 32-bit ints.
-static union longAs2words_u {
+union longAs2words_u {
     long result;
     word_type hilo[2]; 
-} hilo_regs;
+};
 
 // LO is index 0, HI is index 1, for an x86 architecture
 // (because the x86 is little-endian)
 #define LO 0
 #define HI 1
 
-// the program counter
-static address_type PC;
+// The state of a machine.
+// (The fields used by the run loops come first.)
+struct machine_s {
+    // general purpose registers
+    word_type GPR[NUM_REGISTERS];
+    // hi and lo registers
+    union longAs2words_u hilo_regs;
+
+    // the program counter
+    address_type PC;
+
+    // should the machine be printing tracing output?
+    bool tracing;
+
+    // should the machine be running? (default true)
+    bool running;
+    // the exit code given by the program's EXIT instruction
+    int exit_code;
+
+    // the engine used to run programs when not tracing
+    engine_type engine;
+
+    // should store_word record the addresses it writes in writes
+    // (for the instruction being recorded, see step_recorded)?
+    bool logging_writes;
+    unsigned int num_writes;
+    address_type writes[BTRACE_MAX_WORDS];
+
+    // the flight recorder: the number of instructions dispatched
+    // since the program was loaded (or restored), the last of them
+    // (the one dispatched n-th is in flight[n % FLIGHT_RECORDS]),
+    // and the registers before each one that is the first
+    // of FLIGHT_SNAPSHOT_INTERVAL in flight
+    unsigned long flight_count;
+    flight_entry_t flight[FLIGHT_RECORDS];
+    flight_registers_t flight_registers[FLIGHT_RECORDS
+					/ FLIGHT_SNAPSHOT_INTERVAL];
+
+    // the decoded form of each of the instruction_words instructions
+    // in the text section (indexed by word address), followed by
+    // a DOP_INVALID entry, which is reached when the PC runs off the end
+    // of the text (so the threaded loop need not check for that)
+    decoded_instr_t *decoded;
+
+    // the VM's memory, which is memory_words long
+    union mem_u *memory;
+    // which pages of the memory (and the guard words after it)
+    // have been written by the interpreter since the last snapshot
+    // was taken of or restored into the machine
+    bool *dirty;
+
+    // words of instructions (based on the header)
+    address_type instruction_words;
+    // words of global data (based on the header)
+    address_type global_data_words;
+
+    // initial_stack_bottom is used for tracing
+    address_type initial_stack_bottom;
+    // the header of the loaded program
+    BOFHeader header;
+
+    // should superinstructions be formed when loading? (default true)
+    bool fusing;
+    // for each superinstruction, the number of places it was used
+    // in the loaded program, and the number of times it was executed
+    unsigned int fusion_sites[DOP_NUM_OPS];
+    unsigned long fusion_executions[DOP_NUM_OPS];
+
+    // should executions of each instruction be counted? (default false)
+    bool profiling;
+    // the profile of the loaded program (when profiling)
+    profile_t *profile;
+    // the number of samples taken per second of CPU time by the
+    // sampling profiler (0 when it is off), and its samples
+    unsigned int sample_rate;
+    sampler_t *sampler;
+
+    // the line table of the loaded program (or NULL if it has none),
+    // and the index of the source line of the instruction last traced
+    // (or -1)
+    lines_t *lines;
+    int traced_line;
+    // the symbols of the loaded program, read from a copy
+    // of its symbols section (symbol_bytes, or NULL if it has none)
+    unsigned char *symbol_bytes;
+    bof_symbols_t symbols;
+
+    // the JIT (created when a program is loaded for the JIT engine)
+    jit_t *jit;
+
+    // what the verifier knows about the loaded program
+    verify_state_t verify;
+
+    // the size of the memory, in words
+    address_type memory_words;
+    // the size of memory given by machine_set_memory_size (or 0)
+    address_type memory_limit;
+    // the pages holding the memory (region_bytes long), which ends
+    // where the region ends, followed by guard_bytes of read-only
+    // zero pages (see on_fault), which hold the guard words
+    unsigned char *region;
+    size_t region_bytes;
+    size_t guard_bytes;
+
+    // the binary trace being recorded (or NULL), and the address
+    // and flags of the instruction being recorded (for an error in it)
+    btrace_t *btrace;
+    address_type recording_pc;
+    unsigned int recording_flags;
+
+    // should the text trace show just what each instruction changed
+    // (see step_delta), with the whole state every keyframe_interval
+    // instructions traced (if that is not 0)?
+    bool delta_tracing;
+    unsigned long keyframe_interval;
+    unsigned long since_keyframe;
+
+    // the buffers that the system calls read the program's input
+    // from and write its output to (from in and to out)
+    vmio_t *buffers;
+    // the streams used for the program's input and output,
+    // and for error messages (which are not printed if err is NULL)
+    FILE *in;
+    FILE *out;
+    FILE *err;
+    // the callbacks for the input and output system calls
+    // (those that are NULL use the streams)
+    machine_io_t io;
+
+    // where machine_error goes (in the functions that load and run
+    // programs), when catching is true (and where a run goes when
+    // the program's input would block, with the value BLOCKED_JUMP)
+    jmp_buf on_error;
+    bool catching;
+    // did the last load or run stop with an error, and if so, what was it?
+    bool failed;
+    char error_message[MACHINE_ERROR_SIZE];
+
+    // the id of the snapshot last taken of or restored into the machine,
+    // if its text section has not been written since then (so the decoded
+    // program and the JIT's code are still right for a restore of it),
+    // otherwise 0
+    unsigned long snapshot_id;
+
+    // the breakpoints (MACHINE_MAX_BREAKPOINTS of them, allocated when
+    // the first is set), of which num_breakpoints are in use,
+    // and the watchpoints, whose pages are only readable during runs
+    breakpoint_t *breakpoints;
+    unsigned int num_breakpoints;
+    watchpoint_t watchpoints[MACHINE_MAX_WATCHPOINTS];
+    unsigned int num_watchpoints;
+    // did the last run stop at a breakpoint or after a store
+    // into a watched word (see machine_run_steps)?
+    bool stopped;
+    // the store into a watched page that on_fault let go ahead:
+    // the page (or NULL if there is none), whether the word stored into
+    // (at watch_addr) is watched, and what it held before,
+    // and the entry (at watch_pc) that DOP_WATCH replaced, if any.
+    // (These are set in a signal handler.)
+    unsigned char *volatile watch_page;
+    volatile bool watch_hit;
+    volatile address_type watch_addr;
+    volatile word_type watch_old;
+    volatile bool watch_patched;
+    volatile address_type watch_pc;
+    decoded_instr_t watch_saved;
+    // the size of the host's pages (which are protected one by one)
+    size_t watch_page_bytes;
+};
+
+// The header at the start of a snapshot's image file,
+// which is followed (at offset IMAGE_MEMORY_OFFSET) by the region
+// holding the memory
+typedef struct {
+    // should hold SNAPSHOT_MAGIC
+    char magic[8];
+    // the size of the memory, and of the region holding it
+    // (which depends on the page size of the host)
+    address_type memory_words;
+    unsigned long region_bytes;
+    // the header of the program
+    BOFHeader header;
+    // the registers
+    word_type GPR[NUM_REGISTERS];
+    long hilo;
+    address_type PC;
+} snapshot_header_t;
+
+#define SNAPSHOT_MAGIC "SSMSNAP"
+
+// the id of the last snapshot taken or opened (by any thread)
+static atomic_ulong last_snapshot_id = 0;
+
+struct machine_snapshot_s {
+    // a number that identifies the snapshot (even after it is destroyed)
+    unsigned long id;
+    // the image file, which is mapped into the memory of machines
+    FILE *image;
+    // the image's header
+    snapshot_header_t header;
+    // the region holding the image's memory (a read-only mapping
+    // of the file, or a copy of it on hosts without mmap),
+    // and that memory, which pages are copied from
+    const unsigned char *region;
+    const union mem_u *memory;
+};
+
+static _Noreturn void machine_error(machine_t *m, const char *fmt, ...);
+
+// Return n rounded up to a multiple of the host's page size
+static size_t round_to_pages(size_t n)
+{
+#ifdef MACHINE_MMAP
+    size_t page = (size_t) sysconf(_SC_PAGESIZE);
+    return (n + page - 1) / page * page;
+#else
+    return n;
+#endif
+}
+
+// Free the memory of m (if it has any)
+static void memory_unmap(machine_t *m)
+{
+    if (m->region != NULL) {
+#ifdef MACHINE_MMAP
+	munmap(m->region, m->region_bytes + m->guard_bytes);
+#else
+	free(m->region);
+#endif
+	m->region = NULL;
+    }
+}
+
+// Return the number of pages of m's memory and guard words
+// (the length of m->dirty)
+static size_t dirty_pages(const machine_t *m)
+{
+    return (m->memory_words + VERIFY_GUARD_WORDS + PAGE_WORDS - 1) / PAGE_WORDS;
+}
+
+// the machine that is running a program on this thread (or NULL)
+static _Thread_local machine_t *running_machine = NULL;
+
+#ifdef MACHINE_MMAP
+// the action for SIGSEGV before on_fault was installed
+static struct sigaction previous_fault_action;
+static atomic_flag fault_handler_installed = ATOMIC_FLAG_INIT;
+
+// Print the flight record of the machine running on this thread
+// (if any) on its error stream (if it has one), as the signal sig
+// stops it, and forget that machine (so it is only printed once)
+static void dump_on_signal(int sig)
+{
+    machine_t *m = running_machine;
+    running_machine = NULL;
+    if (m != NULL && m->err != NULL) {
+	vmio_flush(m->buffers);
+	fflush(m->out);
+	fprintf(m->err, "Signal %d stopped the program!\n", sig);
+	machine_print_flight_record(m, m->err);
+	fflush(m->err);
+    }
+}
+
+// Return the start of the host page of m's memory region that holds addr
+static inline unsigned char *page_of(const machine_t *m,
+				     const unsigned char *addr)
+{
+    return m->region
+	+ (addr - m->region) / m->watch_page_bytes * m->watch_page_bytes;
+}
+
+// Is the word at word address wa in one of m's watchpoints?
+static bool is_watched(const machine_t *m, address_type wa)
+{
+    for (unsigned int i = 0; i < m->num_watchpoints; i++) {
+	const watchpoint_t *w = &m->watchpoints[i];
+	if (w->addr <= wa && wa - w->addr < w->count) {
+	    return true;
+	}
+    }
+    return false;
+}
+
+// Requires: m->watch_page == NULL
+// Let the store into m's memory at addr, which faulted as its page
+// holds a watched word, go ahead: make the page writable, note whether
+// the word stored into is watched (and its value before the store),
+// and replace the entry of the next instruction (at the PC) by DOP_WATCH,
+// which calls end_watched_store once the store has been made.
+// (The run loops that do not dispatch decoded entries call it after
+// each instruction.) An instruction stores at most one word.
+static void begin_watched_store(machine_t *m, unsigned char *addr)
+{
+    m->watch_page = page_of(m, addr);
+    mprotect(m->watch_page, m->watch_page_bytes, PROT_READ | PROT_WRITE);
+    address_type wa = (addr - (unsigned char *) m->memory) / BYTES_PER_WORD;
+    m->watch_hit = is_watched(m, wa);
+    m->watch_addr = wa;
+    m->watch_old = m->memory->words[wa];
+    if (m->PC <= m->instruction_words) {
+	m->watch_pc = m->PC;
+	m->watch_saved = m->decoded[m->PC];
+	m->decoded[m->PC].op = DOP_WATCH;
+	m->watch_patched = true;
+    }
+}
+
+// The handler for SIGSEGV: a store into the guard pages after the memory
+// of the machine running on this thread stops it with an error,
+// so stores that the verifier lets run unchecked cannot go past
+// the end of memory. (The store is made by the machine's own code,
+// never inside a library, so machine_error can longjmp from here.)
+// A store into a page holding a watched word (which is only readable
+// while the machine runs) is let go ahead by begin_watched_store.
+// Any other fault is given to the previous action
+// (after printing the flight record).
+static void on_fault(int sig, siginfo_t *info, void *context)
+{
+    machine_t *m = running_machine;
+    unsigned char *addr = info->si_addr;
+    if (m != NULL && m->catching && m->num_watchpoints > 0
+	&& m->watch_page == NULL && addr >= (unsigned char *) m->memory
+	&& addr < (unsigned char *) &m->memory->words[m->memory_words]) {
+	// the store is made again when this returns
+	begin_watched_store(m, addr);
+	return;
+    }
+    if (m != NULL && m->catching && addr >= m->region + m->region_bytes
+	&& addr < m->region + m->region_bytes + m->guard_bytes) {
+	long wa = (addr - (unsigned char *) m->memory) / BYTES_PER_WORD;
+	machine_error(m, "%s (%ld) %s!",
+		      "Error: the program stores into an address", wa,
+		      "that is outside of memory");
+    }
+    dump_on_signal(sig);
+    // the store faults again, and is handled by the previous action
+    sigaction(SIGSEGV, &previous_fault_action, NULL);
+}
+
+// the other signals that stop a running program (if their action
+// is the default one), and their actions before on_fatal_signal
+static const int fatal_signals[] = {SIGBUS, SIGFPE, SIGILL, SIGABRT,
+				    SIGINT, SIGTERM};
+#define NUM_FATAL_SIGNALS (sizeof(fatal_signals) / sizeof(fatal_signals[0]))
+static struct sigaction previous_fatal_actions[NUM_FATAL_SIGNALS];
+
+// The handler for the fatal signals: print the flight record
+// of the machine running on this thread (if any),
+// then give the signal to its previous (default) action
+static void on_fatal_signal(int sig)
+{
+    dump_on_signal(sig);
+    for (unsigned int i = 0; i < NUM_FATAL_SIGNALS; i++) {
+	if (fatal_signals[i] == sig) {
+	    sigaction(sig, &previous_fatal_actions[i], NULL);
+	}
+    }
+    raise(sig);
+}
+
+// Install on_fault as the handler for SIGSEGV, and on_fatal_signal
+// for those fatal signals whose action is the default
+// (once for the process)
+static void install_fault_handler()
+{
+    if (atomic_flag_test_and_set(&fault_handler_installed)) {
+	return;
+    }
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_sigaction = on_fault;
+    sigemptyset(&sa.sa_mask);
+    // SIGSEGV is not blocked in on_fault, as machine_error leaves it
+    sa.sa_flags = SA_SIGINFO | SA_NODEFER;
+    sigaction(SIGSEGV, &sa, &previous_fault_action);
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_fatal_signal;
+    sigemptyset(&sa.sa_mask);
+    for (unsigned int i = 0; i < NUM_FATAL_SIGNALS; i++) {
+	sigaction(fatal_signals[i], NULL, &previous_fatal_actions[i]);
+	if (previous_fatal_actions[i].sa_handler == SIG_DFL) {
+	    sigaction(fatal_signals[i], &sa, NULL);
+	}
+    }
+}
+#endif
 
-// should the machine be printing tracing output?
-static bool tracing;
+// Make m the machine running a program on this thread (or none, if m is NULL),
+// whose stores into its guard pages are caught by on_fault,
+// and whose flight record is printed if it stops with an error
+static inline void set_running_machine(machine_t *m)
+{
+    running_machine = m;
+}
 
-// initial_stack_bottom is used for tracing
-static address_type initial_stack_bottom;
+// Give m a new, zeroed memory of words words (replacing the one it had),
+// stopping m with an error message if there is no space for it.
+// On hosts with mmap, the pages of the memory take no space
+// (and need no zeroing) until they are used.
+static void memory_map(machine_t *m, address_type words)
+{
+    size_t bytes = (size_t) words * BYTES_PER_WORD;
+    size_t region_bytes = round_to_pages(bytes);
+    size_t guard_bytes = round_to_pages(VERIFY_GUARD_WORDS * BYTES_PER_WORD);
+#ifdef MACHINE_MMAP
+    if (m->region != NULL && m->region_bytes == region_bytes) {
+	// replace the region's pages by new (zero) pages
+	if (mmap(m->region, region_bytes, PROT_READ | PROT_WRITE,
+		 MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED | MAP_NORESERVE,
+		 -1, 0) == MAP_FAILED) {
+	    machine_error(m, "Cannot clear a memory of %u words!", words);
+	}
+    } else {
+	memory_unmap(m);
+	// the guard pages are only readable
+	void *area = mmap(NULL, region_bytes + guard_bytes, PROT_READ,
+			  MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if (area == MAP_FAILED) {
+	    machine_error(m, "Cannot allocate a memory of %u words!", words);
+	}
+	m->region = area;
+	m->region_bytes = region_bytes;
+	m->guard_bytes = guard_bytes;
+	if (mprotect(area, region_bytes, PROT_READ | PROT_WRITE) != 0) {
+	    machine_error(m, "Cannot allocate a memory of %u words!", words);
+	}
+    }
+#else
+    if (m->region != NULL && m->region_bytes == region_bytes) {
+	memset(m->region, 0, region_bytes + guard_bytes);
+    } else {
+	memory_unmap(m);
+	m->region = calloc(1, region_bytes + guard_bytes);
+	if (m->region == NULL) {
+	    machine_error(m, "Cannot allocate a memory of %u words!", words);
+	}
+	m->region_bytes = region_bytes;
+	m->guard_bytes = guard_bytes;
+    }
+#endif
+    // the memory ends where the guard starts
+    m->memory = (union mem_u *) (m->region + region_bytes - bytes);
+    m->memory_words = words;
+    free(m->dirty);
+    m->dirty = calloc(dirty_pages(m), sizeof(bool));
+    if (m->dirty == NULL) {
+	machine_error(m, "Cannot allocate a memory of %u words!", words);
+    }
+}
+
+// Return a new machine, with nothing loaded, that uses the threaded engine
+// (with superinstructions), does not profile, and uses stdin, stdout,
+// and stderr. Exit with an error message if there is no space for it.
+machine_t *machine_create()
+{
+    machine_t *m = calloc(1, sizeof(machine_t));
+    if (m == NULL) {
+	bail_with_error("Cannot allocate a machine!");
+    }
+    m->engine = threaded_engine;
+    m->fusing = true;
+    m->profiling = false;
+    m->in = stdin;
+    m->out = stdout;
+    m->err = stderr;
+    m->buffers = vmio_create();
+    vmio_set_streams(m->buffers, m->in, m->out);
+#ifdef MACHINE_MMAP
+    install_fault_handler();
+#endif
+    memory_map(m, MEMORY_SIZE_IN_WORDS);
+    return m;
+}
+
+// Free the machine m (and its decoded program, JIT, and profile)
+void machine_destroy(machine_t *m)
+{
+    if (m == NULL) {
+	return;
+    }
+    free(m->decoded);
+    jit_destroy(m->jit);
+    profile_destroy(m->profile);
+    sampler_destroy(m->sampler);
+    lines_destroy(m->lines);
+    free(m->symbol_bytes);
+    vmio_destroy(m->buffers);
+    memory_unmap(m);
+    free(m->dirty);
+    free(m->breakpoints);
+    free(m);
+}
+
+// Make the machine m read the program's input from in,
+// write the program's output (and tracing output) to out,
+// and write error messages to err (or not print them, if err is NULL).
+// The streams must stay open until they are replaced (or m is freed).
+// (in and out may be NULL if callbacks handle the program's input
+// and output, see machine_set_io, and it is not traced.)
+void machine_set_streams(machine_t *m, FILE *in, FILE *out, FILE *err)
+{
+    vmio_set_streams(m->buffers, in, out);
+    m->in = in;
+    m->out = out;
+    m->err = err;
+}
+
+// Make the machine m use the callbacks in io (those that are not NULL)
+// for the program's input and output system calls, instead of its streams.
+// If io is NULL, m goes back to using its streams for all of them.
+void machine_set_io(machine_t *m, const machine_io_t *io)
+{
+    if (io == NULL) {
+	memset(&m->io, 0, sizeof(m->io));
+    } else {
+	m->io = *io;
+    }
+}
+
+// Record the error message given (formatted as by printf),
+// and print it and a newline on m's error stream, if it has one
+// (after flushing its output stream), then stop m:
+// if m is loading or running a program, that returns a failure,
+// otherwise exit with a failure code.
+// So a call to this does not return.
+static _Noreturn void machine_error(machine_t *m, const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(m->error_message, MACHINE_ERROR_SIZE, fmt, args);
+    va_end(args);
+    m->failed = true;
+    m->running = false;
+    if (m->err != NULL) {
+	// so output comes after what has happened already
+	vmio_flush(m->buffers);
+	fflush(m->out);
+	fprintf(m->err, "%s\n", m->error_message);
+	if (running_machine == m) {
+	    machine_print_flight_record(m, m->err);
+	}
+	fflush(m->err);
+    }
+    if (m->catching) {
+	m->catching = false;
+	longjmp(m->on_error, 1);
+    }
+    exit(EXIT_FAILURE);
+}
+
+// Requires: wa < instruction_words
+// Undo any superinstruction that includes the instruction at wa
+// (its first instruction will be decoded again when it is executed)
+static void unfuse_at(machine_t *m, address_type wa)
+{
+    address_type lowest = wa < FUSION_MAX_LENGTH ? 0 : wa - FUSION_MAX_LENGTH + 1;
+    for (address_type h = lowest; h < wa; h++) {
+	decoded_op op = DECODE_OP(&m->decoded[h]);
+	if (DECODE_IS_FUSED(op) && h + fusion_length(op) > wa) {
+	    m->decoded[h].op = DOP_UNDECODED;
+	}
+    }
+}
+
+// Return the index of m's breakpoint at address addr, or -1 if it has none
+static int breakpoint_index(const machine_t *m, address_type addr)
+{
+    for (unsigned int b = 0; b < m->num_breakpoints; b++) {
+	if (m->breakpoints[b].addr == addr) {
+	    return (int) b;
+	}
+    }
+    return -1;
+}
+
+// Requires: wa <= instruction_words
+// Return the decoded entry that the entry for word address wa stands for:
+// the one it replaced, if it is a DOP_WATCH or DOP_BREAK entry,
+// and otherwise the entry itself
+static decoded_instr_t *unpatched_entry(machine_t *m, address_type wa)
+{
+    decoded_instr_t *d = &m->decoded[wa];
+    if (d->op == DOP_WATCH) {
+	d = &m->watch_saved;
+    }
+    if (d->op == DOP_BREAK) {
+	d = &m->breakpoints[breakpoint_index(m, wa)].saved;
+    }
+    return d;
+}
+
+// Requires: b < m->num_breakpoints, and no superinstruction
+// includes the breakpoint's instruction after its first
+// Replace the entry for the instruction of m's breakpoint b
+// by a DOP_BREAK entry, saving it (to be decoded again,
+// if it is a superinstruction, so it is executed by itself)
+static void patch_breakpoint(machine_t *m, unsigned int b)
+{
+    decoded_instr_t *d = &m->decoded[m->breakpoints[b].addr];
+    m->breakpoints[b].saved = *d;
+    if (DECODE_IS_FUSED(DECODE_OP(d))) {
+	m->breakpoints[b].saved.op = DOP_UNDECODED;
+    }
+    d->op = DOP_BREAK;
+}
+
+// Undo all of the superinstructions in m's decoded program
+// (their instructions will be decoded again one by one)
+static void unfuse_all(machine_t *m)
+{
+    for (address_type a = 0; a < m->instruction_words; a++) {
+	if (DECODE_IS_FUSED(DECODE_OP(&m->decoded[a]))) {
+	    m->decoded[a].op = DOP_UNDECODED;
+	}
+    }
+}
+
+// Requires: wa < instruction_words
+// Forget the decoded form (and any native code) of the instruction
+// at word address wa, because the word at wa is being overwritten.
+// (A breakpoint there stays, with the entry it replaced forgotten.)
+// This is not inline, as stores into the text are rare.
+static void forget_decoded(machine_t *m, address_type wa)
+{
+    m->snapshot_id = 0;
+    unpatched_entry(m, wa)->op = DOP_UNDECODED;
+    unfuse_at(m, wa);
+    if (m->engine == jit_engine) {
+	jit_invalidate(m->jit, wa);
+    }
+}
+
+// Requires: wa < instruction_words
+// Decode and verify the instruction at word address wa again,
+// returning its (plain) decoded form.
+// This is not inline, as stores into the text are rare.
+static decoded_instr_t decode_again(machine_t *m, address_type wa)
+{
+    decoded_instr_t ret = decode_instr(wa, m->memory->instrs[wa]);
+    bool again;
+    const char *error = verify_redecoded(&m->verify, &ret, wa, &again);
+    if (error != NULL) {
+	machine_error(m, "%s", error);
+    }
+    if (again) {
+	// the other entries may no longer need to be checked
+	for (address_type a = 0; a < m->instruction_words; a++) {
+	    forget_decoded(m, a);
+	}
+    }
+    return ret;
+}
+
+// Forget the decoded form of the instruction at word address wa (if any),
+// because the word at wa is being overwritten
+static inline void invalidate_decoded(machine_t *m, address_type wa)
+{
+    if (wa < m->instruction_words) {
+	forget_decoded(m, wa);
+    }
+}
+
+// Record that the instruction being executed writes the memory
+// at word address wa, if m is logging writes
+static inline void log_write(machine_t *m, address_type wa)
+{
+    if (m->logging_writes && m->num_writes < BTRACE_MAX_WORDS) {
+	m->writes[m->num_writes++] = wa;
+    }
+}
+
+// Store w into the memory at word address wa
+static inline void store_word(machine_t *m, address_type wa, word_type w)
+{
+    log_write(m, wa);
+    m->memory->words[wa] = w;
+    m->dirty[wa / PAGE_WORDS] = true;
+    invalidate_decoded(m, wa);
+}
+
+// Store uw into the memory at word address wa
+static inline void store_uword(machine_t *m, address_type wa, uword_type uw)
+{
+    log_write(m, wa);
+    m->memory->uwords[wa] = uw;
+    m->dirty[wa / PAGE_WORDS] = true;
+    invalidate_decoded(m, wa);
+}
+
+// The input and output system calls, which use m's callbacks
+// (if it has them) or its streams (through its buffers)
+
+// Print the string s, returning the number of characters printed
+static int sys_print_str(machine_t *m, const char *s)
+{
+    if (m->io.print_str != NULL) {
+	return m->io.print_str(m->io.data, s);
+    }
+    return vmio_print_str(m->buffers, s);
+}
+
+// Print the integer i, returning the number of characters printed
+static int sys_print_int(machine_t *m, int i)
+{
+    if (m->io.print_int != NULL) {
+	return m->io.print_int(m->io.data, i);
+    }
+    return vmio_print_int(m->buffers, i);
+}
+
+// Print the character c, returning c
+static int sys_print_char(machine_t *m, int c)
+{
+    if (m->io.print_char != NULL) {
+	return m->io.print_char(m->io.data, c);
+    }
+    return vmio_print_char(m->buffers, c);
+}
+
+// Requires: the PC is just after an RCH instruction
+// Stop the run of m (which is blocked on its input) with the PC left
+// at the RCH instruction, so the next run executes it again.
+// So a call to this does not return.
+static _Noreturn void block_on_input(machine_t *m)
+{
+    if (!m->catching) {
+	machine_error(m, "The program's input is not ready!");
+    }
+    m->PC = m->PC - 1;
+#ifndef MACHINE_NO_FLIGHT_RECORDER
+    m->flight_count--; // (as the next run records it again)
+#endif
+    m->catching = false;
+    longjmp(m->on_error, BLOCKED_JUMP);
+}
+
+// Read and return a character (or EOF)
+static int sys_read_char(machine_t *m)
+{
+    if (m->io.read_char != NULL) {
+	int c = m->io.read_char(m->io.data);
+	if (c == MACHINE_WOULD_BLOCK) {
+	    block_on_input(m);
+	}
+	return c;
+    }
+    return vmio_read_char(m->buffers);
+}
+
+// Execute the instructions that make up superinstructions,
+// using the decoded instruction d, in the machine's current state.
+// These do not change the PC.
+
+// Execute the SWR instruction d
+static inline void exec_swr(machine_t *m, const decoded_instr_t *d)
+{
+    store_word(m, m->GPR[d->ra] + d->oa, m->GPR[d->rb]);
+}
+
+// Execute the LWR instruction d
+static inline void exec_lwr(machine_t *m, const decoded_instr_t *d)
+{
+    m->GPR[d->ra] = m->memory->words[m->GPR[d->rb] + d->ob];
+}
+
+// Execute the CPR instruction d
+static inline void exec_cpr(machine_t *m, const decoded_instr_t *d)
+{
+    m->GPR[d->ra] = m->GPR[d->rb];
+}
+
+// Execute the CPW instruction d
+static inline void exec_cpw(machine_t *m, const decoded_instr_t *d)
+{
+    store_word(m, m->GPR[d->ra] + d->oa,
+	       m->memory->words[m->GPR[d->rb] + d->ob]);
+}
+
+// Execute the ADD instruction d
+static inline void exec_add(machine_t *m, const decoded_instr_t *d)
+{
+    store_word(m, m->GPR[d->ra] + d->oa,
+	       m->memory->words[m->GPR[SP]] + m->memory->words[m->GPR[d->rb] + d->ob]);
+}
+
+// Execute the SUB instruction d
+static inline void exec_sub(machine_t *m, const decoded_instr_t *d)
+{
+    store_word(m, m->GPR[d->ra] + d->oa,
+	       m->memory->words[m->GPR[SP]] - m->memory->words[m->GPR[d->rb] + d->ob]);
+}
+
+// Execute the LIT instruction d
+static inline void exec_lit(machine_t *m, const decoded_instr_t *d)
+{
+    store_word(m, m->GPR[d->ra] + d->oa, d->imm);
+}
+
+// Execute the ARI instruction d
+static inline void exec_ari(machine_t *m, const decoded_instr_t *d)
+{
+    m->GPR[d->ra] = m->GPR[d->ra] + d->imm;
+}
+
+// Execute the SRI instruction d
+static inline void exec_sri(machine_t *m, const decoded_instr_t *d)
+{
+    m->GPR[d->ra] = m->GPR[d->ra] - d->imm;
+}
+
+// set up the state of the machine
+static void initialize(machine_t *m)
+{
+    m->tracing = false;  // until the program is run
+    m->failed = false;
+    m->error_message[0] = '\0';
+    m->snapshot_id = 0;
+    m->instruction_words = 0;
+    m->global_data_words = 0;
+    m->running = true;
+    m->exit_code = EXIT_SUCCESS;
+    memset(m->fusion_executions, 0, sizeof(m->fusion_executions));
+    // a new program has no line table until it is read
+    lines_destroy(m->lines);
+    m->lines = NULL;
+    m->traced_line = -1;
+    free(m->symbol_bytes);
+    m->symbol_bytes = NULL;
+    // a new program has no breakpoints or watchpoints
+    m->num_breakpoints = 0;
+    m->num_watchpoints = 0;
+    m->stopped = false;
+
+    // zero the registers
+    for (int j = 0; j < NUM_REGISTERS; j++) {
+	m->GPR[j] = 0;
+    }
+    m->hilo_regs.result = 0;
+}
+
+// Requires: bf is a binary object file that is open for reading
+// Read the next count words of bf (the section named what)
+// into dest all at once, stopping m with an error message
+// if bf does not have that many.
+static void load_section(machine_t *m, BOFFILE bf, void *dest, int count,
+			 const char *what)
+{
+    size_t bytes = (size_t) count * BYTES_PER_WORD;
+    if (bof_read_bytes(bf, bytes, dest) != bytes) {
+	machine_error(m, "%s %s (%d words) %s %s!", "Cannot read the",
+		      what, count, "from", bf.filename);
+    }
+}
+
+// Check the header bh of the program being loaded into m,
+// stopping m with an error message if it is not consistent.
+// Return the size of memory (in words) the program is run with:
+// the size set by machine_set_memory_size, if any, and otherwise
+// MEMORY_SIZE_IN_WORDS, or just enough for its stack if that is larger.
+static address_type check_header(machine_t *m, BOFHeader bh)
+{
+    if (bh.text_length < 0 || bh.data_length < 0) {
+	machine_error(m, "%s (%d) %s (%d) %s!",
+		      "Text length", bh.text_length,
+		      "or global data length", bh.data_length,
+		      "is negative");
+    }
+    if (bh.text_length >= bh.data_start_address) {
+	machine_error(m, "%s (%u) %s (%u)!",
+			 "Text, i.e., program length", bh.text_length,
+			 "is not less than the start address of the global data",
+			 bh.data_start_address);
+    }
+    if (bh.data_start_address + bh.data_length >= bh.stack_bottom_addr) {
+	machine_error(m, "%s (%u) + %s (%u) %s (%u)!",
+			 "Global data start address", bh.data_start_address,
+			 "global data length", bh.data_length,
+			 "is not less than the stack bottom address",
+			 bh.stack_bottom_addr);
+    }
+    address_type words = m->memory_limit;
+    if (words == MACHINE_MEMORY_FIT) {
+	words = bh.stack_bottom_addr < MACHINE_MAX_MEMORY_WORDS
+	    ? bh.stack_bottom_addr + 1 : MACHINE_MAX_MEMORY_WORDS;
+    } else if (words == 0) {
+	words = MEMORY_SIZE_IN_WORDS;
+	if (bh.stack_bottom_addr >= words
+	    && bh.stack_bottom_addr < MACHINE_MAX_MEMORY_WORDS) {
+	    words = bh.stack_bottom_addr + 1;
+	}
+    }
+    if (bh.stack_bottom_addr >= words) {
+	machine_error(m, "%s (%u) %s (%u)!",
+			 "stack_bottom_addr", bh.stack_bottom_addr,
+			 "is not less than the memory size", words);
+    }
+    return words;
+}
+
+// Requires: the text and data sections of the program whose header
+// is bh (which check_header has accepted) are in m's memory
+// Decode, verify, and prepare the text section, and initialize
+// the registers, so m is ready to run the program
+static void prepare_program(machine_t *m, BOFHeader bh)
+{
+    m->instruction_words = bh.text_length;
+    m->global_data_words = bh.data_length;
+    m->flight_count = 0;
+
+    // decode the text section once, so the run loop doesn't have to
+    free(m->decoded);
+    m->decoded = decode_allocate(m->instruction_words + 1);
+    decode_text(m->decoded, m->memory->instrs, m->instruction_words);
+    m->decoded[m->instruction_words] = decode_undecoded();
+    m->decoded[m->instruction_words].op = DOP_INVALID;
+    const char *error = verify_text(&m->verify, m->decoded,
+				    m->instruction_words,
+				    bh.data_start_address, m->memory_words);
+    if (error != NULL) {
+	machine_error(m, "%s", error);
+    }
+    if (m->fusing && !m->profiling && m->engine == threaded_engine) {
+	fusion_apply(m->decoded, m->instruction_words, m->fusion_sites);
+    }
+    // the breakpoints and watchpoints that a restore keeps
+    // are put back into the program decoded again
+    if (m->num_watchpoints > 0) {
+	unfuse_all(m);
+    }
+    unsigned int kept = 0;
+    for (unsigned int b = 0; b < m->num_breakpoints; b++) {
+	if (m->breakpoints[b].addr < m->instruction_words) {
+	    m->breakpoints[kept] = m->breakpoints[b];
+	    unfuse_at(m, m->breakpoints[kept].addr);
+	    patch_breakpoint(m, kept++);
+	}
+    }
+    m->num_breakpoints = kept;
+    if (m->engine == jit_engine) {
+	if (m->jit == NULL) {
+	    m->jit = jit_create();
+	}
+	jit_prepare(m->jit, m->memory->instrs, m->instruction_words,
+		    &m->verify);
+    }
+    if (m->profiling) {
+	profile_destroy(m->profile);
+	m->profile = profile_create(m->instruction_words);
+    }
+    if (m->sample_rate != 0) {
+	sampler_destroy(m->sampler);
+	m->sampler = sampler_create(m->memory->instrs, m->instruction_words);
+    }
+
+    // initialize the registers
+    m->PC = bh.text_start_address;
+
+    m->GPR[GP] = bh.data_start_address;
+    m->GPR[SP] = bh.stack_bottom_addr;
+    m->GPR[FP] = bh.stack_bottom_addr;
+    m->initial_stack_bottom = bh.stack_bottom_addr;
+    m->header = bh;
+}
+
+// Requires: bf is open for reading in binary
+// Load the binary object file bf into m, and get ready to run it.
+// Return true if that worked, and otherwise (after printing
+// an error message on m's error stream) false.
+bool machine_load(machine_t *m, BOFFILE bf)
+{
+    if (setjmp(m->on_error) != 0) {
+	return false;
+    }
+    m->catching = true;
+    initialize(m);
+
+    // read and check the header
+    BOFHeader bh;
+    const char *error = bof_try_read_header(bf, &bh);
+    if (error != NULL) {
+	machine_error(m, "%s", error);
+    }
+    memory_map(m, check_header(m, bh));
+
+    // load the program, one section at a time
+    load_section(m, bf, m->memory->instrs, bh.text_length, "text section");
+    load_section(m, bf, &m->memory->words[bh.data_start_address],
+		 bh.data_length, "global data section");
+    // and its line table, if it has one
+    const void *lines;
+    size_t lines_size;
+    error = bof_try_read_section(bf, bof_lines_section, &lines, &lines_size);
+    if (error == NULL && lines != NULL) {
+	error = lines_create(&m->lines, lines, lines_size, bh.text_length);
+    }
+    if (error != NULL) {
+	machine_error(m, "%s", error);
+    }
+    // and its symbols, if it has them
+    const void *symbols;
+    size_t symbols_size;
+    error = bof_try_read_section(bf, bof_symbols_section, &symbols,
+				 &symbols_size);
+    if (error == NULL && symbols != NULL) {
+	// (at least 1 byte, so malloc returns a buffer)
+	m->symbol_bytes = malloc(symbols_size + 1);
+	if (m->symbol_bytes == NULL) {
+	    machine_error(m, "Cannot allocate space for the symbols of %s!",
+			  bf.filename);
+	}
+	memcpy(m->symbol_bytes, symbols, symbols_size);
+	error = bof_symbols_open(&m->symbols, m->symbol_bytes, symbols_size);
+    }
+    if (error != NULL) {
+	machine_error(m, "%s", error);
+    }
+    prepare_program(m, bh);
+    m->catching = false;
+    return true;
+}
+
+// Load the program in the size bytes at bytes, which are laid out
+// as in a binary object file (in either version of the format),
+// into m, and get ready to run it.
+// Return true if that worked, and otherwise (after printing
+// an error message on m's error stream, if it has one) false.
+bool machine_load_bytes(machine_t *m, const void *bytes, size_t size)
+{
+    BOFFILE bf = bof_memory_open("the program", bytes, size);
+    bool loaded = machine_load(m, bf);
+    bof_close(bf);
+    return loaded;
+}
+
+// Requires: the image file of s (named name) has been written
+// Set the memory of s to the memory in its image file,
+// exiting with an error message if that cannot be read
+static void open_image_memory(machine_snapshot_t *s, const char *name)
+{
+    size_t region_bytes = s->header.region_bytes;
+#ifdef MACHINE_MMAP
+    void *region = mmap(NULL, region_bytes, PROT_READ, MAP_SHARED,
+			fileno(s->image), IMAGE_MEMORY_OFFSET);
+    if (region == MAP_FAILED) {
+	bail_with_error("Cannot map snapshot image file %s!", name);
+    }
+#else
+    void *region = malloc(region_bytes);
+    if (region == NULL) {
+	bail_with_error("Cannot allocate space for a snapshot's memory!");
+    }
+    if (fseek(s->image, IMAGE_MEMORY_OFFSET, SEEK_SET) != 0
+	|| fread(region, region_bytes, 1, s->image) != 1) {
+	bail_with_error("Cannot read snapshot image file %s!", name);
+    }
+#endif
+    s->region = region;
+    s->memory = (const union mem_u *) (s->region + region_bytes
+				       - (size_t) s->header.memory_words
+				         * BYTES_PER_WORD);
+}
+
+// Requires: a program has been loaded into m
+// Take a snapshot of the registers and memory of m, and write its image
+// to the file named filename, or (if filename is NULL) to a temporary file
+// that is removed when the snapshot is destroyed.
+// Exit with an error message if the image cannot be written.
+machine_snapshot_t *machine_snapshot(machine_t *m, const char *filename)
+{
+    machine_snapshot_t *s = calloc(1, sizeof(machine_snapshot_t));
+    if (s == NULL) {
+	bail_with_error("Cannot allocate a snapshot!");
+    }
+    const char *name = filename == NULL ? "(temporary)" : filename;
+    s->image = filename == NULL ? tmpfile() : fopen(filename, "w+b");
+    if (s->image == NULL) {
+	bail_with_error("Cannot open snapshot image file %s!", name);
+    }
+    snapshot_header_t *sh = &s->header;
+    strncpy(sh->magic, SNAPSHOT_MAGIC, sizeof(sh->magic));
+    sh->memory_words = m->memory_words;
+    sh->region_bytes = m->region_bytes;
+    sh->header = m->header;
+    memcpy(sh->GPR, m->GPR, sizeof(sh->GPR));
+    sh->hilo = m->hilo_regs.result;
+    sh->PC = m->PC;
+    // the region starts at an offset that can be mapped
+    if (fwrite(sh, sizeof(*sh), 1, s->image) != 1
+	|| fseek(s->image, IMAGE_MEMORY_OFFSET, SEEK_SET) != 0
+	|| fwrite(m->region, m->region_bytes, 1, s->image) != 1
+	|| fflush(s->image) != 0) {
+	bail_with_error("Cannot write snapshot image file %s!", name);
+    }
+    open_image_memory(s, name);
+    s->id = ++last_snapshot_id;
+    // m's decoded program and memory are right for the snapshot
+    m->snapshot_id = s->id;
+    memset(m->dirty, 0, dirty_pages(m) * sizeof(bool));
+    return s;
+}
+
+// Open the snapshot whose image is in the file named filename
+// (written by machine_snapshot), which must not be changed while
+// the snapshot is in use. Exit with an error message if that file
+// cannot be read or does not hold a snapshot's image.
+machine_snapshot_t *machine_snapshot_open(const char *filename)
+{
+    machine_snapshot_t *s = calloc(1, sizeof(machine_snapshot_t));
+    if (s == NULL) {
+	bail_with_error("Cannot allocate a snapshot!");
+    }
+    s->image = fopen(filename, "rb");
+    if (s->image == NULL) {
+	bail_with_error("Cannot open snapshot image file %s!", filename);
+    }
+    snapshot_header_t *sh = &s->header;
+    if (fread(sh, sizeof(*sh), 1, s->image) != 1
+	|| strncmp(sh->magic, SNAPSHOT_MAGIC, sizeof(sh->magic)) != 0) {
+	bail_with_error("%s is not a snapshot image file!", filename);
+    }
+    // the region must all be in the file, or mapping it would fail later
+    if (sh->memory_words == 0 || sh->memory_words > MACHINE_MAX_MEMORY_WORDS
+	|| sh->region_bytes
+	   != round_to_pages((size_t) sh->memory_words * BYTES_PER_WORD)
+	|| fseek(s->image, 0, SEEK_END) != 0
+	|| ftell(s->image) < (long) (IMAGE_MEMORY_OFFSET + sh->region_bytes)) {
+	bail_with_error("Snapshot image file %s %s!", filename,
+			"was not written on a host like this one");
+    }
+    open_image_memory(s, filename);
+    s->id = ++last_snapshot_id;
+    return s;
+}
+
+// Free the snapshot s (closing its image file), which must not be
+// used by any machine after this
+void machine_snapshot_destroy(machine_snapshot_t *s)
+{
+    if (s != NULL) {
+#ifdef MACHINE_MMAP
+	munmap((void *) s->region, s->header.region_bytes);
+#else
+	free((void *) s->region);
+#endif
+	fclose(s->image);
+	free(s);
+    }
+}
+
+// Requires: m's memory is the size of s's
+// Replace the memory of m by the memory in the image of s.
+// This maps the image copy-on-write, so the pages that m does not
+// write are shared with the image file (and every other machine
+// restored from it), and only those m writes are copied.
+static void restore_memory(machine_t *m, const machine_snapshot_t *s)
+{
+#ifdef MACHINE_MMAP
+    void *region = mmap(m->region, m->region_bytes, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_FIXED, fileno(s->image),
+			IMAGE_MEMORY_OFFSET);
+    if (region == MAP_FAILED) {
+	machine_error(m, "Cannot map the image of a snapshot into memory!");
+    }
+#else
+    memcpy(m->region, s->region, m->region_bytes);
+#endif
+    memset(m->dirty, 0, dirty_pages(m) * sizeof(bool));
+}
+
+// Requires: m's memory was the memory of s when the snapshot was last
+// taken of or restored into m, and since then only the interpreter
+// (not the JIT's native code) has written it
+// Copy the pages of s's memory that m has written back into m's memory.
+// (This is faster than mapping the image again, which would make m
+// fault in the pages it uses once more.)
+static void restore_dirty_pages(machine_t *m, const machine_snapshot_t *s)
+{
+    for (size_t p = 0; p < dirty_pages(m); p++) {
+	address_type first = p * PAGE_WORDS;
+	if (m->dirty[p] && first < m->memory_words) {
+	    // (the guard words are never written on hosts with mmap)
+	    address_type count = m->memory_words - first < PAGE_WORDS
+		? m->memory_words - first : PAGE_WORDS;
+	    memcpy(&m->memory->words[first], &s->memory->words[first],
+		   count * BYTES_PER_WORD);
+	}
+	m->dirty[p] = false;
+    }
+}
+
+// Restore m to the state in the snapshot s (which may have been taken of
+// another machine, if it uses the same engine, superinstructions,
+// and profiling), so its program runs again from that point.
+// When s is the snapshot last taken of or restored into m,
+// and m has not written its text section since then, this only copies
+// back the pages of memory m has written (or maps the memory again,
+// for the JIT engine) and sets the registers; otherwise it maps
+// the memory and decodes (and verifies) the program again.
+// Return true if that worked, and otherwise (after printing
+// an error message on m's error stream, if it has one) false.
+bool machine_restore(machine_t *m, const machine_snapshot_t *s)
+{
+    if (setjmp(m->on_error) != 0) {
+	return false;
+    }
+    m->catching = true;
+    m->tracing = false;  // until the program is run
+    m->failed = false;
+    m->error_message[0] = '\0';
+    m->running = true;
+    m->exit_code = EXIT_SUCCESS;
+    m->stopped = false;
+    memset(m->fusion_executions, 0, sizeof(m->fusion_executions));
+
+    if (m->snapshot_id != s->id) {
+	memory_map(m, s->header.memory_words);
+	restore_memory(m, s);
+	prepare_program(m, s->header.header);
+    } else {
+	// the JIT's native code does not record the pages it writes
+	if (m->engine == jit_engine) {
+	    restore_memory(m, s);
+	} else {
+	    restore_dirty_pages(m, s);
+	}
+	if (m->profiling) {
+	    profile_destroy(m->profile);
+	    m->profile = profile_create(m->instruction_words);
+	}
+	if (m->sample_rate != 0) {
+	    sampler_destroy(m->sampler);
+	    m->sampler = sampler_create(m->memory->instrs,
+					m->instruction_words);
+	}
+    }
+    memcpy(m->GPR, s->header.GPR, sizeof(m->GPR));
+    m->hilo_regs.result = s->header.hilo;
+    m->PC = s->header.PC;
+    m->flight_count = 0;
+    m->snapshot_id = s->id;
+    m->catching = false;
+    return true;
+}
+
+// Requires: fmt == 'x' or fmt == 'd'
+// print the memory location at word address wa to out
+// with a format determined by fmt and no newline,
+// returns the number of characters written
+static int print_loc(machine_t *m, FILE *out, address_type wa, char fmt)
+{
+    int count;
+    if (fmt == 'x') {
+	count = fprintf(out, "%8d: 0x%x\t", wa,
+			m->memory->words[wa]);
+    } else { // fmt == 'd'
+	count = fprintf(out, "%8d: %d\t", wa,
+			m->memory->words[wa]);
+    }
+    return count;
+}
+
+// print the word address given and the instruction's assembly form
+static void print_instruction(FILE *out, address_type wa, bin_instr_t bi)
+{
+    fprintf(out, "%6d: %s\n", wa, instruction_assembly_form(wa, bi));
+}
+
+// If the loaded program has a line table, and the instruction at addr
+// came from another source line than the last one traced,
+// print (as a comment, before its trace) the line it came from on out
+static void trace_source_line(machine_t *m, FILE *out, address_type addr)
+{
+    if (m->lines == NULL) {
+	return;
+    }
+    int line = lines_index(m->lines, addr);
+    if (line >= 0 && line != m->traced_line) {
+	fprintf(out, "\n# line %u of %s", lines_number(m->lines, line),
+		lines_file(m->lines, line));
+    }
+    m->traced_line = line;
+}
+
+// If the loaded program has a line table, and the instruction at addr
+// came from another source line than the last one traced,
+// print the line it came from on out (as a "# line" comment),
+// as tracing does before the instruction's trace
+void machine_print_source_line(machine_t *m, FILE *out, address_type addr)
+{
+    trace_source_line(m, out, addr);
+}
+
+// Print the word memory in hex or decimal based on the fmt argument
+// between the word addresses start (inclusive) and end (inclusive) to out,
+// without a newline and eliding all repeated zeros in the range
+// Returns true if printed a newline at the end, false otherwise
+static bool print_memory_nonzero(machine_t *m, FILE *out, int start, int end,
+				 char fmt)
+{
+    bool printed_trailing_newline = false;
+    bool previously_zero = false; // was previous word printed a 0?
+    bool printed_dots = false;   // have we already printed dots?
+    int lc = 0;   // count of chars on a line
+    for (int wa = start; wa <= end; wa++) {
+	if (lc > MAX_PRINT_WIDTH) {
+	    newline(out);
+	    printed_trailing_newline = true;
+	    lc = 0;
+	}
+	if (m->memory->words[wa] != 0) {
+	    lc += print_loc(m, out, wa, fmt);
+	    printed_trailing_newline = false;
+	    previously_zero = false;
+	    printed_dots = false;
+	} else {
+	    // memory.words[wa] == 0
+	    if (!previously_zero) {
+		// print the first zero
+		lc += print_loc(m, out, wa, fmt);
+		previously_zero = true;
+		printed_dots = false;
+	    } else {
+		// previously printed a zero
+		if (!printed_dots) {
+		    // not already printed the dots, so print them now
+		    lc += fprintf(out, "%s", "        ...     ");
+		    printed_dots = true;
+		}
+	    }
+	    printed_trailing_newline = false;
+	}
+    }
+    return printed_trailing_newline;
+}
+
+// print the nonzero memory locations between the word addresses
+// start and end (both inclusive) on out, in decimal notation
+// a trailing newline was printed if the result is true
+static bool print_memory_words_d(machine_t *m, FILE *out, int start, int end)
+{
+    return print_memory_nonzero(m, out, start, end, 'd');
+}
+
+// Print the global area, eliding repeated zeros,
+// starting at GPR[GP]
+static void print_global_data(machine_t *m, FILE *out)
+{
+    int global_wa = m->GPR[GP];
+    bool printed_nl;
+    printed_nl = print_memory_words_d(m, out, global_wa, m->GPR[SP]-1);
+    if (!printed_nl) {
+	newline(out);
+    }
+}
+
+// Requires: a program has been loaded into the computer's memory
+// print a heading and the program and any global data
+// that were previously loaded into the VM's memory to out
+// (with the names of the addresses in the text section that have them,
+// if the program has symbols)
+void machine_print_loaded_program(machine_t *m, FILE *out)
+{
+    // heading
+    instruction_print_table_heading(out);
+    // instructions
+    for (address_type wa = 0; wa < m->instruction_words; wa++) {
+	if (m->symbol_bytes != NULL) {
+	    for (uword_type i = bof_symbols_at(&m->symbols, wa);
+		 i != BOF_NO_SYMBOL; i = m->symbols.symbols[i].addr_next) {
+		if (m->symbols.symbols[i].addr == (uword_type) wa) {
+		    fprintf(out, "%s:\n", bof_symbols_name(&m->symbols, i));
+		}
+	    }
+	}
+	print_instruction(out, wa, m->memory->instrs[wa]);
+    }
+
+    print_global_data(m, out);
+}
+
+// Requires: words <= MACHINE_MAX_MEMORY_WORDS
+// Make m run the programs it loads with a memory of words words,
+// or, if words is 0, with a memory of MEMORY_SIZE_IN_WORDS words
+// (or just enough for the program's stack, if that is larger)
+void machine_set_memory_size(machine_t *m, address_type words)
+{
+    m->memory_limit = words;
+}
+
+// Make m use the given engine to run programs
+// (the JIT engine is replaced by the threaded engine
+// on hosts where the JIT cannot generate native code)
+void machine_set_engine(machine_t *m, engine_type e)
+{
+    if (e == jit_engine && !jit_available()) {
+	e = threaded_engine;
+    }
+    m->engine = e;
+}
+
+// Form superinstructions when loading programs just when fuse is true
+// (only done for the threaded engine)
+void machine_set_fusion(machine_t *m, bool fuse)
+{
+    m->fusing = fuse;
+}
+
+// Print the number of places each superinstruction was used
+// in the loaded program and the number of times each was executed to out
+void machine_print_fusion_stats(machine_t *m, FILE *out)
+{
+    fusion_print_stats(out, m->fusion_sites, m->fusion_executions);
+}
+
+// Print the JIT's statistics to out (if the JIT engine is being used)
+void machine_print_jit_stats(machine_t *m, FILE *out)
+{
+    if (m->engine == jit_engine) {
+	jit_print_stats(m->jit, out);
+    }
+}
+
+// Count the executions of each instruction in the text section
+// (and how often each jumps) just when on is true.
+// This is done one instruction at a time, whatever the engine.
+void machine_set_profiling(machine_t *m, bool on)
+{
+    m->profiling = on;
+}
+
+// Requires: profiling is on and a program has been loaded
+// Print a table of the profile of the program so far to out
+// (followed by its totals for the most executed procedures and labels,
+// if the program has symbols, and source lines, if it has a line table)
+void machine_print_profile(machine_t *m, FILE *out)
+{
+    profile_print_table(m->profile, out, m->memory->instrs);
+    if (m->symbol_bytes != NULL) {
+	profile_print_symbols(m->profile, out, &m->symbols);
+    }
+    if (m->lines != NULL) {
+	lines_print_totals(m->lines, out, profile_execution_counts(m->profile),
+			   "instructions");
+    }
+}
+
+// Requires: profiling is on and a program has been loaded
+// Write the profile of the program so far to out,
+// in the machine-readable form described in profile.h
+void machine_write_profile(machine_t *m, FILE *out)
+{
+    profile_write(m->profile, out, m->memory->instrs);
+}
+
+// Sample the PC and call stack of the program running on m
+// rate times a second of CPU time, when rate is not 0,
+// by a timer that interrupts the run loops (see sampler.h)
+void machine_set_sampling(machine_t *m, unsigned int rate)
+{
+    m->sample_rate = rate;
+}
+
+// Requires: sampling is on and a program has been loaded
+// Print a table of the samples of the program so far to out
+// (followed by its totals for the most sampled source lines,
+// if the program has a line table)
+void machine_print_samples(machine_t *m, FILE *out)
+{
+    sampler_print_table(m->sampler, out, m->memory->instrs);
+    if (m->lines != NULL) {
+	lines_print_totals(m->lines, out, sampler_sample_counts(m->sampler),
+			   "samples");
+    }
+}
+
+// Requires: sampling is on and a program has been loaded
+// Write the stacks sampled so far to out, in the folded format
+// of flame graph tools (see sampler.h), naming the procedures
+// by their symbols, if the program has them
+void machine_write_samples(machine_t *m, FILE *out)
+{
+    sampler_write_folded(m->sampler, out,
+			 m->symbol_bytes != NULL ? &m->symbols : NULL);
+}
+
+// the offsets from the frame pointer of the saved frame pointer
+// (the dynamic link) and of the saved return address in an activation
+// record laid out by the SPL compiler's code_utils_save_registers_for_AR
+#define SAVED_FP_OFFSET (-2)
+#define SAVED_RA_OFFSET (-4)
+
+// Take a sample of the machine running on this thread (the timer's tick,
+// called in the handler for SIGPROF): the address of the instruction
+// it is executing, and the procedures
+// of the calls it is in, found by following the dynamic links from $fp.
+// A frame whose return address is 0 is the program's own; one whose
+// return address does not follow a CALL ends the walk at an unknown frame.
+static void take_sample(void)
+{
+    machine_t *m = running_machine;
+    if (m == NULL || m->sampler == NULL) {
+	return;
+    }
+    address_type calls[SAMPLER_MAX_DEPTH];
+    unsigned int depth = 0;
+    word_type fp = m->GPR[FP];
+    while (depth < SAMPLER_MAX_DEPTH) {
+	if (fp + SAVED_RA_OFFSET < 0 || fp >= (word_type) m->memory_words) {
+	    calls[depth++] = SAMPLER_UNKNOWN_FRAME;
+	    break;
+	}
+	address_type ra = m->memory->uwords[fp + SAVED_RA_OFFSET];
+	if (ra == 0) {
+	    break;
+	}
+	if (ra > m->instruction_words
+	    || DECODE_OP(&m->decoded[ra - 1]) != DOP_CALL) {
+	    calls[depth++] = SAMPLER_UNKNOWN_FRAME;
+	    break;
+	}
+	calls[depth++] = m->decoded[ra - 1].target;
+	word_type next = m->memory->words[fp + SAVED_FP_OFFSET];
+	if (next <= fp) {
+	    break; // (the links must go up the stack)
+	}
+	fp = next;
+    }
+    // the calls were found innermost first
+    for (unsigned int i = 0; i < depth / 2; i++) {
+	address_type t = calls[i];
+	calls[i] = calls[depth - 1 - i];
+	calls[depth - 1 - i] = t;
+    }
+    // the run loops advance the PC before executing an instruction,
+    // so the one executing is the last the flight recorder saw
+    // (for the JIT's native code, the start of its block)
+    address_type pc = m->PC;
+#ifndef MACHINE_NO_FLIGHT_RECORDER
+    if (m->flight_count > 0) {
+	pc = m->flight[(m->flight_count - 1) % FLIGHT_RECORDS].pc;
+    }
+#endif
+    sampler_record(m->sampler, pc, calls, depth);
+}
+
+// Record in m's flight recorder that the instruction at pc is dispatched
+// (with the registers before it, if it starts a group of
+// FLIGHT_SNAPSHOT_INTERVAL). This is done in every run loop, so it is
+// just two stores, and the copy of the registers every so often.
+static inline void flight_record(machine_t *m, address_type pc)
+{
+#ifndef MACHINE_NO_FLIGHT_RECORDER
+    unsigned long n = m->flight_count++;
+    flight_entry_t *e = &m->flight[n % FLIGHT_RECORDS];
+    e->pc = pc;
+    e->instr = m->memory->uwords[pc];
+    if (n % FLIGHT_SNAPSHOT_INTERVAL == 0) {
+	flight_registers_t *r = &m->flight_registers[(n % FLIGHT_RECORDS)
+						     / FLIGHT_SNAPSHOT_INTERVAL];
+	memcpy(r->GPR, m->GPR, sizeof(m->GPR));
+	r->hilo = m->hilo_regs.result;
+    }
+#endif
+}
+
+// Forget that the last instruction recorded by m's flight recorder
+// was dispatched (as it was not executed, and the next run records it)
+static inline void flight_unrecord(machine_t *m)
+{
+#ifndef MACHINE_NO_FLIGHT_RECORDER
+    m->flight_count--;
+#endif
+}
+
+// Requires: the PC is just after the instruction dispatched last
+// Stop the run of m before that instruction (at a breakpoint)
+static void stop_before(machine_t *m)
+{
+    m->PC = m->PC - 1;
+    flight_unrecord(m);
+    m->stopped = true;
+}
+
+// Requires: m->watch_page != NULL
+// Finish the store into a watched page that begin_watched_store let
+// go ahead: put back the entry that DOP_WATCH replaced, make the page
+// only readable again, and stop m if it stored into a watched word
+// (with the PC at the next instruction)
+static void end_watched_store(machine_t *m)
+{
+    if (m->watch_patched) {
+	m->decoded[m->watch_pc] = m->watch_saved;
+	m->watch_patched = false;
+    }
+#ifdef MACHINE_MMAP
+    mprotect(m->watch_page, m->watch_page_bytes, PROT_READ);
+#endif
+    m->watch_page = NULL;
+    if (m->watch_hit) {
+	m->stopped = true;
+    }
+}
+
+// Make the pages holding the words m watches only readable, if on,
+// so the stores into them fault (see on_fault), or writable again.
+// (They are only protected while m runs, so nothing else faults.)
+static void watch_protect(machine_t *m, bool on)
+{
+#ifdef MACHINE_MMAP
+    if (!on && m->watch_page != NULL) {
+	end_watched_store(m);
+    }
+    for (unsigned int i = 0; i < m->num_watchpoints; i++) {
+	const watchpoint_t *w = &m->watchpoints[i];
+	if (w->addr >= m->memory_words || w->count > m->memory_words - w->addr) {
+	    continue;  // (a restore gave m a smaller memory)
+	}
+	unsigned char *first
+	    = page_of(m, (unsigned char *) &m->memory->words[w->addr]);
+	unsigned char *last = page_of(m, (unsigned char *)
+				      &m->memory->words[w->addr + w->count - 1]);
+	mprotect(first, last - first + m->watch_page_bytes,
+		 on ? PROT_READ : PROT_READ | PROT_WRITE);
+    }
+#endif
+}
+
+// Is there a breakpoint at the PC of m, for the run loops
+// that do not dispatch decoded entries? If so, stop m there.
+static inline bool stop_at_breakpoint(machine_t *m)
+{
+    if (m->PC < m->instruction_words && m->decoded[m->PC].op == DOP_BREAK) {
+	m->stopped = true;
+    }
+    return m->stopped;
+}
+
+static void run_threaded(machine_t *m);
+static unsigned long run_jit(machine_t *m, unsigned long budget);
+static void run_stack_cached(machine_t *m);
+static unsigned long run_stack_cached_budgeted(machine_t *m,
+					       unsigned long budget);
+static void run_profiled(machine_t *m);
+static void step_delta(machine_t *m);
+static unsigned long run_budgeted(machine_t *m, unsigned long budget);
+
+// Execute the instruction at PC in the traced engine's way: check
+// the invariant, then execute it, printing it and the state after it
+// if tracing (and counting it, if profiling),
+// unless there is a breakpoint at PC (which stops m)
+static void step_traced(machine_t *m)
+{
+    if (stop_at_breakpoint(m)) {
+	return;
+    }
+    if (m->delta_tracing) {
+	step_delta(m);
+	return;
+    }
+    machine_okay(m); // check the invariant
+    address_type addr = m->PC;
+    if (m->profiling && addr < m->instruction_words) {
+	profile_execution(m->profile, addr);
+    }
+    machine_trace_execute_instr(m, m->out, m->PC, m->memory->instrs[m->PC]);
+    if (m->profiling && addr < m->instruction_words && m->PC != addr + 1) {
+	profile_jump(m->profile, addr);
+    }
+}
+
+// Requires: m->logging_writes
+// Execute the next instruction (without checking the invariant),
+// putting the registers (and HI and LO) and memory words it changes
+// in *c, along with its address, its encoding, and the next PC
+static void execute_logged(machine_t *m, btrace_changes_t *c)
+{
+    address_type addr = m->PC;
+    word_type regs[BTRACE_NUM_REGISTERS];
+    memcpy(regs, m->GPR, sizeof(m->GPR));
+    regs[BTRACE_HI] = m->hilo_regs.hilo[HI];
+    regs[BTRACE_LO] = m->hilo_regs.hilo[LO];
+    m->num_writes = 0;
+    c->pc = addr;
+    c->instr = m->memory->uwords[addr];
+    if (addr < m->instruction_words) {
+	if (m->profiling) {
+	    profile_execution(m->profile, addr);
+	}
+	machine_execute_decoded(m, addr);
+	if (m->profiling && m->PC != addr + 1) {
+	    profile_jump(m->profile, addr);
+	}
+    } else {
+	machine_execute_instr(m, addr, m->memory->instrs[addr]);
+    }
+    c->next_pc = m->PC;
+    c->num_regs = 0;
+    for (unsigned int r = 0; r < BTRACE_NUM_REGISTERS; r++) {
+	word_type now = r == BTRACE_HI ? m->hilo_regs.hilo[HI]
+	    : r == BTRACE_LO ? m->hilo_regs.hilo[LO] : m->GPR[r];
+	if (now != regs[r]) {
+	    c->regs[c->num_regs] = r;
+	    c->reg_values[c->num_regs++] = now;
+	}
+    }
+    c->num_words = 0;
+    for (unsigned int i = 0; i < m->num_writes; i++) {
+	c->addrs[c->num_words] = m->writes[i];
+	c->words[c->num_words++] = m->memory->words[m->writes[i]];
+    }
+}
 
-// words of instructions (based on the header)
-static unsigned short instruction_words;
-// words of global data (based on the header)
-static unsigned short global_data_words;
+// Requires: m->btrace != NULL and m->logging_writes
+// Execute the next instruction, after checking the invariant,
+// recording the registers and memory words it changes in m's binary
+// trace, along with what the text trace would print (see step_traced),
+// unless there is a breakpoint at PC (which stops m)
+static void step_recorded(machine_t *m)
+{
+    if (stop_at_breakpoint(m)) {
+	return;
+    }
+    machine_okay(m); // check the invariant
+    m->recording_pc = m->PC;
+    m->recording_flags = m->tracing ? BTRACE_PRINT_INSTR : 0;
+    btrace_changes_t c;
+    execute_logged(m, &c);
+    c.flags = m->recording_flags;
+    if (m->tracing && m->running) {
+	c.flags |= BTRACE_PRINT_STATE;
+    }
+    btrace_step(m->btrace, &c);
+}
 
+// Print the changes c made by an instruction to out: the PC
+// (if it jumped), HI and LO (if either changed), the registers
+// that changed (five to a line), and the memory words written
+static void print_changes(FILE *out, const btrace_changes_t *c)
+{
+    bool hilo_changed = false;
+    unsigned int gprs = 0;
+    for (unsigned int i = 0; i < c->num_regs; i++) {
+	if (c->regs[i] >= NUM_REGISTERS) {
+	    hilo_changed = true;
+	} else {
+	    gprs++;
+	}
+    }
+    if (c->next_pc != c->pc + 1 || hilo_changed) {
+	fprintf(out, "%8s: %u", "PC", c->next_pc);
+	for (unsigned int i = 0; i < c->num_regs; i++) {
+	    if (c->regs[i] >= NUM_REGISTERS) {
+		fprintf(out, "\t%8s: %d",
+			c->regs[i] == BTRACE_HI ? "HI" : "LO", c->reg_values[i]);
+	    }
+	}
+	newline(out);
+    }
+    unsigned int printed = 0;
+    for (unsigned int i = 0; i < c->num_regs; i++) {
+	if (c->regs[i] < NUM_REGISTERS) {
+	    fprintf(out, printed % 5 == 0 ? REGFORMAT1 : REGFORMAT2,
+		    regname_get(c->regs[i]), c->reg_values[i]);
+	    printed++;
+	    if (printed % 5 == 0 || printed == gprs) {
+		newline(out);
+	    }
+	}
+    }
+    if (c->num_words > 0) {
+	for (unsigned int i = 0; i < c->num_words; i++) {
+	    fprintf(out, "%8d: %d\t", c->addrs[i], c->words[i]);
+	}
+	newline(out);
+    }
+}
 
-// should the machine be running? (default true)
-static bool running;
+// Requires: m->delta_tracing
+// Execute the next instruction as step_traced does, but when tracing,
+// print only what it changed instead of the state after it,
+// except for each keyframe (the whole state, so the trace can be
+// read from there), and after tracing is turned on
+static void step_delta(machine_t *m)
+{
+    machine_okay(m); // check the invariant
+    bool was_tracing = m->tracing;
+    if (was_tracing) {
+	vmio_flush(m->buffers); // so the trace follows the program's output
+	trace_source_line(m, m->out, m->PC);
+	fprintf(m->out, "\n==> ");
+	print_instruction(m->out, m->PC, m->memory->instrs[m->PC]);
+    }
+    btrace_changes_t c;
+    m->logging_writes = true;
+    execute_logged(m, &c);
+    m->logging_writes = m->btrace != NULL;
+    // (the program has ended if it executed EXIT)
+    if (!m->tracing || !m->running) {
+	return;
+    }
+    m->since_keyframe++;
+    if (!was_tracing || (m->keyframe_interval != 0
+			 && m->since_keyframe >= m->keyframe_interval)) {
+	machine_print_state(m, m->out);
+	m->since_keyframe = 0;
+    } else {
+	vmio_flush(m->buffers); // so the changes follow the program's output
+	print_changes(m->out, &c);
+    }
+}
 
-// set up the state of the machine
-static void initialize()
+// Can m's engine run the next instructions (rather than step_traced)?
+static inline bool engine_can_run(machine_t *m)
 {
-    tracing = true;   // default for tracing
-    instruction_words = 0;
-    global_data_words = 0;
-    running = true;
+    return m->engine != traced_engine && !m->tracing
+	&& m->PC < m->instruction_words && m->btrace == NULL;
+}
 
-    // zero the registers
-    for (int j = 0; j < NUM_REGISTERS; j++) {
-	GPR[j] = 0;
-    }
-    hilo_regs.result = 0;
-    // zero out the memory
-    for (int i = 0; i < MEMORY_SIZE_IN_WORDS; i++) {
-	memory.words[i] = 0;
+// Run m on the already loaded program until it stops running
+// (or stops at a breakpoint or watchpoint), using its engine
+static void run_to_exit(machine_t *m)
+{
+    while (m->running && !m->stopped) {
+	if (m->btrace != NULL) {
+	    step_recorded(m);
+	} else if (engine_can_run(m)) {
+	    // runs until tracing is turned on or the PC leaves the text
+	    if (m->profiling) {
+		run_profiled(m);
+	    } else if (m->engine == jit_engine) {
+		run_jit(m, ULONG_MAX);
+	    } else if (m->engine == stack_cached_engine) {
+		run_stack_cached(m);
+	    } else {
+		run_threaded(m);
+	    }
+	    if (m->tracing) {
+		// print the state after the STRA instruction,
+		// as the traced loop would have
+		machine_print_state(m, m->out);
+	    }
+	} else {
+	    step_traced(m);
+	}
+	if (m->watch_page != NULL) {
+	    end_watched_store(m);
+	}
     }
 }
 
-// Requires: bf is a binary object file that is open for reading
-// Load count instructions from bf into the memory starting at address 0.
-// If any errors are encountered, exit with an error message.
-static void load_instructions(BOFFILE bf, int count)
+// Run m on the already loaded program for at most steps instructions
+// (or until it stops running, or stops at a breakpoint or watchpoint),
+// using its engine (but one instruction at a time when profiling)
+static void run_limited(machine_t *m, unsigned long steps)
 {
-    for (int wa = 0; wa < count; wa++) {
-	memory.instrs[wa] = instruction_read(bf);
+    while (m->running && !m->stopped && steps > 0) {
+	if (engine_can_run(m) && !m->profiling) {
+	    if (m->engine == jit_engine) {
+		steps = run_jit(m, steps);
+	    } else if (m->engine == stack_cached_engine) {
+		steps = run_stack_cached_budgeted(m, steps);
+	    } else {
+		steps = run_budgeted(m, steps);
+	    }
+	    if (m->tracing) {
+		machine_print_state(m, m->out);
+	    }
+	} else if (m->btrace != NULL) {
+	    step_recorded(m);
+	    steps--;
+	} else {
+	    step_traced(m);
+	    steps--;
+	}
+	if (m->watch_page != NULL) {
+	    end_watched_store(m);
+	}
     }
 }
 
-// Requires: bf is a binary object file that is open for reading
-// Load count words from bf into the memory
-// starting at word address global_base.
-// If any errors are encountered, exit with an error message.
-static void load_data(BOFFILE bf, int count, unsigned int global_base)
+// If the last run of m stopped at the PC, and there is a breakpoint
+// there, execute its instruction (so it does not stop m again).
+// Return the number of instructions executed (0 or 1).
+static unsigned long step_over_breakpoint(machine_t *m)
 {
-    for (int wo = 0; wo < count; wo++) {
-	memory.words[global_base+wo] = bof_read_word(bf);
+    bool resuming = m->stopped;
+    m->stopped = false;
+    m->watch_hit = false;
+    int b = resuming && m->running ? breakpoint_index(m, m->PC) : -1;
+    if (b < 0) {
+	return 0;
     }
+    m->decoded[m->PC] = m->breakpoints[b].saved;
+    run_limited(m, 1);
+    patch_breakpoint(m, b);
+    return 1;
 }
 
-// Requires: bf is open for reading in binary
-// Load the binary object file bf, and get ready to run it
-void machine_load(BOFFILE bf)
+// Run m on the already loaded (or partly run) program for at most
+// steps instructions, or until it executes EXIT if steps is 0,
+// producing any trace output called for by the program.
+// (A limited run uses m's engine, but executes exactly steps instructions
+// unless the program stops first, so that it can be compared
+// with a run of the traced engine, see shadow.h.)
+// Return whether m is still running, has exited (see machine_exit_code),
+// has stopped with an error (see machine_error_message), is blocked,
+// as its read_char callback returned MACHINE_WOULD_BLOCK (then the PC
+// is left at that RCH instruction, so the next run reads again),
+// or has stopped at a breakpoint or watchpoint.
+machine_status machine_run_steps(machine_t *m, unsigned long steps)
 {
-    initialize();
+    if (m->failed) {
+	return machine_failed;
+    }
+    int jumped = setjmp(m->on_error);
+    if (jumped != 0) {
+	if (m->sampler != NULL) {
+	    sampler_stop();
+	}
+	watch_protect(m, false);
+	set_running_machine(NULL);
+	vmio_set_running(NULL);
+	if (jumped != BLOCKED_JUMP) {
+	    return machine_failed;
+	}
+	// so the output asking for the input is seen
+	vmio_flush(m->buffers);
+	if (m->out != NULL) {
+	    fflush(m->out);
+	}
+	return machine_blocked;
+    }
+    m->catching = true;
+    set_running_machine(m);
+    vmio_set_running(m->buffers);
+    if (m->sampler != NULL) {
+	sampler_start(m->sample_rate, take_sample);
+    }
+    watch_protect(m, true);
+    unsigned long stepped = step_over_breakpoint(m);
+    if (steps == 0) {
+	run_to_exit(m);
+    } else {
+	run_limited(m, steps - stepped);
+    }
+    if (m->sampler != NULL) {
+	sampler_stop();
+    }
+    watch_protect(m, false);
+    set_running_machine(NULL);
+    vmio_set_running(NULL);
+    m->catching = false;
+    vmio_flush(m->buffers);
+    if (m->out != NULL) {
+	fflush(m->out);
+    }
+    if (!m->running) {
+	return machine_exited;
+    }
+    return m->stopped ? machine_stopped : machine_stepping;
+}
 
-    // read and check the header
-    BOFHeader bh = bof_read_header(bf);
-    if (bh.text_length >= bh.data_start_address) {
-	bail_with_error("%s (%u) %s (%u)!",
-			"Text, i.e., program length", bh.text_length,
-			"is not less than the start address of the global data",
-			bh.data_start_address);
+// Run m on the already loaded program until it executes EXIT
+// or an error occurs (which is reported on m's error stream),
+// producing any trace output called for by the program
+// if trace_execution is true.
+// Return the program's exit code, or EXIT_FAILURE after an error
+// (or if a read_char callback said its input would block).
+int machine_run(machine_t *m, bool trace_execution)
+{
+    m->tracing = trace_execution;
+    if (m->btrace != NULL) {
+	btrace_start_run(m->btrace, m->tracing);
+    } else if (m->tracing) {
+	machine_print_state(m, m->out);
     }
-    if (bh.data_start_address + bh.data_length >= bh.stack_bottom_addr) {
-	bail_with_error("%s (%u) + %s (%u) %s (%u)!",
-			"Global data start address", bh.data_start_address,
-			"global data length", bh.data_length,
-			"is not less than the stack bottom address",
-			bh.stack_bottom_addr);
+    machine_status status = machine_run_steps(m, 0);
+    if (m->btrace != NULL) {
+	btrace_end_run(m->btrace, m->exit_code,
+		       status == machine_failed ? m->error_message : NULL,
+		       m->recording_pc, m->memory->uwords[m->recording_pc],
+		       m->recording_flags);
     }
-    if (bh.stack_bottom_addr >= MEMORY_SIZE_IN_WORDS) {
-	bail_with_error("%s (%u) %s (%u)!",
-			"stack_bottom_addr", bh.stack_bottom_addr,
-			"is not less than the memory size",
-			MEMORY_SIZE_IN_WORDS);
+    if (status != machine_exited) {
+	return EXIT_FAILURE;
     }
+    return m->exit_code;
+}
+
+// Record a binary trace of each run of m in bt (see btrace.h),
+// instead of printing the text trace, or stop recording if bt is NULL.
+// (The instructions are executed one at a time, whatever the engine.)
+void machine_set_binary_trace(machine_t *m, btrace_t *bt)
+{
+    m->btrace = bt;
+    m->logging_writes = bt != NULL;
+}
 
-    // load the program
-    instruction_words = bh.text_length;
-    load_instructions(bf, instruction_words);
+// Make the text trace of m print only the registers (and HI and LO)
+// and memory words that each instruction changes, if on is true,
+// with the whole state every keyframe_interval instructions traced
+// (or only when tracing starts, if keyframe_interval is 0);
+// otherwise print the whole state after each instruction
+void machine_set_delta_trace(machine_t *m, bool on,
+			     unsigned long keyframe_interval)
+{
+    m->delta_tracing = on;
+    m->keyframe_interval = keyframe_interval;
+    m->since_keyframe = 0;
+}
 
-    global_data_words = bh.data_length;
-    
-    load_data(bf, global_data_words, bh.data_start_address);
+// Return the exit code given by the program's EXIT instruction
+// (or EXIT_SUCCESS if it has not exited)
+int machine_exit_code(machine_t *m)
+{
+    return m->exit_code;
+}
 
-    // initialize the registers
-    PC = bh.text_start_address;
+// Return the message describing the error that stopped m's last load
+// or run, or NULL if there was none
+const char *machine_error_message(machine_t *m)
+{
+    return m->failed ? m->error_message : NULL;
+}
 
-    GPR[GP] = bh.data_start_address;
-    GPR[SP] = bh.stack_bottom_addr;
-    GPR[FP] = bh.stack_bottom_addr;
-    initial_stack_bottom = bh.stack_bottom_addr;
+// Return the size of m's memory (in words)
+address_type machine_memory_size(machine_t *m)
+{
+    return m->memory_words;
 }
 
-// Requires: fmt == 'x' or fmt == 'd'
-// print the memory location at word address wa to out
-// with a format determined by fmt and no newline,
-// returns the number of characters written
-static int print_loc(FILE *out, address_type wa, char fmt)
+// Return the value of the program counter of m
+address_type machine_pc(machine_t *m)
 {
-    int count;
-    if (fmt == 'x') {
-	count = fprintf(out, "%8d: 0x%x\t", wa,
-			memory.words[wa]);
-    } else { // fmt == 'd'
-	count = fprintf(out, "%8d: %d\t", wa,
-			memory.words[wa]);
-    }
-    return count;
+    return m->PC;
 }
 
-// print the word address given and the instruction's assembly form
-static void print_instruction(FILE *out, address_type wa, bin_instr_t bi)
+// Requires: r < NUM_REGISTERS
+// Return the value of the general purpose register r of m
+word_type machine_register(machine_t *m, unsigned int r)
 {
-    fprintf(out, "%6d: %s\n", wa, instruction_assembly_form(wa, bi));
+    return m->GPR[r];
 }
 
-// Print the word memory in hex or decimal based on the fmt argument
-// between the word addresses start (inclusive) and end (inclusive) to out,
-// without a newline and eliding all repeated zeros in the range
-// Returns true if printed a newline at the end, false otherwise
-static bool print_memory_nonzero(FILE *out, int start, int end, char fmt)
+// Return the symbols of the program loaded into m (from its symbols
+// section, see bof.h), or NULL if it has none
+const bof_symbols_t *machine_symbols(machine_t *m)
 {
-    bool printed_trailing_newline = false;
-    bool previously_zero = false; // was previous word printed a 0?
-    bool printed_dots = false;   // have we already printed dots?
-    int lc = 0;   // count of chars on a line
-    for (int wa = start; wa <= end; wa++) {
-	if (lc > MAX_PRINT_WIDTH) {
-	    newline(out);
-	    printed_trailing_newline = true;
-	    lc = 0;
-	}
-	if (memory.words[wa] != 0) {
-	    lc += print_loc(out, wa, fmt);
-	    printed_trailing_newline = false;
-	    previously_zero = false;
-	    printed_dots = false;
-	} else {
-	    // memory.words[wa] == 0
-	    if (!previously_zero) {
-		// print the first zero
-		lc += print_loc(out, wa, fmt);
-		previously_zero = true;
-		printed_dots = false;
-	    } else {
-		// previously printed a zero
-		if (!printed_dots) {
-		    // not already printed the dots, so print them now
-		    lc += fprintf(out, "%s", "        ...     ");
-		    printed_dots = true;
-		}
-	    }
-	    printed_trailing_newline = false;
-	}
+    return m->symbol_bytes != NULL ? &m->symbols : NULL;
+}
+
+// Put the values of m's HI and LO registers in *hi and *lo
+void machine_hi_lo(machine_t *m, word_type *hi, word_type *lo)
+{
+    *hi = m->hilo_regs.hilo[HI];
+    *lo = m->hilo_regs.hilo[LO];
+}
+
+// Copy the count words of m's memory starting at word address wa
+// into words, returning false (and copying nothing)
+// if any of them are outside of memory
+bool machine_read_memory(machine_t *m, address_type wa, word_type *words,
+			 unsigned int count)
+{
+    if (wa > m->memory_words || count > m->memory_words - wa) {
+	return false;
     }
-    return printed_trailing_newline;
+    memcpy(words, &m->memory->words[wa], count * sizeof(word_type));
+    return true;
 }
 
-// print the nonzero memory locations between the word addresses
-// start and end (both inclusive) on out, in decimal notation
-// a trailing newline was printed if the result is true
-static bool print_memory_words_d(FILE *out, int start, int end)
+// Requires: pc is in m's memory
+// Make pc the value of m's program counter
+void machine_set_pc(machine_t *m, address_type pc)
 {
-    return print_memory_nonzero(out, start, end, 'd');
+    m->PC = pc;
+    m->stopped = false;
 }
 
-// Print the global area, eliding repeated zeros,
-// starting at GPR[GP]
-static void print_global_data(FILE *out)
+// Requires: r < NUM_REGISTERS
+// Make w the value of the general purpose register r of m
+void machine_set_register(machine_t *m, unsigned int r, word_type w)
 {
-    int global_wa = GPR[GP];
-    bool printed_nl;
-    printed_nl = print_memory_words_d(out, global_wa, GPR[SP]-1);
-    if (!printed_nl) {
-	newline(out);
+    m->GPR[r] = w;
+}
+
+// Make hi and lo the values of m's HI and LO registers
+void machine_set_hi_lo(machine_t *m, word_type hi, word_type lo)
+{
+    m->hilo_regs.hilo[HI] = hi;
+    m->hilo_regs.hilo[LO] = lo;
+}
+
+// Copy the count words at words into m's memory starting at
+// word address wa, returning false (and copying nothing)
+// if any of them are outside of memory
+bool machine_write_memory(machine_t *m, address_type wa,
+			  const word_type *words, unsigned int count)
+{
+    if (wa > m->memory_words || count > m->memory_words - wa) {
+	return false;
+    }
+    for (unsigned int i = 0; i < count; i++) {
+	store_word(m, wa + i, words[i]);
     }
+    return true;
 }
 
-// Requires: a program has been loaded into the computer's memory
-// print a heading and the program and any global data
-// that were previously loaded into the VM's memory to out
-void machine_print_loaded_program(FILE *out)
+// Requires: a program has been loaded into m
+// Make the runs of m stop (see machine_run_steps) before executing
+// the instruction at addr, by replacing its decoded entry
+// with a DOP_BREAK entry (so the run loops check nothing).
+// Return false (setting none) if addr is not in the text section,
+// m has MACHINE_MAX_BREAKPOINTS already, or uses the JIT engine.
+bool machine_set_breakpoint(machine_t *m, address_type addr)
 {
-    // heading
-    instruction_print_table_heading(out);
-    // instructions
-    for (int wa = 0; wa < instruction_words; wa++) {
-	print_instruction(out, wa, memory.instrs[wa]);
+    if (addr >= m->instruction_words || m->engine == jit_engine) {
+	return false;
+    }
+    if (breakpoint_index(m, addr) >= 0) {
+	return true;
+    }
+    if (m->breakpoints == NULL) {
+	m->breakpoints = calloc(MACHINE_MAX_BREAKPOINTS, sizeof(breakpoint_t));
+	if (m->breakpoints == NULL) {
+	    return false;
+	}
+    }
+    if (m->num_breakpoints == MACHINE_MAX_BREAKPOINTS) {
+	return false;
     }
+    // the breakpoint's instruction must be dispatched by itself
+    unfuse_at(m, addr);
+    m->breakpoints[m->num_breakpoints].addr = addr;
+    patch_breakpoint(m, m->num_breakpoints++);
+    return true;
+}
 
-    print_global_data(out);
+// Remove the breakpoint at addr from m,
+// returning false if there is none
+bool machine_clear_breakpoint(machine_t *m, address_type addr)
+{
+    int b = breakpoint_index(m, addr);
+    if (b < 0) {
+	return false;
+    }
+    m->decoded[addr] = m->breakpoints[b].saved;
+    m->breakpoints[b] = m->breakpoints[--m->num_breakpoints];
+    return true;
 }
 
-// Run the VM on the already loaded program,
-// producing any trace output called for by the program
-void machine_run(bool trace_execution)
+// Requires: a program has been loaded into m
+// Make the runs of m stop (see machine_run_steps) after an instruction
+// stores into any of the count words starting at word address wa.
+// The pages holding them are only readable while m runs, so only
+// the stores into those pages cost anything (a fault each).
+// Superinstructions are not used while m has watchpoints.
+// Return false (setting none) if count is 0 or the words are not
+// all in memory, m has MACHINE_MAX_WATCHPOINTS already, m uses
+// the stack-cached or JIT engine (whose stores are not made one by one),
+// or this host cannot protect pages.
+bool machine_set_watchpoint(machine_t *m, address_type wa,
+			    unsigned int count)
+{
+#ifdef MACHINE_MMAP
+    if (count == 0 || wa >= m->memory_words || count > m->memory_words - wa
+	|| m->num_watchpoints == MACHINE_MAX_WATCHPOINTS
+	|| m->engine == stack_cached_engine || m->engine == jit_engine) {
+	return false;
+    }
+    // each store must be followed by the dispatch of the next instruction
+    unfuse_all(m);
+    m->watch_page_bytes = (size_t) sysconf(_SC_PAGESIZE);
+    m->watchpoints[m->num_watchpoints].addr = wa;
+    m->watchpoints[m->num_watchpoints].count = count;
+    m->num_watchpoints++;
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Remove the watchpoint starting at word address wa from m,
+// returning false if there is none
+bool machine_clear_watchpoint(machine_t *m, address_type wa)
 {
-    tracing = trace_execution;
-    if (tracing) {
-	machine_print_state(stdout);
+    for (unsigned int i = 0; i < m->num_watchpoints; i++) {
+	if (m->watchpoints[i].addr == wa) {
+	    m->watchpoints[i] = m->watchpoints[--m->num_watchpoints];
+	    return true;
+	}
     }
-    // execute the program
-    while (running) {
-	machine_okay(); // check the invariant
-	machine_trace_execute_instr(stdout, PC, memory.instrs[PC]);
+    return false;
+}
+
+// If the last run of m stopped after a store into a watched word,
+// put its word address in *wa and the value it held before in *old,
+// and return true; otherwise return false
+bool machine_watch_hit(machine_t *m, address_type *wa, word_type *old)
+{
+    if (!m->stopped || !m->watch_hit) {
+	return false;
     }
+    *wa = m->watch_addr;
+    *old = m->watch_old;
+    return true;
 }
 
-// Load the given binary object file and run it
-void machine_load_and_run(BOFFILE bf, bool trace_execution)
+// Load the given binary object file into m and run it,
+// returning the program's exit code (or EXIT_FAILURE after an error)
+int machine_load_and_run(machine_t *m, BOFFILE bf, bool trace_execution)
 {
-    machine_load(bf);
-    machine_run(trace_execution);
+    if (!machine_load(m, bf)) {
+	return EXIT_FAILURE;
+    }
+    return machine_run(m, trace_execution);
 }
 
 // Requires: addr == PC.
@@ -262,27 +2331,35 @@ void machine_load_and_run(BOFFILE bf, bool trace_execution)
 // then execute bi (always),
 // then if tracing print out the machine's state.
 // All tracing output goes to the FILE out
-void machine_trace_execute_instr(FILE *out, address_type addr,
+void machine_trace_execute_instr(machine_t *m, FILE *out, address_type addr,
 				 bin_instr_t bi)
 {
-    assert(addr == PC);
-    if (tracing) {
+    assert(addr == m->PC);
+    if (m->tracing) {
+	vmio_flush(m->buffers); // so the trace follows the program's output
+	trace_source_line(m, out, m->PC);
 	fprintf(out, "\n==> ");
-	print_instruction(out, PC, bi);
+	print_instruction(out, m->PC, bi);
+    }
+    if (addr < m->instruction_words) {
+	machine_execute_decoded(m, addr);
+    } else {
+	machine_execute_instr(m, addr, bi);
     }
-    machine_execute_instr(addr, bi);
-    if (tracing) {
-	machine_print_state(out);
+    // (the program has ended if it executed EXIT)
+    if (m->tracing && m->running) {
+	machine_print_state(m, out);
     }
 }
 
 // Requires: The instruction at memory.instrs[PC] is bi.
 // Execute the given instruction, which is found at word address addr,
 // in the machine's current state
-void machine_execute_instr(address_type addr, bin_instr_t bi)
+void machine_execute_instr(machine_t *m, address_type addr, bin_instr_t bi)
 {
+    flight_record(m, addr);
     // increment the PC (advance address by 1 word)
-    PC = PC + 1;
+    m->PC = m->PC + 1;
 
     // execute the actual instruction
     instr_type it = instruction_type(bi);
@@ -295,75 +2372,75 @@ void machine_execute_instr(address_type addr, bin_instr_t bi)
 		// do nothing
 		break;
 	    case ADD_F:
-		memory.words[GPR[ci.rt] + machine_types_formOffset(ci.ot)]
-		    = memory.words[GPR[SP]]
-			  + memory.words[GPR[ci.rs] + machine_types_formOffset(ci.os)];
+		store_word(m, m->GPR[ci.rt] + machine_types_formOffset(ci.ot),
+		    m->memory->words[m->GPR[SP]]
+			  + m->memory->words[m->GPR[ci.rs] + machine_types_formOffset(ci.os)]);
 		break;
 	    case SUB_F:
-		memory.words[GPR[ci.rt] + machine_types_formOffset(ci.ot)]
-		    = memory.words[GPR[SP]]
-		    - memory.words[GPR[ci.rs]
-				   + machine_types_formOffset(ci.os)];
+		store_word(m, m->GPR[ci.rt] + machine_types_formOffset(ci.ot),
+		    m->memory->words[m->GPR[SP]]
+		    - m->memory->words[m->GPR[ci.rs]
+				   + machine_types_formOffset(ci.os)]);
 		break;
 	    case CPW_F:
-		memory.words[GPR[ci.rt] + machine_types_formOffset(ci.ot)]
-		    = memory.words[GPR[ci.rs]
-				   + machine_types_formOffset(ci.os)];
+		store_word(m, m->GPR[ci.rt] + machine_types_formOffset(ci.ot),
+		    m->memory->words[m->GPR[ci.rs]
+				   + machine_types_formOffset(ci.os)]);
 		break;
 	    case CPR_F:
-		GPR[ci.rt] = GPR[ci.rs];
+		m->GPR[ci.rt] = m->GPR[ci.rs];
 		break;
 	    case AND_F:
-		memory.uwords[GPR[ci.rt] + machine_types_formOffset(ci.ot)]
-		    = memory.uwords[GPR[SP]]
-		    & memory.uwords[GPR[ci.rs]
-				    + machine_types_formOffset(ci.os)];
+		store_uword(m, m->GPR[ci.rt] + machine_types_formOffset(ci.ot),
+		    m->memory->uwords[m->GPR[SP]]
+		    & m->memory->uwords[m->GPR[ci.rs]
+				    + machine_types_formOffset(ci.os)]);
 		break;
 	    case BOR_F:
-		memory.uwords[GPR[ci.rt] + machine_types_formOffset(ci.ot)]
-		    = memory.uwords[GPR[SP]]
-		    | memory.uwords[GPR[ci.rs]
-				    + machine_types_formOffset(ci.os)];
+		store_uword(m, m->GPR[ci.rt] + machine_types_formOffset(ci.ot),
+		    m->memory->uwords[m->GPR[SP]]
+		    | m->memory->uwords[m->GPR[ci.rs]
+				    + machine_types_formOffset(ci.os)]);
 		break;
 	    case NOR_F:
-		memory.uwords[GPR[ci.rt] + machine_types_formOffset(ci.ot)]
-		    = ~(memory.uwords[GPR[SP]]
-			| memory.uwords[GPR[ci.rs]
-					+ machine_types_formOffset(ci.os)]);
+		store_uword(m, m->GPR[ci.rt] + machine_types_formOffset(ci.ot),
+		    ~(m->memory->uwords[m->GPR[SP]]
+			| m->memory->uwords[m->GPR[ci.rs]
+					+ machine_types_formOffset(ci.os)]));
 		break;
 	    case XOR_F:
-		memory.uwords[GPR[ci.rt] + machine_types_formOffset(ci.ot)]
-		    = memory.uwords[GPR[SP]]
-		    ^ memory.uwords[GPR[ci.rs]
-				    + machine_types_formOffset(ci.os)];
+		store_uword(m, m->GPR[ci.rt] + machine_types_formOffset(ci.ot),
+		    m->memory->uwords[m->GPR[SP]]
+		    ^ m->memory->uwords[m->GPR[ci.rs]
+				    + machine_types_formOffset(ci.os)]);
 		break;
 	    case LWR_F:
-		GPR[ci.rt]
-		    = memory.words[GPR[ci.rs]
+		m->GPR[ci.rt]
+		    = m->memory->words[m->GPR[ci.rs]
 				   + machine_types_formOffset(ci.os)];
 		break;
 	    case SWR_F:
-		memory.words[GPR[ci.rt]
-			     + machine_types_formOffset(ci.ot)]
-		    = GPR[ci.rs];
+		store_word(m, m->GPR[ci.rt]
+			     + machine_types_formOffset(ci.ot),
+		    m->GPR[ci.rs]);
 		break;
 	    case SCA_F:
-		memory.words[GPR[ci.rt] + machine_types_formOffset(ci.ot)]
-		    = (GPR[ci.rs] + machine_types_formOffset(ci.os));
+		store_word(m, m->GPR[ci.rt] + machine_types_formOffset(ci.ot),
+		    (m->GPR[ci.rs] + machine_types_formOffset(ci.os)));
 		break;
 	    case LWI_F:
-		memory.words[GPR[ci.rt] + machine_types_formOffset(ci.ot)]
-		    = memory.words[memory.words
-				   [GPR[ci.rs] + machine_types_formOffset(ci.os)]];
+		store_word(m, m->GPR[ci.rt] + machine_types_formOffset(ci.ot),
+		    m->memory->words[m->memory->words
+				   [m->GPR[ci.rs] + machine_types_formOffset(ci.os)]]);
 		    break;
 	    case NEG_F:
-		memory.words[GPR[ci.rt] + machine_types_formOffset(ci.ot)]
-		    = - (memory.words[GPR[ci.rs]
-				      + machine_types_formOffset(ci.os)]);
+		store_word(m, m->GPR[ci.rt] + machine_types_formOffset(ci.ot),
+		    - (m->memory->words[m->GPR[ci.rs]
+				      + machine_types_formOffset(ci.os)]));
 		break;
 	    default:
-		bail_with_error("Invalid function code (%d) in machine_execute's COMP_O computational instruction case!",
-				ci.func);
+		machine_error(m, "Invalid function code (%d) in machine_execute's COMP_O computational instruction case!",
+				 ci.func);
 		break;
 	    }
 	}
@@ -373,65 +2450,65 @@ void machine_execute_instr(address_type addr, bin_instr_t bi)
 	    other_comp_instr_t oci = bi.othc;
 	    switch (oci.func) {
 	    case LIT_F:
-		memory.words[GPR[oci.reg] + machine_types_sgnExt(oci.offset)]
-			     = machine_types_sgnExt(oci.arg);
+		store_word(m, m->GPR[oci.reg] + machine_types_sgnExt(oci.offset),
+			     machine_types_sgnExt(oci.arg));
 	        break;
 	    case ARI_F:
-		GPR[oci.reg] = GPR[oci.reg] + machine_types_sgnExt(oci.arg);
+		m->GPR[oci.reg] = m->GPR[oci.reg] + machine_types_sgnExt(oci.arg);
 		break;
 	    case SRI_F:
-		GPR[oci.reg] = GPR[oci.reg] - machine_types_sgnExt(oci.arg);
+		m->GPR[oci.reg] = m->GPR[oci.reg] - machine_types_sgnExt(oci.arg);
 		break;
 	    case MUL_F:
-		hilo_regs.result
-		    = (long) memory.words[GPR[SP]]
-		      * (long) memory.words[GPR[oci.reg]
+		m->hilo_regs.result
+		    = (long) m->memory->words[m->GPR[SP]]
+		      * (long) m->memory->words[m->GPR[oci.reg]
 				     + machine_types_formOffset(oci.offset)];
 		break;
 	    case DIV_F:
-		int divisor = memory.words[GPR[oci.reg]
+		int divisor = m->memory->words[m->GPR[oci.reg]
 				     + machine_types_formOffset(oci.offset)];
 		if (divisor == 0) {
-		    bail_with_error("Error: Attempt to divide by zero!");
+		    machine_error(m, "Error: Attempt to divide by zero!");
 		}
-		hilo_regs.hilo[HI] = memory.words[GPR[SP]] % divisor;
-		hilo_regs.hilo[LO] = memory.words[GPR[SP]] / divisor;
+		m->hilo_regs.hilo[HI] = m->memory->words[m->GPR[SP]] % divisor;
+		m->hilo_regs.hilo[LO] = m->memory->words[m->GPR[SP]] / divisor;
 		break;
 	    case CFHI_F:
-		memory.words[GPR[oci.reg]
-				 + machine_types_formOffset(oci.offset)]
-		    = hilo_regs.hilo[HI];
+		store_word(m, m->GPR[oci.reg]
+				 + machine_types_formOffset(oci.offset),
+		    m->hilo_regs.hilo[HI]);
 		break;
 	    case CFLO_F:
-		memory.words[GPR[oci.reg]
-				 + machine_types_formOffset(oci.offset)]
-		    = hilo_regs.hilo[LO];
+		store_word(m, m->GPR[oci.reg]
+				 + machine_types_formOffset(oci.offset),
+		    m->hilo_regs.hilo[LO]);
 		break;
 	    case SLL_F:
-		memory.uwords[GPR[oci.reg]
-			     + machine_types_formOffset(oci.offset)]
-		    = memory.uwords[GPR[SP]] << oci.arg;
+		store_uword(m, m->GPR[oci.reg]
+			     + machine_types_formOffset(oci.offset),
+		    m->memory->uwords[m->GPR[SP]] << oci.arg);
 		break;
 	    case SRL_F:
-		memory.uwords[GPR[oci.reg]
-			     + machine_types_formOffset(oci.offset)]
-		    = memory.uwords[GPR[SP]] >> oci.arg;
+		store_uword(m, m->GPR[oci.reg]
+			     + machine_types_formOffset(oci.offset),
+		    m->memory->uwords[m->GPR[SP]] >> oci.arg);
 		break;
 	    case JMP_F:
-		PC = memory.uwords[GPR[oci.reg]
+		m->PC = m->memory->uwords[m->GPR[oci.reg]
 				   + machine_types_formOffset(oci.offset)];
 		break;
 	    case CSI_F:
-		GPR[RA] = PC;
-		PC = memory.words[GPR[oci.reg]
+		m->GPR[RA] = m->PC;
+		m->PC = m->memory->words[m->GPR[oci.reg]
 				  + machine_types_formOffset(oci.offset)];
 		break;
 	    case JREL_F:
-		PC = (PC - 1) + machine_types_formOffset(oci.arg);
+		m->PC = (m->PC - 1) + machine_types_formOffset(oci.arg);
 		break;
 	    default:
-		bail_with_error("Invalid function code (%d) in machine_execute's OTHC_O computational instruction case!",
-				oci.func);
+		machine_error(m, "Invalid function code (%d) in machine_execute's OTHC_O computational instruction case!",
+				 oci.func);
 		break;
 	    }
 	}
@@ -441,40 +2518,39 @@ void machine_execute_instr(address_type addr, bin_instr_t bi)
 	    syscall_instr_t si = bi.syscall;
 	    switch (si.code) {
 	    case exit_sc:
-		running = false;
-		exit(machine_types_sgnExt(si.offset));
+		m->running = false;
+		m->exit_code = machine_types_sgnExt(si.offset);
 		break;
 	    case print_str_sc:
-		memory.words[GPR[SP]]
-		    = printf("%s",
-			     (char *) &(memory.words[GPR[si.reg]
-						     + machine_types_formOffset(si.offset)]));
+		store_word(m, m->GPR[SP],
+		    sys_print_str(m,
+			     (char *) &(m->memory->words[m->GPR[si.reg]
+						     + machine_types_formOffset(si.offset)])));
 		break;
 	    case print_int_sc:
-		memory.words[GPR[SP]]
-		    = printf("%d",
-			     memory.words[GPR[si.reg]
-					  + machine_types_formOffset(si.offset)]);
+		store_word(m, m->GPR[SP],
+		    sys_print_int(m,
+			     m->memory->words[m->GPR[si.reg]
+					  + machine_types_formOffset(si.offset)]));
 		break;
 	    case print_char_sc:
-		memory.words[GPR[SP]]
-		    = fputc(memory.words[GPR[si.reg]
-					     + machine_types_formOffset(si.offset)],
-			    stdout);
+		store_word(m, m->GPR[SP],
+		    sys_print_char(m, m->memory->words[m->GPR[si.reg]
+					     + machine_types_formOffset(si.offset)]));
 		break;
 	    case read_char_sc:
-		memory.words[GPR[si.reg] + machine_types_formOffset(si.offset)]
-		    = getc(stdin);
+		store_word(m, m->GPR[si.reg] + machine_types_formOffset(si.offset),
+		    sys_read_char(m));
 		break;
 	    case start_tracing_sc:
-		tracing = true;
+		m->tracing = true;
 		break;
 	    case stop_tracing_sc:
-		tracing = false;
+		m->tracing = false;
 		break;
 	    default:
-		bail_with_error("Invalid system call type (%d) in machine_execute's syscall instruction case!",
-				instruction_syscall_number(bi));
+		machine_error(m, "Invalid system call type (%d) in machine_execute's syscall instruction case!",
+				 instruction_syscall_number(bi));
 		break;
 	    }
 	}
@@ -485,79 +2561,79 @@ void machine_execute_instr(address_type addr, bin_instr_t bi)
 	    uimmed_instr_t ui = bi.uimmed;
 	    switch (ii.op) {
 	    case ADDI_O:
-		memory.words[GPR[ii.reg] + machine_types_formOffset(ii.offset)]
-		    = memory.words[GPR[ii.reg] + machine_types_formOffset(ii.offset)]
-		      + machine_types_sgnExt(ii.immed);
+		store_word(m, m->GPR[ii.reg] + machine_types_formOffset(ii.offset),
+		    m->memory->words[m->GPR[ii.reg] + machine_types_formOffset(ii.offset)]
+		      + machine_types_sgnExt(ii.immed));
 		break;
 	    case ANDI_O:
-		memory.uwords[GPR[ui.reg] + machine_types_formOffset(ui.offset)]
-		    = memory.uwords[GPR[ui.reg]
+		store_uword(m, m->GPR[ui.reg] + machine_types_formOffset(ui.offset),
+		    m->memory->uwords[m->GPR[ui.reg]
 				    + machine_types_formOffset(ui.offset)]
-		      & machine_types_zeroExt(ui.uimmed);
+		      & machine_types_zeroExt(ui.uimmed));
 		break;
 	    case BORI_O:
-		memory.uwords[GPR[ui.reg] + machine_types_formOffset(ui.offset)]
-		    = memory.uwords[GPR[ui.reg]
+		store_uword(m, m->GPR[ui.reg] + machine_types_formOffset(ui.offset),
+		    m->memory->uwords[m->GPR[ui.reg]
 				    + machine_types_formOffset(ui.offset)]
-		      | machine_types_zeroExt(ui.uimmed);
+		      | machine_types_zeroExt(ui.uimmed));
 		break;
 	    case NORI_O:
-		memory.uwords[GPR[ui.reg] + machine_types_formOffset(ui.offset)]
-		    = ~(memory.uwords[GPR[ui.reg]
+		store_uword(m, m->GPR[ui.reg] + machine_types_formOffset(ui.offset),
+		    ~(m->memory->uwords[m->GPR[ui.reg]
 				      + machine_types_formOffset(ui.offset)]
-			| machine_types_zeroExt(ui.uimmed));
+			| machine_types_zeroExt(ui.uimmed)));
 		break;
 	    case XORI_O:
-		memory.uwords[GPR[ui.reg] + machine_types_formOffset(ui.offset)]
-		    = memory.uwords[GPR[ui.reg]
+		store_uword(m, m->GPR[ui.reg] + machine_types_formOffset(ui.offset),
+		    m->memory->uwords[m->GPR[ui.reg]
 				    + machine_types_formOffset(ui.offset)]
-		      ^ machine_types_zeroExt(ui.uimmed);
+		      ^ machine_types_zeroExt(ui.uimmed));
 		break;
 	    case BEQ_O:
-		if (memory.words[GPR[SP]]
-		    == memory.words[GPR[ii.reg]
+		if (m->memory->words[m->GPR[SP]]
+		    == m->memory->words[m->GPR[ii.reg]
 					+ machine_types_formOffset(ii.offset)]) {
-		    PC = (PC - 1) + machine_types_formOffset(ii.immed);
+		    m->PC = (m->PC - 1) + machine_types_formOffset(ii.immed);
 		}
 		break;
 	    case BGEZ_O:
-		if (memory.words[GPR[ii.reg]
+		if (m->memory->words[m->GPR[ii.reg]
 				     + machine_types_formOffset(ii.offset)]
 		    >= 0) {
-		    PC = (PC - 1) + machine_types_formOffset(ii.immed);
+		    m->PC = (m->PC - 1) + machine_types_formOffset(ii.immed);
 		}
 		break;
 	    case BGTZ_O:
-		if (memory.words[GPR[ii.reg]
+		if (m->memory->words[m->GPR[ii.reg]
 				     + machine_types_formOffset(ii.offset)]
 		    > 0) {
-		    PC = (PC - 1) + machine_types_formOffset(ii.immed);
+		    m->PC = (m->PC - 1) + machine_types_formOffset(ii.immed);
 		}
 		break;
 	    case BLEZ_O:
-		if (memory.words[GPR[ii.reg]
+		if (m->memory->words[m->GPR[ii.reg]
 				     + machine_types_formOffset(ii.offset)]
 		    <= 0) {
-		    PC = (PC - 1) + machine_types_formOffset(ii.immed);
+		    m->PC = (m->PC - 1) + machine_types_formOffset(ii.immed);
 		}
 		break;
 	    case BLTZ_O:
-		if (memory.words[GPR[ii.reg]
+		if (m->memory->words[m->GPR[ii.reg]
 				     + machine_types_formOffset(ii.offset)]
 		    < 0) {
-		    PC = (PC - 1) + machine_types_formOffset(ii.immed);
+		    m->PC = (m->PC - 1) + machine_types_formOffset(ii.immed);
 		}
 		break;
 	    case BNE_O:
-		if (memory.words[GPR[SP]]
-		    != memory.words[GPR[ii.reg]
+		if (m->memory->words[m->GPR[SP]]
+		    != m->memory->words[m->GPR[ii.reg]
 					+ machine_types_formOffset(ii.offset)]) {
-		    PC = (PC - 1) + machine_types_formOffset(ii.immed);
+		    m->PC = (m->PC - 1) + machine_types_formOffset(ii.immed);
 		}
 		break;
 	    default:
-		bail_with_error("Invalid opcode (%d) in machine_execute's immediate instruction case!",
-				ii.op);	    
+		machine_error(m, "Invalid opcode (%d) in machine_execute's immediate instruction case!",
+				 ii.op);	    
 		break;
 	    }
 	}
@@ -567,42 +2643,500 @@ void machine_execute_instr(address_type addr, bin_instr_t bi)
 	    jump_instr_t ji = bi.jump;
 	    switch (ji.op) {
 	    case JMPA_O:
-		PC = machine_types_formAddress(PC-1, ji.addr);
+		m->PC = machine_types_formAddress(m->PC-1, ji.addr);
 		break;
 	    case CALL_O:
-		GPR[RA] = PC;
-		PC = machine_types_formAddress(PC-1, ji.addr);
+		m->GPR[RA] = m->PC;
+		m->PC = machine_types_formAddress(m->PC-1, ji.addr);
 		break;
 	    case RTN_O:
-		PC = GPR[RA];
+		m->PC = m->GPR[RA];
 		break;
 	    default:
-		bail_with_error("Invalid opcode (%d) in machine_execute's jump instruction case!",
-				ji.op);	    
+		machine_error(m, "Invalid opcode (%d) in machine_execute's jump instruction case!",
+				 ji.op);	    
 		break;
 	    }
 	}
 	break;
     default:
-	bail_with_error("Invalid instruction type (%d) in machine_execute!",
-			it);
+	machine_error(m, "Invalid instruction type (%d) in machine_execute!",
+			 it);
 	break;
     }
 }
 
-#define    REGFORMAT1 "GPR[%-3s]: %-5d"
-#define    REGFORMAT2 "\tGPR[%-3s]: %-5d"
+// Exit with an error message if the word address wa,
+// used by the instruction at address addr, is outside of memory
+static void check_address(machine_t *m, word_type wa, address_type addr)
+{
+    if (wa < 0 || (address_type) wa >= m->memory_words) {
+	machine_error(m, "%s %u %s (%d) %s!",
+			 "Error: the instruction at address", addr,
+			 "uses an address", wa, "that is outside of memory");
+    }
+}
+
+// Requires: d is the plain decoded form (with op as its plain decoded_op)
+// of the instruction at address addr, and regs holds the values of
+// the registers when it starts
+// Check that d uses only addresses in memory, and keeps the invariant,
+// exiting with an error message if it does not (see verify.h).
+// Change regs to the values of the registers after d.
+static void check_instr(machine_t *m, const decoded_instr_t *d, decoded_op op,
+			address_type addr, word_type *regs)
+{
+    verify_operand_t operands[VERIFY_MAX_OPERANDS];
+    int n = verify_operands(op, d, operands);
+    for (int i = 0; i < n; i++) {
+	check_address(m, regs[operands[i].reg] + operands[i].offset, addr);
+    }
+    switch (op) {
+    case DOP_LWI:
+	check_address(m, m->memory->words[regs[d->rb] + d->ob], addr);
+	return;
+    case DOP_PSTR:
+	{
+	    // the string must end before the end of memory
+	    word_type wa = regs[d->ra] + d->oa;
+	    if (memchr(&m->memory->words[wa], '\0',
+		       (m->memory_words - wa) * BYTES_PER_WORD) == NULL) {
+		machine_error(m, "%s %u %s!",
+				 "Error: the instruction at address", addr,
+				 "prints a string that runs past the end of memory");
+	    }
+	}
+	return;
+    case DOP_CPR:
+	regs[d->ra] = regs[d->rb];
+	break;
+    case DOP_LWR:
+	regs[d->ra] = m->memory->words[regs[d->rb] + d->ob];
+	break;
+    case DOP_ARI:
+	regs[d->ra] = regs[d->ra] + d->imm;
+	break;
+    case DOP_SRI:
+	regs[d->ra] = regs[d->ra] - d->imm;
+	break;
+    default:
+	return;
+    }
+    if (!(0 <= regs[GP] && regs[GP] < regs[SP] && regs[SP] <= regs[FP]
+	  && (address_type) regs[FP] < m->memory_words)) {
+	machine_error(m, "%s %u %s (%s) %s!",
+			 "Error: the instruction at address", addr,
+			 "would break the invariant",
+			 "0 <= $gp < $sp <= $fp < memory size",
+			 "by changing a register");
+    }
+}
+
+// Requires: di->op == DOP_CHECK, and di is the entry for PC-1
+// Check that di->checked, when executed in the current state,
+// uses only addresses in memory and keeps the invariant,
+// exiting with an error message if it does not (see verify.h).
+// A superinstruction is checked one instruction at a time,
+// as the register changes it makes do not depend on its own stores.
+static void check_decoded(machine_t *m, const decoded_instr_t *di)
+{
+    word_type regs[NUM_REGISTERS];
+    memcpy(regs, m->GPR, sizeof(regs));
+    decoded_op op = di->checked;
+    if (DECODE_IS_FUSED(op)) {
+	for (int k = 0; k < fusion_length(op); k++) {
+	    check_instr(m, &di[k], fusion_op(op, k), m->PC - 1 + k, regs);
+	}
+    } else {
+	check_instr(m, di, op, m->PC - 1, regs);
+    }
+}
+
+// Requires: addr == PC and addr < the length of the text section
+// Execute the decoded form of the instruction at word address addr
+// in the machine's current state
+void machine_execute_decoded(machine_t *m, address_type addr)
+{
+    const decoded_instr_t *di;
+    decoded_instr_t plain;
+    unsigned int op;  // a decoded_op
+#define CASE(op) case op
+#define NEXT return
+#define NEXT_CHECKED return
+#define REDISPATCH goto dispatch
+#define DISPATCH(dop) do { op = (dop); goto run; } while (0)
+#define LEAVE return
+#define UNDONE(k)
+    flight_record(m, addr);
+ dispatch:
+    di = &m->decoded[m->PC];
+    if (DECODE_IS_FUSED(DECODE_OP(di))) {
+	// only execute one instruction, so use its plain decoded form
+	plain = decode_again(m, m->PC);
+	di = &plain;
+    }
+    // increment the PC (advance address by 1 word)
+    m->PC = m->PC + 1;
+    op = di->op;
+ run:
+    switch (op) {
+#include "machine_ops.inc"
+    }
+#undef CASE
+#undef NEXT
+#undef NEXT_CHECKED
+#undef REDISPATCH
+#undef DISPATCH
+#undef LEAVE
+#undef UNDONE
+}
+
+// Execute at most budget instructions of the decoded program,
+// starting at PC, one at a time, returning the number of instructions
+// left in the budget. This returns early when the program turns
+// tracing on or when the PC leaves the text section.
+static unsigned long step_decoded(machine_t *m, unsigned long budget)
+{
+    while (budget > 0 && m->running && !m->tracing && !m->stopped
+	   && m->PC < m->instruction_words) {
+	machine_execute_decoded(m, m->PC);
+	budget--;
+    }
+    return budget;
+}
+
+#if defined(__GNUC__)
+// the handler for each decoded_op, in the order of the decoded_op enum,
+// for the threaded loops
+#define THREADED_HANDLERS {					\
+	&&L_DOP_UNDECODED,					\
+	&&L_DOP_NOP, &&L_DOP_ADD, &&L_DOP_SUB, &&L_DOP_CPW, &&L_DOP_CPR, \
+	&&L_DOP_AND, &&L_DOP_BOR, &&L_DOP_NOR, &&L_DOP_XOR,	\
+	&&L_DOP_LWR, &&L_DOP_SWR, &&L_DOP_SCA, &&L_DOP_LWI, &&L_DOP_NEG, \
+	&&L_DOP_LIT, &&L_DOP_ARI, &&L_DOP_SRI, &&L_DOP_MUL, &&L_DOP_DIV, \
+	&&L_DOP_CFHI, &&L_DOP_CFLO, &&L_DOP_SLL, &&L_DOP_SRL,	\
+	&&L_DOP_JMP, &&L_DOP_CSI, &&L_DOP_JREL,			\
+	&&L_DOP_ADDI, &&L_DOP_ANDI, &&L_DOP_BORI, &&L_DOP_NORI, &&L_DOP_XORI, \
+	&&L_DOP_BEQ, &&L_DOP_BGEZ, &&L_DOP_BGTZ, &&L_DOP_BLEZ, &&L_DOP_BLTZ, \
+	&&L_DOP_BNE,						\
+	&&L_DOP_JMPA, &&L_DOP_CALL, &&L_DOP_RTN,		\
+	&&L_DOP_EXIT, &&L_DOP_PSTR, &&L_DOP_PINT, &&L_DOP_PCH, &&L_DOP_RCH, \
+	&&L_DOP_STRA, &&L_DOP_NOTR,				\
+	&&L_DOP_CHECK,						\
+	&&L_DOP_BREAK, &&L_DOP_WATCH,				\
+	&&L_DOP_INVALID,					\
+	&&L_DOP_F_SAVE_AR, &&L_DOP_F_RESTORE_AR,		\
+	&&L_DOP_F_CPR_LWR, &&L_DOP_F_LWR_LWR,			\
+	&&L_DOP_F_SRI_CPW, &&L_DOP_F_SRI_LIT,			\
+	&&L_DOP_F_ADD_ARI, &&L_DOP_F_SUB_ARI, &&L_DOP_F_CPW_ARI	\
+    }
+
+// Run the decoded program, starting at PC, using direct threaded dispatch:
+// each handler ends by jumping straight to the handler of the next
+// instruction, through a table of label addresses (a GNU C extension).
+// There is no tracing, and only the instructions marked by the verifier
+// are checked. The PC is only checked after an indirect jump
+// (a direct jump's target is in the text, as it has been verified,
+// and running off the end of the text reaches the DOP_INVALID entry).
+// This returns when the program turns tracing on
+// or when the PC leaves the text section.
+static void run_threaded(machine_t *m)
+{
+    static const void *const handlers[DOP_NUM_OPS] = THREADED_HANDLERS;
+    const decoded_instr_t *di;
+#define CASE(op) L_##op
+#define REDISPATCH \
+    do {							\
+	di = &m->decoded[m->PC];					\
+	m->PC = m->PC + 1;						\
+	goto *handlers[di->op];					\
+    } while (0)
+#define NEXT \
+    do {							\
+	flight_record(m, m->PC);					\
+	REDISPATCH;						\
+    } while (0)
+#define NEXT_CHECKED \
+    do {							\
+	if (m->PC >= m->instruction_words) {				\
+	    return;						\
+	}							\
+	NEXT;							\
+    } while (0)
+#define DISPATCH(op) goto *handlers[op]
+#define LEAVE return
+#define UNDONE(k)
+    NEXT_CHECKED;
+#include "machine_ops.inc"
+#undef CASE
+#undef NEXT
+#undef NEXT_CHECKED
+#undef REDISPATCH
+#undef DISPATCH
+#undef LEAVE
+#undef UNDONE
+}
+
+// Run the decoded program, starting at PC, as run_threaded does,
+// but counting the executions of each instruction (and its jumps)
+// as each one is dispatched. (Superinstructions are not formed
+// when profiling, so each instruction is dispatched.)
+// This returns when the program turns tracing on
+// or when the PC leaves the text section.
+static void run_profiled(machine_t *m)
+{
+    static const void *const handlers[DOP_NUM_OPS] = THREADED_HANDLERS;
+    unsigned long *executions = profile_execution_counts(m->profile);
+    unsigned long *jumps = profile_jump_counts(m->profile);
+    // the address of the instruction dispatched last
+    address_type last = m->PC - 1;
+    const decoded_instr_t *di;
+#define CASE(op) L_##op
+#define REDISPATCH \
+    do {							\
+	di = &m->decoded[m->PC];					\
+	m->PC = m->PC + 1;						\
+	goto *handlers[di->op];					\
+    } while (0)
+#define NEXT \
+    do {							\
+	if (m->PC != last + 1) {					\
+	    jumps[last]++;					\
+	}							\
+	last = m->PC;						\
+	executions[m->PC]++;					\
+	flight_record(m, m->PC);					\
+	REDISPATCH;						\
+    } while (0)
+#define NEXT_CHECKED \
+    do {							\
+	if (m->PC >= m->instruction_words) {				\
+	    jumps[last]++;					\
+	    return;						\
+	}							\
+	NEXT;							\
+    } while (0)
+#define DISPATCH(op) goto *handlers[op]
+#define LEAVE return
+#define UNDONE(k)
+    NEXT_CHECKED;
+#include "machine_ops.inc"
+#undef CASE
+#undef NEXT
+#undef NEXT_CHECKED
+#undef REDISPATCH
+#undef DISPATCH
+#undef LEAVE
+#undef UNDONE
+}
+
+// Run the decoded program, starting at PC, as run_threaded does,
+// but for at most budget instructions, returning the number
+// of instructions left in the budget. A superinstruction counts as
+// all of the instructions it executes; if there are not enough left
+// in the budget for it, the rest are executed one at a time.
+// This returns early when the program turns tracing on
+// or when the PC leaves the text section.
+static unsigned long run_budgeted(machine_t *m, unsigned long budget)
+{
+    static const void *const handlers[DOP_NUM_OPS] = THREADED_HANDLERS;
+    const decoded_instr_t *di;
+    decoded_op op;
+    unsigned int length;
+#define CASE(op) L_##op
+#define REDISPATCH \
+    do {							\
+	di = &m->decoded[m->PC];				\
+	m->PC = m->PC + 1;					\
+	goto *handlers[di->op];					\
+    } while (0)
+#define NEXT \
+    do {							\
+	op = DECODE_OP(&m->decoded[m->PC]);			\
+	length = DECODE_IS_FUSED(op) ? fusion_length(op) : 1;	\
+	if (length > budget) {					\
+	    return step_decoded(m, budget);			\
+	}							\
+	budget -= length;					\
+	flight_record(m, m->PC);				\
+	REDISPATCH;						\
+    } while (0)
+#define NEXT_CHECKED \
+    do {							\
+	if (m->PC >= m->instruction_words) {			\
+	    return budget;					\
+	}							\
+	NEXT;							\
+    } while (0)
+#define DISPATCH(op) goto *handlers[op]
+#define LEAVE return budget
+#define UNDONE(k) (budget += length - (k))
+    NEXT_CHECKED;
+#include "machine_ops.inc"
+#undef CASE
+#undef NEXT
+#undef NEXT_CHECKED
+#undef REDISPATCH
+#undef DISPATCH
+#undef LEAVE
+#undef UNDONE
+}
+#else
+// Run the decoded program, starting at PC, without tracing
+// or checking the invariant (this compiler has no computed gotos,
+// so this uses the switch in machine_execute_decoded).
+// This returns when the program turns tracing on
+// or when the PC leaves the text section.
+static void run_threaded(machine_t *m)
+{
+    while (m->running && !m->tracing && !m->stopped
+	   && m->PC < m->instruction_words) {
+	machine_execute_decoded(m, m->PC);
+    }
+}
+
+// Run the decoded program, starting at PC, one instruction at a time,
+// counting the executions of each instruction (and its jumps).
+// This returns when the program turns tracing on
+// or when the PC leaves the text section.
+static void run_profiled(machine_t *m)
+{
+    while (m->running && !m->tracing && !m->stopped
+	   && m->PC < m->instruction_words) {
+	address_type addr = m->PC;
+	profile_execution(m->profile, addr);
+	machine_execute_decoded(m, addr);
+	if (m->PC != addr + 1) {
+	    profile_jump(m->profile, addr);
+	}
+    }
+}
+
+// Execute at most budget instructions of the decoded program,
+// starting at PC, one at a time, returning the number of instructions
+// left in the budget. This returns early when the program turns
+// tracing on or when the PC leaves the text section.
+static unsigned long run_budgeted(machine_t *m, unsigned long budget)
+{
+    return step_decoded(m, budget);
+}
+#endif
+
+// Run the program, starting at PC, using the native code of its hot
+// basic blocks and interpreting the rest (one instruction at a time,
+// up to the start of the next block), which also counts how often
+// each block is entered, for at most budget instructions,
+// returning the number of instructions left in the budget.
+// A block whose native code would exceed the budget is interpreted
+// (and native code only goes on to a block chained to it
+// if the budget has room for that block).
+// There is no tracing and no checking of the invariant.
+// This returns early when the program turns tracing on
+// or when the PC leaves the text section.
+static unsigned long run_jit(machine_t *m, unsigned long budget)
+{
+    while (budget > 0 && m->running && !m->tracing
+	   && m->PC < m->instruction_words) {
+	address_type start = m->PC;
+	jit_code_t code = jit_enter(m->jit, start);
+	if (code != NULL && jit_block_length(m->jit, start) <= budget) {
+	    // (the flight recorder only sees the start of the first block,
+	    // as the native code goes on through the blocks chained to it,
+	    // counting their instructions in the budget)
+	    flight_record(m, start);
+	    m->PC = code(m->memory->words, m->GPR, &m->hilo_regs.result,
+			 &budget);
+	    if ((m->PC & JIT_INTERPRET) == 0) {
+		continue;
+	    }
+	    // a block stopped at an instruction it cannot execute
+	    // (after executing the ones before it)
+	    m->PC = m->PC & ~JIT_INTERPRET;
+	}
+	do {
+	    machine_execute_decoded(m, m->PC);
+	    budget--;
+	} while (budget > 0 && m->running && !m->tracing
+		 && m->PC < m->instruction_words
+		 && !jit_is_block_start(m->jit, m->PC));
+    }
+    return budget;
+}
+
+#if defined(__GNUC__)
+// Run the decoded program, starting at PC, keeping the word at the top
+// of the stack in a host register while it is being computed on
+// (see machine_tos.inc). Handlers are threaded as in run_threaded,
+// with the PC in a local.
+// System calls that read input or change the engine's state, and the
+// other rare instructions, are executed by machine_execute_decoded
+// after writing the cache back to memory.
+// There is no tracing, only the instructions marked by the verifier
+// are checked, and watchpoints cannot be set with this engine.
+// This returns when the program turns tracing on
+// or when the PC leaves the text section.
+static void run_stack_cached(machine_t *m)
+{
+#define TOS_COUNT(leave)
+#define TOS_RETURN return
+#include "machine_tos.inc"
+#undef TOS_COUNT
+#undef TOS_RETURN
+}
+
+// Run the decoded program, starting at PC, as run_stack_cached does,
+// but for at most budget instructions, returning the number
+// of instructions left in the budget.
+// This returns early when the program turns tracing on
+// or when the PC leaves the text section.
+static unsigned long run_stack_cached_budgeted(machine_t *m,
+					       unsigned long budget)
+{
+#define TOS_COUNT(leave) \
+    do {							\
+	if (budget == 0) {					\
+	    goto leave;						\
+	}							\
+	budget--;						\
+    } while (0)
+#define TOS_RETURN return budget
+#include "machine_tos.inc"
+#undef TOS_COUNT
+#undef TOS_RETURN
+}
+#else
+// Run the decoded program, starting at PC, as run_threaded does
+// (this compiler has no computed gotos, which the stack cache's
+// handlers need).
+// This returns when the program turns tracing on
+// or when the PC leaves the text section.
+static void run_stack_cached(machine_t *m)
+{
+    run_threaded(m);
+}
+
+// Execute at most budget instructions of the decoded program,
+// starting at PC, as run_budgeted does, returning the number
+// of instructions left in the budget.
+static unsigned long run_stack_cached_budgeted(machine_t *m,
+					       unsigned long budget)
+{
+    return run_budgeted(m, budget);
+}
+#endif
 
 // Requires: out != NULL and is writable
-// Print the current values in the registers to out
-static void print_registers(FILE *out)
+// Print the values pc, hilo, and GPR of the registers to out
+static void print_register_values(FILE *out, address_type pc,
+				  union longAs2words_u hilo,
+				  const word_type GPR[NUM_REGISTERS])
 {
     // print the registers
-    fprintf(out, "%8s: %u", "PC", PC);
-    if (hilo_regs.result != 0L) {
+    fprintf(out, "%8s: %u", "PC", pc);
+    if (hilo.result != 0L) {
 	fprintf(out, "\t%8s: %d\t%8s: %d",
-		"HI", hilo_regs.hilo[HI],
-		"LO", hilo_regs.hilo[LO]);
+		"HI", hilo.hilo[HI],
+		"LO", hilo.hilo[LO]);
     }
     newline(out);
 
@@ -617,12 +3151,20 @@ static void print_registers(FILE *out)
     }
 }
 
+// Requires: out != NULL and is writable
+// Print the current values in the registers to out
+static void print_registers(machine_t *m, FILE *out)
+{
+    print_register_values(out, m->PC, m->hilo_regs, m->GPR);
+}
+
 // Print non-zero global data between the (word) addresses
 // GPR[SP] and initial_stack_bottom inclusive
-static void print_runtime_stack(FILE *out)
+static void print_runtime_stack(machine_t *m, FILE *out)
 {
     // print the memory between sp and fp, inclusive
-    bool printed_nl = print_memory_words_d(out, GPR[SP], initial_stack_bottom);
+    bool printed_nl = print_memory_words_d(m, out, m->GPR[SP],
+					   m->initial_stack_bottom);
     if (!printed_nl) {
 	newline(out);
     }
@@ -631,19 +3173,64 @@ static void print_runtime_stack(FILE *out)
 // Requires: out != NULL and out can be written on
 // print the state of the machine (registers, globals, and
 // the memory between GPR[$sp] and GPR[$fp], inclusive) to out
-void machine_print_state(FILE *out)
+void machine_print_state(machine_t *m, FILE *out)
 {
-    print_registers(out);
-    print_global_data(out);
-    print_runtime_stack(out);
+    vmio_flush(m->buffers); // so the state follows the program's output
+    print_registers(m, out);
+    print_global_data(m, out);
+    print_runtime_stack(m, out);
+}
+
+// Print the last instructions that m dispatched (at most FLIGHT_RECORDS
+// of them, oldest first) to out in assembly form, with the registers
+// before some of them, then the registers now (if m has run any).
+// A superinstruction is dispatched once, so the instructions
+// after the first one in it are marked with a "+".
+void machine_print_flight_record(machine_t *m, FILE *out)
+{
+    if (m->flight_count == 0) {
+	return;
+    }
+    unsigned long first = m->flight_count > FLIGHT_RECORDS
+	? m->flight_count - FLIGHT_RECORDS : 0;
+    fprintf(out, "The last %lu instructions executed, oldest first:\n",
+	    m->flight_count - first);
+    for (unsigned long n = first; n < m->flight_count; n++) {
+	unsigned long i = n % FLIGHT_RECORDS;
+	const flight_entry_t *e = &m->flight[i];
+	if (i % FLIGHT_SNAPSHOT_INTERVAL == 0) {
+	    const flight_registers_t *r
+		= &m->flight_registers[i / FLIGHT_SNAPSHOT_INTERVAL];
+	    union longAs2words_u hilo;
+	    hilo.result = r->hilo;
+	    print_register_values(out, e->pc, hilo, r->GPR);
+	}
+	bin_instr_t bi;
+	memcpy(&bi, &e->instr, sizeof(bi));
+	fprintf(out, "    ");
+	print_instruction(out, e->pc, bi);
+	// the rest of a superinstruction (unless it was run one at a time)
+	decoded_op op = e->pc < m->instruction_words
+	    ? DECODE_OP(&m->decoded[e->pc]) : DOP_INVALID;
+	bool stepped = n + 1 < m->flight_count
+	    && m->flight[(n + 1) % FLIGHT_RECORDS].pc == e->pc + 1;
+	if (DECODE_IS_FUSED(op) && !stepped) {
+	    for (unsigned int k = 1; k < fusion_length(op); k++) {
+		fprintf(out, "  + ");
+		print_instruction(out, e->pc + k, m->memory->instrs[e->pc + k]);
+	    }
+	}
+    }
+    fprintf(out, "The registers now:\n");
+    print_registers(m, out);
 }
 
 // Invariant test for the VM (for debugging purposes)
 // This exits with an assertion error if the invariant does not pass
-void machine_okay()
+void machine_okay(machine_t *m)
 {
-    assert(0 <= GPR[GP]);
-    assert(GPR[GP] < GPR[SP]);
-    assert(GPR[SP] <= GPR[FP]);
-    assert(GPR[FP] < MEMORY_SIZE_IN_WORDS);
+    assert(0 <= m->GPR[GP]);
+    assert(m->GPR[GP] < m->GPR[SP]);
+    assert(m->GPR[SP] <= m->GPR[FP]);
+    assert((address_type) m->GPR[FP] < m->memory_words);
 }
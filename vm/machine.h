@@ -2,49 +2,385 @@
 #ifndef _MACHINE_H
 #define _MACHINE_H
 #include <assert.h>
+#include <stdio.h>
+#include <stdbool.h>
 #include "machine_types.h"
 #include "bof.h"
 #include "instruction.h"
+#include "btrace.h"
 
-// a size for the memory (2^16 = 32K words)
+// the default size for the memory (2^15 = 32K words); a program whose
+// stack bottom is higher is given just enough memory for its stack
 #define MEMORY_SIZE_IN_WORDS 32768
 
+// the largest size for the memory (2^28 words, or 1 GB)
+#define MACHINE_MAX_MEMORY_WORDS (1u << 28)
+
+// the memory size (see machine_set_memory_size) that gives each program
+// just enough memory for its stack (one word more than its stack bottom)
+#define MACHINE_MEMORY_FIT ((address_type) -1)
+
+// the size of the buffer holding the message for the last error
+#define MACHINE_ERROR_SIZE 256
+
+// the most breakpoints, and watchpoints, that a machine can have
+#define MACHINE_MAX_BREAKPOINTS 64
+#define MACHINE_MAX_WATCHPOINTS 16
+
+// The engines that can run programs when they are not being traced.
+// The traced engine steps through the program one instruction at a time,
+// checking the invariant and testing for tracing before and after
+// each instruction; the threaded engine (the default) does neither,
+// and switches to the traced engine's loop only while tracing is on.
+// The stack-cached engine is like the threaded engine, but keeps
+// the word at the top of the stack in a host register while it is
+// being computed on (top-of-stack caching).
+// The JIT engine is like the threaded engine, but translates
+// the hot basic blocks of the text section into native code (see jit.h).
+typedef enum {traced_engine, threaded_engine, stack_cached_engine,
+	      jit_engine} engine_type;
+
+// A machine: the VM's registers, memory, and loaded program,
+// and the settings used to run it. Each machine is independent of the
+// others, so different threads can run different machines at once.
+typedef struct machine_s machine_t;
+
+// Callbacks for the program's input and output system calls,
+// which are passed data. A NULL callback uses the machine's streams.
+// Each returns what the system call leaves on the stack:
+// print_str and print_int return the number of characters printed,
+// print_char returns the character printed,
+// and read_char returns the character read (or EOF), or, if there is
+// no input yet, MACHINE_WOULD_BLOCK (see machine_run_steps).
+typedef struct {
+    int (*print_str)(void *data, const char *s);
+    int (*print_int)(void *data, int i);
+    int (*print_char)(void *data, int c);
+    int (*read_char)(void *data);
+    void *data;
+} machine_io_t;
+
+// A snapshot of a machine's registers and memory (with its program),
+// which can be restored to run the program again from that point.
+// Its image is kept in a file, which is mapped into the memory
+// of machines it is restored into (see machine_restore).
+typedef struct machine_snapshot_s machine_snapshot_t;
+
+// What a run of a machine (see machine_run_steps) ended with
+typedef enum {machine_stepping, machine_exited, machine_failed,
+	      machine_blocked, machine_stopped} machine_status;
+
+// What a read_char callback returns when no input is available yet
+#define MACHINE_WOULD_BLOCK (-2)
+
+// Return a new machine, with nothing loaded, that uses the threaded engine
+// (with superinstructions), does not profile, and uses stdin, stdout,
+// and stderr. Exit with an error message if there is no space for it.
+extern machine_t *machine_create();
+
+// Free the machine m (and its decoded program, JIT, and profile)
+extern void machine_destroy(machine_t *m);
+
+// Make the machine m read the program's input from in,
+// write the program's output (and tracing output) to out,
+// and write error messages to err (or not print them, if err is NULL).
+// The streams must stay open until they are replaced (or m is freed).
+// (in and out may be NULL if callbacks handle the program's input
+// and output, see machine_set_io, and it is not traced.)
+extern void machine_set_streams(machine_t *m, FILE *in, FILE *out,
+				FILE *err);
+
+// Make the machine m use the callbacks in io (those that are not NULL)
+// for the program's input and output system calls, instead of its streams.
+// If io is NULL, m goes back to using its streams for all of them.
+extern void machine_set_io(machine_t *m, const machine_io_t *io);
+
+// Requires: words <= MACHINE_MAX_MEMORY_WORDS or words == MACHINE_MEMORY_FIT
+// Make m run the programs it loads with a memory of words words,
+// or, if words is 0, with a memory of MEMORY_SIZE_IN_WORDS words
+// (or just enough for the program's stack, if that is larger),
+// or, if words is MACHINE_MEMORY_FIT, with just enough for its stack
+extern void machine_set_memory_size(machine_t *m, address_type words);
+
+// Make m use the given engine to run programs
+// (the JIT engine is replaced by the threaded engine
+// on hosts where the JIT cannot generate native code)
+extern void machine_set_engine(machine_t *m, engine_type e);
+
+// Form superinstructions when loading programs just when fuse is true
+// (only done for the threaded engine)
+extern void machine_set_fusion(machine_t *m, bool fuse);
+
+// Print the number of places each superinstruction was used
+// in the loaded program and the number of times each was executed to out
+extern void machine_print_fusion_stats(machine_t *m, FILE *out);
+
+// Print the JIT's statistics to out (if the JIT engine is being used)
+extern void machine_print_jit_stats(machine_t *m, FILE *out);
+
+// Count the executions of each instruction in the text section
+// (and how often each jumps) just when on is true.
+// This is done one instruction at a time, whatever the engine.
+extern void machine_set_profiling(machine_t *m, bool on);
+
+// Requires: profiling is on and a program has been loaded
+// Print a table of the profile of the program so far to out,
+// followed, if the program has symbols (see bof.h), by the totals
+// of its most executed procedures and labels, and if it has
+// a line table, by the totals of its most executed source lines
+extern void machine_print_profile(machine_t *m, FILE *out);
+
+// Requires: profiling is on and a program has been loaded
+// Write the profile of the program so far to out,
+// in the machine-readable form described in profile.h
+extern void machine_write_profile(machine_t *m, FILE *out);
+
+// Sample the PC and call stack of the program running on m
+// rate times a second of CPU time, when rate is not 0,
+// by a timer that interrupts the run loops (see sampler.h)
+extern void machine_set_sampling(machine_t *m, unsigned int rate);
+
+// Requires: sampling is on and a program has been loaded
+// Print a table of the samples of the program so far to out,
+// followed, if the program has a line table (see bof.h),
+// by the totals of its most sampled source lines
+extern void machine_print_samples(machine_t *m, FILE *out);
+
+// Requires: sampling is on and a program has been loaded
+// Write the stacks sampled so far to out, in the folded format
+// of flame graph tools (see sampler.h), naming the procedures
+// by their symbols, if the program has them
+extern void machine_write_samples(machine_t *m, FILE *out);
+
 // Requires: bf is open for reading in binary
-// Load the binary object file bf, and get ready to run it
-extern void machine_load(BOFFILE bf);
+// Load the binary object file bf into m, and get ready to run it.
+// Return true if that worked, and otherwise (after printing
+// an error message on m's error stream) false.
+// (bf may be in either version of the format, see bof.h.)
+// Each section is read all at once, which for a bf opened by
+// bof_map_open is a single copy out of the mapped file.
+// The program's line table (its bof_lines_section), if it has one,
+// is kept for tracing and profiling in terms of its source lines.
+extern bool machine_load(machine_t *m, BOFFILE bf);
+
+// Load the program in the size bytes at bytes, which are laid out
+// as in a binary object file (in either version of the format),
+// into m, and get ready to run it.
+// Return true if that worked, and otherwise (after printing
+// an error message on m's error stream, if it has one) false.
+extern bool machine_load_bytes(machine_t *m, const void *bytes, size_t size);
+
+// Requires: a program has been loaded into m
+// Take a snapshot of the registers and memory of m, and write its image
+// to the file named filename, or (if filename is NULL) to a temporary file
+// that is removed when the snapshot is destroyed.
+// Exit with an error message if the image cannot be written.
+extern machine_snapshot_t *machine_snapshot(machine_t *m,
+					    const char *filename);
+
+// Open the snapshot whose image is in the file named filename
+// (written by machine_snapshot), which must not be changed while
+// the snapshot is in use. Exit with an error message if that file
+// cannot be read or does not hold a snapshot's image.
+extern machine_snapshot_t *machine_snapshot_open(const char *filename);
+
+// Free the snapshot s (closing its image file), which must not be
+// used by any machine after this
+extern void machine_snapshot_destroy(machine_snapshot_t *s);
+
+// Restore m to the state in the snapshot s (which may have been taken of
+// another machine, if it uses the same engine, superinstructions,
+// and profiling), so its program runs again from that point.
+// When s is the snapshot last taken of or restored into m,
+// and m has not written its text section since then, this only copies
+// back the pages of memory m has written (or maps the memory again,
+// for the JIT engine) and sets the registers; otherwise it maps
+// the memory and decodes (and verifies) the program again.
+// (The line table of the program last loaded into m is kept.)
+// Return true if that worked, and otherwise (after printing
+// an error message on m's error stream, if it has one) false.
+extern bool machine_restore(machine_t *m, const machine_snapshot_t *s);
 
 // Requires: a program has been loaded into the computer's memory
 // print a heading and the program in the VM's memory to out
-extern void machine_print_loaded_program(FILE *out);
+// (with a line naming each address that has a symbol before it)
+extern void machine_print_loaded_program(machine_t *m, FILE *out);
+
+// Record a binary trace of each run of m in bt (see btrace.h),
+// instead of printing the text trace, or stop recording if bt is NULL.
+// (The instructions are executed one at a time, whatever the engine.)
+extern void machine_set_binary_trace(machine_t *m, btrace_t *bt);
 
-// Run the VM on the already loaded program,
+// Make the text trace of m print only the registers (and HI and LO)
+// and memory words that each instruction changes, if on is true,
+// with the whole state every keyframe_interval instructions traced
+// (or only when tracing starts, if keyframe_interval is 0);
+// otherwise print the whole state after each instruction
+extern void machine_set_delta_trace(machine_t *m, bool on,
+				    unsigned long keyframe_interval);
+
+// Run m on the already loaded program until it executes EXIT
+// or an error occurs (which is reported on m's error stream),
 // producing any trace output called for by the program
-// if trace_execution is true
-extern void machine_run(bool trace_execution);
+// if trace_execution is true. (If the program has a line table,
+// each instruction traced from a different source line than the one
+// before it is preceded by a comment giving that line.)
+// Return the program's exit code, or EXIT_FAILURE after an error
+// (or if a read_char callback said its input would block).
+extern int machine_run(machine_t *m, bool trace_execution);
+
+// Run m on the already loaded (or partly run) program for at most
+// steps instructions, or until it executes EXIT if steps is 0,
+// producing any trace output called for by the program.
+// (A limited run uses m's engine, but executes exactly steps instructions
+// unless the program stops first, so that it can be compared
+// with a run of the traced engine, see shadow.h.)
+// Return whether m is still running, has exited (see machine_exit_code),
+// has stopped with an error (see machine_error_message), is blocked,
+// as its read_char callback returned MACHINE_WOULD_BLOCK (then the PC
+// is left at that RCH instruction, so the next run reads again),
+// or has stopped at a breakpoint (with the PC at its instruction)
+// or after a store into a watched word (with the PC at the next
+// instruction, see machine_watch_hit). The next run does not stop
+// at the breakpoint at the PC it stopped at (if any) before moving on.
+extern machine_status machine_run_steps(machine_t *m, unsigned long steps);
+
+// Requires: a program has been loaded into m
+// Make the runs of m stop (see machine_run_steps) before executing
+// the instruction at addr, by replacing its decoded entry
+// with a DOP_BREAK entry (so the run loops check nothing).
+// Return false (setting none) if addr is not in the text section,
+// m has MACHINE_MAX_BREAKPOINTS already, or uses the JIT engine.
+// (Loading a program removes the breakpoints and watchpoints.)
+extern bool machine_set_breakpoint(machine_t *m, address_type addr);
+
+// Remove the breakpoint at addr from m,
+// returning false if there is none
+extern bool machine_clear_breakpoint(machine_t *m, address_type addr);
+
+// Requires: a program has been loaded into m
+// Make the runs of m stop (see machine_run_steps) after an instruction
+// stores into any of the count words starting at word address wa.
+// The pages holding them are only readable while m runs, so only
+// the stores into those pages cost anything (a fault each).
+// Superinstructions are not used while m has watchpoints.
+// Return false (setting none) if count is 0 or the words are not
+// all in memory, m has MACHINE_MAX_WATCHPOINTS already, m uses
+// the stack-cached or JIT engine (whose stores are not made one by one),
+// or this host cannot protect pages.
+extern bool machine_set_watchpoint(machine_t *m, address_type wa,
+				   unsigned int count);
+
+// Remove the watchpoint starting at word address wa from m,
+// returning false if there is none
+extern bool machine_clear_watchpoint(machine_t *m, address_type wa);
+
+// If the last run of m stopped after a store into a watched word,
+// put its word address in *wa and the value it held before in *old,
+// and return true; otherwise return false
+extern bool machine_watch_hit(machine_t *m, address_type *wa,
+			      word_type *old);
+
+// Return the exit code given by the program's EXIT instruction
+// (or EXIT_SUCCESS if it has not exited)
+extern int machine_exit_code(machine_t *m);
+
+// Return the message describing the error that stopped m's last load
+// or run, or NULL if there was none
+extern const char *machine_error_message(machine_t *m);
 
-// Load the given binary object file and run it
-extern void machine_load_and_run(BOFFILE bf, bool trace_execution);
+// Return the size of m's memory (in words)
+extern address_type machine_memory_size(machine_t *m);
+
+// Return the value of the program counter of m
+extern address_type machine_pc(machine_t *m);
+
+// Requires: r < NUM_REGISTERS
+// Return the value of the general purpose register r of m
+extern word_type machine_register(machine_t *m, unsigned int r);
+
+// Return the symbols of the program loaded into m (from its symbols
+// section, see bof.h), which are valid until another program is loaded,
+// or NULL if it has none
+extern const bof_symbols_t *machine_symbols(machine_t *m);
+
+// Put the values of m's HI and LO registers in *hi and *lo
+extern void machine_hi_lo(machine_t *m, word_type *hi, word_type *lo);
+
+// Copy the count words of m's memory starting at word address wa
+// into words, returning false (and copying nothing)
+// if any of them are outside of memory
+extern bool machine_read_memory(machine_t *m, address_type wa,
+				word_type *words, unsigned int count);
+
+// Requires: pc is in m's memory
+// Make pc the value of m's program counter
+extern void machine_set_pc(machine_t *m, address_type pc);
+
+// Requires: r < NUM_REGISTERS
+// Make w the value of the general purpose register r of m
+extern void machine_set_register(machine_t *m, unsigned int r, word_type w);
+
+// Make hi and lo the values of m's HI and LO registers
+extern void machine_set_hi_lo(machine_t *m, word_type hi, word_type lo);
+
+// Copy the count words at words into m's memory starting at
+// word address wa, returning false (and copying nothing)
+// if any of them are outside of memory
+extern bool machine_write_memory(machine_t *m, address_type wa,
+				 const word_type *words, unsigned int count);
+
+// Load the given binary object file into m and run it,
+// returning the program's exit code (or EXIT_FAILURE after an error)
+extern int machine_load_and_run(machine_t *m, BOFFILE bf,
+				bool trace_execution);
 
 // If tracing then print bi, execute bi (always),
 // then if tracing print out the machine's state.
 // All tracing output goes to the FILE out
-extern void machine_trace_execute_instr(FILE *out, address_type addr,
-					bin_instr_t bi);
+extern void machine_trace_execute_instr(machine_t *m, FILE *out,
+					address_type addr, bin_instr_t bi);
 
 // Execute the given instruction, which is found at address addr,
 // in the machine's current state
-extern void machine_execute_instr(address_type addr, bin_instr_t bi);
+extern void machine_execute_instr(machine_t *m, address_type addr,
+				  bin_instr_t bi);
+
+// Requires: addr == PC and addr < the length of the text section
+// Execute the decoded form of the instruction at word address addr
+// (as decoded by machine_load) in the machine's current state
+extern void machine_execute_decoded(machine_t *m, address_type addr);
 
 // Print instr, execute instr, then print out the machine's state (to out)
-extern void machine_trace_execute(FILE *out, bin_instr_t instr);
+extern void machine_trace_execute(machine_t *m, FILE *out, bin_instr_t instr);
 
 // Requires: out != NULL and out can be written on
 // print the state of the machine (registers, globals, and
 // the memory between GPR[$sp] and GPR[$fp], inclusive) to out
-extern void machine_print_state(FILE *out);
+extern void machine_print_state(machine_t *m, FILE *out);
+
+// If the loaded program has a line table, and the instruction at addr
+// came from another source line than the last one traced,
+// print the line it came from on out (as a "# line" comment),
+// as tracing does before the instruction's trace
+extern void machine_print_source_line(machine_t *m, FILE *out,
+				      address_type addr);
+
+// Print the last instructions that m dispatched (oldest first), kept by
+// its flight recorder, to out in assembly form, with the registers
+// before some of them, then the registers now.
+// This is also printed on m's error stream when a run stops
+// with an error, or a fatal signal arrives while it runs.
+// The recorder is always on: it costs two stores per instruction
+// dispatched (and a copy of the registers every 16), which is lost in
+// the noise for the threaded and stack-cached engines (a superinstruction
+// is recorded once), and little for the JIT engine (which only
+// records the block where each run of native code starts).
+// Building with -DMACHINE_NO_FLIGHT_RECORDER turns it off.
+extern void machine_print_flight_record(machine_t *m, FILE *out);
 
 // Invariant test for the VM (for debugging purposes)
 // This exits with an assertion error if the invariant does not pass
-extern void machine_okay();
+extern void machine_okay(machine_t *m);
 
 #endif
@@ -4,14 +4,113 @@
 #include <string.h>
 #include "bof.h"
 #include "machine.h"
+#include "debugger.h"
+#include "sampler.h"
 #include "utilities.h"
 
 /* Print a usage message on stderr and exit with exit code 1. */
 static void usage(const char *cmdname)
 {
     bail_with_error(
-		    "Usage: %s [-p] file.bof\n        %s [-t] file.bof",
-		    cmdname, cmdname);
+		    "Usage: %s [-p] file.bof\n        %s [-e engine] [-n] [-f] [-P profile] [-S stacks [-I rate]] [-t] [-d] [-k n] [-m words] [-s image] file.bof\n        %s [-e engine] [-n] [-f] [-P profile] [-S stacks [-I rate]] [-t] [-d] [-k n] -r image\n        %s [-m words] -b trace file.bof\n        %s [-e engine] [-m words] -D control file.bof\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s",
+		    cmdname, cmdname, cmdname, cmdname, cmdname,
+		    "where engine is threaded (the default), tos, jit, or traced,",
+		    "-n turns off superinstructions (in the threaded engine),",
+		    "-f prints superinstruction and JIT statistics on stderr at exit,",
+		    "-P counts executions of each instruction, printing a table",
+		    "on stderr at exit and writing the counts to the file profile,",
+		    "-S samples the PC rate times a second (default 1000),",
+		    "printing a table on stderr at exit and writing the stacks",
+		    "sampled to the file stacks (for flame graph tools),",
+		    "-d traces, printing only what each instruction changes,",
+		    "with the whole state every n instructions traced for -k n,",
+		    "-m sets the size of the memory (default: 32768 words,",
+		    "or just enough for the program's stack if that is larger),",
+		    "-s writes a snapshot of the loaded program to the file image,",
+		    "-r runs the program from a snapshot's image instead,",
+		    "-b writes a binary trace (see btrace_decode) to the file trace,",
+		    "and -D runs the program in the debugger, reading its commands",
+		    "from the file control (or from stdin, if control is -)");
+}
+
+// the machine that runs the program
+static machine_t *machine = NULL;
+
+// Print the superinstruction and JIT statistics on stderr
+// (registered with atexit, so they are also printed after an error)
+static void print_engine_stats()
+{
+    machine_print_fusion_stats(machine, stderr);
+    machine_print_jit_stats(machine, stderr);
+}
+
+// the name of the file to write the profile to (for -P)
+static const char *profile_name = NULL;
+
+// Print the profile table on stderr and write the profile
+// to the file named profile_name (registered with atexit,
+// once the program is loaded)
+static void print_profile()
+{
+    machine_print_profile(machine, stderr);
+    FILE *out = fopen(profile_name, "w");
+    if (out == NULL) {
+	bail_with_error("Cannot open profile file %s for writing!",
+			profile_name);
+    }
+    machine_write_profile(machine, out);
+    fclose(out);
+}
+
+// the name of the file to write the sampled stacks to (for -S)
+static const char *stacks_name = NULL;
+
+// Print the table of samples on stderr and write the stacks sampled
+// to the file named stacks_name (registered with atexit)
+static void print_samples()
+{
+    machine_print_samples(machine, stderr);
+    FILE *out = fopen(stacks_name, "w");
+    if (out == NULL) {
+	bail_with_error("Cannot open stacks file %s for writing!",
+			stacks_name);
+    }
+    machine_write_samples(machine, out);
+    fclose(out);
+}
+
+// Read a character of the program's input from stdin (for -D -),
+// through stdio, so it shares the debugger's buffer of stdin
+static int read_stdin(void *data)
+{
+    return getchar();
+}
+
+// Return the contents of the file named name (allocated with malloc),
+// putting its length in *size, or exit with an error message
+static void *read_file(const char *name, size_t *size)
+{
+    FILE *f = fopen(name, "rb");
+    if (f == NULL) {
+	bail_with_error("Cannot open %s!", name);
+    }
+    size_t allocated = BUFSIZ;
+    char *bytes = malloc(allocated);
+    *size = 0;
+    size_t n;
+    while (bytes != NULL
+	   && (n = fread(bytes + *size, 1, allocated - *size, f)) > 0) {
+	*size += n;
+	if (*size == allocated) {
+	    allocated *= 2;
+	    bytes = realloc(bytes, allocated);
+	}
+    }
+    if (bytes == NULL || ferror(f)) {
+	bail_with_error("Cannot read %s!", name);
+    }
+    fclose(f);
+    return bytes;
 }
 
 // Run the VM on the .bof file name given in argv[1]
@@ -21,42 +120,197 @@ int main(int argc, char *argv[])
     argc--;
     argv++;
 
+    machine = machine_create();
     bool print_program = false;
     bool trace_execution = false;
-    if (argc == 2 && strcmp(argv[0], "-p") == 0) {
-	print_program = true;
-	argc--;
-	argv++;
-    } else if (argc == 2 && strcmp(argv[0], "-t") == 0) {
-	trace_execution = true;
-	argc--;
-	argv++;
+    // print only the changes in the trace (for -d), with the whole state
+    // every keyframe_interval instructions (for -k)
+    bool delta_trace = false;
+    unsigned long keyframe_interval = 0;
+    // the samples taken per second (for -I)
+    unsigned int sample_rate = 0;
+    // the snapshot image to write (for -s) or to run from (for -r)
+    const char *snapshot_name = NULL;
+    // the binary trace to write (for -b)
+    const char *btrace_name = NULL;
+    // the file of debugger commands (for -D)
+    const char *control_name = NULL;
+    bool restoring = false;
+    while (argc > 1 && argv[0][0] == '-') {
+	if (strcmp(argv[0], "-p") == 0) {
+	    print_program = true;
+	    argc--;
+	    argv++;
+	} else if (strcmp(argv[0], "-b") == 0 && argc > 2) {
+	    btrace_name = argv[1];
+	    argc -= 2;
+	    argv += 2;
+	} else if (strcmp(argv[0], "-D") == 0 && argc > 2) {
+	    control_name = argv[1];
+	    argc -= 2;
+	    argv += 2;
+	} else if (strcmp(argv[0], "-t") == 0) {
+	    trace_execution = true;
+	    argc--;
+	    argv++;
+	} else if (strcmp(argv[0], "-d") == 0) {
+	    trace_execution = true;
+	    delta_trace = true;
+	    argc--;
+	    argv++;
+	} else if (strcmp(argv[0], "-k") == 0 && argc > 2) {
+	    long interval = atol(argv[1]);
+	    if (interval < 1) {
+		usage(cmdname);
+	    }
+	    keyframe_interval = (unsigned long) interval;
+	    argc -= 2;
+	    argv += 2;
+	} else if (strcmp(argv[0], "-s") == 0 && argc > 2 && !restoring) {
+	    snapshot_name = argv[1];
+	    argc -= 2;
+	    argv += 2;
+	} else if (strcmp(argv[0], "-r") == 0 && snapshot_name == NULL) {
+	    restoring = true;
+	    argc--;
+	    argv++;
+	} else if (strcmp(argv[0], "-n") == 0) {
+	    machine_set_fusion(machine, false);
+	    argc--;
+	    argv++;
+	} else if (strcmp(argv[0], "-f") == 0) {
+	    atexit(print_engine_stats);
+	    argc--;
+	    argv++;
+	} else if (strcmp(argv[0], "-m") == 0 && argc > 2 && !restoring) {
+	    long words = atol(argv[1]);
+	    if (words < 1 || words > MACHINE_MAX_MEMORY_WORDS) {
+		usage(cmdname);
+	    }
+	    machine_set_memory_size(machine, (address_type) words);
+	    argc -= 2;
+	    argv += 2;
+	} else if (strcmp(argv[0], "-P") == 0 && argc > 2) {
+	    profile_name = argv[1];
+	    machine_set_profiling(machine, true);
+	    argc -= 2;
+	    argv += 2;
+	} else if (strcmp(argv[0], "-S") == 0 && argc > 2) {
+	    stacks_name = argv[1];
+	    argc -= 2;
+	    argv += 2;
+	} else if (strcmp(argv[0], "-I") == 0 && argc > 2) {
+	    long rate = atol(argv[1]);
+	    if (rate < 1 || rate > SAMPLER_MAX_RATE) {
+		usage(cmdname);
+	    }
+	    sample_rate = (unsigned int) rate;
+	    argc -= 2;
+	    argv += 2;
+	} else if (strcmp(argv[0], "-e") == 0 && argc > 2) {
+	    if (strcmp(argv[1], "threaded") == 0) {
+		machine_set_engine(machine, threaded_engine);
+	    } else if (strcmp(argv[1], "tos") == 0) {
+		machine_set_engine(machine, stack_cached_engine);
+	    } else if (strcmp(argv[1], "jit") == 0) {
+		machine_set_engine(machine, jit_engine);
+	    } else if (strcmp(argv[1], "traced") == 0) {
+		machine_set_engine(machine, traced_engine);
+	    } else {
+		usage(cmdname);
+	    }
+	    argc -= 2;
+	    argv += 2;
+	} else {
+	    usage(cmdname);
+	}
     }
 
-    // now there should be exactly 1 file argument
-    if (argc != 1 || argv[0][0] == '-') {
+    // -p and -t cannot be used together, -b needs the .bof file,
+    // -k goes with -d, and -D runs the program only in the debugger
+    if ((print_program && trace_execution)
+	|| (btrace_name != NULL && (print_program || restoring))
+	|| (control_name != NULL
+	    && (print_program || trace_execution || restoring
+		|| btrace_name != NULL || snapshot_name != NULL))
+	|| (keyframe_interval != 0 && !delta_trace)
+	|| (sample_rate != 0 && stacks_name == NULL)) {
 	usage(cmdname);
     }
+    if (stacks_name != NULL) {
+	machine_set_sampling(machine, sample_rate != 0 ? sample_rate
+			     : SAMPLER_DEFAULT_RATE);
+    }
+    machine_set_delta_trace(machine, delta_trace, keyframe_interval);
 
-    char *suffix = strchr(argv[0], '.');
-    if (suffix == NULL || strncmp(suffix, ".bof", 4) != 0) {
+    // now there should be exactly 1 file argument
+    if (argc != 1 || argv[0][0] == '-') {
 	usage(cmdname);
     }
 
-    BOFFILE bf = bof_read_open(argv[0]);
+    if (restoring) {
+	machine_snapshot_t *s = machine_snapshot_open(argv[0]);
+	if (!machine_restore(machine, s)) {
+	    return EXIT_FAILURE;
+	}
+    } else {
+	char *suffix = strchr(argv[0], '.');
+	if (suffix == NULL || strncmp(suffix, ".bof", 4) != 0) {
+	    usage(cmdname);
+	}
+
+	BOFFILE bf = bof_map_open(argv[0]);
 
-    machine_load(bf);
+	if (!machine_load(machine, bf)) {
+	    return EXIT_FAILURE;
+	}
+	bof_close(bf);
+	if (snapshot_name != NULL) {
+	    machine_snapshot(machine, snapshot_name);
+	}
+    }
+
+    // (only now that there is a program, whose counts these are)
+    if (profile_name != NULL) {
+	atexit(print_profile);
+    }
+    if (stacks_name != NULL) {
+	atexit(print_samples);
+    }
 
     // if printing, don't run the program
     if (print_program) {
-	machine_print_loaded_program(stdout);
+	machine_print_loaded_program(machine, stdout);
 	return EXIT_SUCCESS;
     }
     
-    machine_run(trace_execution);
+    if (btrace_name != NULL) {
+	// the trace is of a run with tracing on (as for -t)
+	size_t size;
+	void *bof = read_file(argv[0], &size);
+	btrace_t *bt = btrace_create(btrace_name, bof, size,
+				     machine_memory_size(machine));
+	free(bof);
+	machine_set_binary_trace(machine, bt);
+	int exit_code = machine_run(machine, true);
+	btrace_close(bt);
+	return exit_code;
+    }
+
+    if (control_name != NULL) {
+	FILE *cmds = stdin;
+	if (strcmp(control_name, "-") == 0) {
+	    machine_io_t io = {NULL, NULL, NULL, read_stdin, NULL};
+	    machine_set_io(machine, &io);
+	} else {
+	    cmds = fopen(control_name, "r");
+	    if (cmds == NULL) {
+		bail_with_error("Cannot open control file %s!", control_name);
+	    }
+	}
+	return debugger_run(machine, cmds, stdout);
+    }
 
-    // the following should never execute,
-    // as the exit system call will call exit(0),
-    // and if the machine goes into an infinite loop it never gets here!
-    return EXIT_SUCCESS;
+    // the program's exit code (from its EXIT instruction)
+    return machine_run(machine, trace_execution);
 }
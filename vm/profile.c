@@ -0,0 +1,264 @@
+/* $Id$ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "profile.h"
+#include "utilities.h"
+
+struct profile_s {
+    // the length of the text section being profiled
+    unsigned int text_words;
+    // for each address in the text section, the number of times
+    // its instruction executed, and the number of times the PC
+    // did not then go on to the next address
+    unsigned long *executions;
+    unsigned long *jumps;
+};
+
+// an address and its number of executions, for sorting
+typedef struct {
+    address_type addr;
+    unsigned long executions;
+} hot_address_t;
+
+// Return a new profile, with (zeroed) counters for a text section
+// of text_length words, exiting with an error message
+// if that is not possible
+profile_t *profile_create(unsigned int text_length)
+{
+    profile_t *p = malloc(sizeof(profile_t));
+    if (p == NULL) {
+	bail_with_error("Cannot allocate a profile!");
+    }
+    p->text_words = text_length;
+    // allocate at least one counter, so calloc does not return NULL
+    p->executions = calloc(text_length + 1, sizeof(unsigned long));
+    p->jumps = calloc(text_length + 1, sizeof(unsigned long));
+    if (p->executions == NULL || p->jumps == NULL) {
+	bail_with_error("Cannot allocate profile counters for %u instructions!",
+			text_length);
+    }
+    return p;
+}
+
+// Free the profile p
+void profile_destroy(profile_t *p)
+{
+    if (p != NULL) {
+	free(p->executions);
+	free(p->jumps);
+	free(p);
+    }
+}
+
+// Requires: addr is in the text section of p
+// Record that the instruction at addr is being executed
+void profile_execution(profile_t *p, address_type addr)
+{
+    p->executions[addr]++;
+}
+
+// Requires: addr is in the text section of p
+// Record that the instruction at addr, which was just executed,
+// did not go on to the next address (so it jumped)
+void profile_jump(profile_t *p, address_type addr)
+{
+    p->jumps[addr]++;
+}
+
+// Is bi a conditional branch?
+static bool is_branch(bin_instr_t bi)
+{
+    switch (bi.immed.op) {
+    case BEQ_O: case BGEZ_O: case BGTZ_O: case BLEZ_O: case BLTZ_O:
+    case BNE_O:
+	return true;
+    default:
+	return false;
+    }
+}
+
+// Compare the hot_address_t values pointed to by a and b by their
+// execution counts, so qsort puts the most executed first
+// (and equal counts in address order)
+static int compare_executions(const void *a, const void *b)
+{
+    const hot_address_t *x = a;
+    const hot_address_t *y = b;
+    if (x->executions != y->executions) {
+	return x->executions > y->executions ? -1 : 1;
+    }
+    return x->addr < y->addr ? -1 : (x->addr > y->addr);
+}
+
+// Print to out the execution counts of p totalled by mnemonic
+// (in the order the mnemonics first appear in the text section)
+static void print_mnemonic_totals(const profile_t *p, FILE *out,
+				  const bin_instr_t *instrs,
+				  unsigned long total)
+{
+    // there are fewer mnemonics than instructions
+    const char **names = malloc((p->text_words + 1) * sizeof(const char *));
+    unsigned long *counts = calloc(p->text_words + 1, sizeof(unsigned long));
+    if (names == NULL || counts == NULL) {
+	bail_with_error("Cannot allocate space to total the profile!");
+    }
+    int num_names = 0;
+    for (address_type a = 0; a < p->text_words; a++) {
+	const char *name = instruction_mnemonic(instrs[a]);
+	int i = 0;
+	while (i < num_names && strcmp(names[i], name) != 0) {
+	    i++;
+	}
+	if (i == num_names) {
+	    names[num_names++] = name;
+	}
+	counts[i] += p->executions[a];
+    }
+    fprintf(out, "%-8s %12s %7s\n", "Mnemonic", "Executions", "Percent");
+    for (int i = 0; i < num_names; i++) {
+	if (counts[i] != 0) {
+	    fprintf(out, "%-8s %12lu %6.2f%%\n", names[i], counts[i],
+		    100.0 * counts[i] / total);
+	}
+    }
+    free(names);
+    free(counts);
+}
+
+// Return the execution counts of p, indexed by address, which
+// have room for one more than the length of the text section
+// (for run loops that count executions themselves)
+unsigned long *profile_execution_counts(profile_t *p)
+{
+    return p->executions;
+}
+
+// Return the jump counts of p, indexed by address, which
+// have room for one more than the length of the text section
+// (for run loops that count jumps themselves)
+unsigned long *profile_jump_counts(profile_t *p)
+{
+    return p->jumps;
+}
+
+// Requires: instrs is the VM's memory (so starts with the text section)
+// Print to out the execution counts of p totalled by mnemonic,
+// followed by the PROFILE_HOT_COUNT most executed addresses
+// (with their instructions' assembly forms and,
+// for conditional branches, how often they were taken and not taken)
+void profile_print_table(const profile_t *p, FILE *out,
+			 const bin_instr_t *instrs)
+{
+    unsigned long total = 0;
+    for (address_type a = 0; a < p->text_words; a++) {
+	total += p->executions[a];
+    }
+    fprintf(out, "Profile: %lu instructions executed\n", total);
+    if (total == 0) {
+	return;
+    }
+    print_mnemonic_totals(p, out, instrs, total);
+
+    hot_address_t *order = malloc((p->text_words + 1) * sizeof(hot_address_t));
+    if (order == NULL) {
+	bail_with_error("Cannot allocate space to sort the profile!");
+    }
+    for (address_type a = 0; a < p->text_words; a++) {
+	order[a].addr = a;
+	order[a].executions = p->executions[a];
+    }
+    qsort(order, p->text_words, sizeof(hot_address_t), compare_executions);
+    fprintf(out, "%6s %12s %7s %12s %12s  %s\n", "Addr", "Executions",
+	    "Percent", "Taken", "Not taken", "Instruction");
+    for (unsigned int i = 0; i < PROFILE_HOT_COUNT && i < p->text_words; i++) {
+	address_type a = order[i].addr;
+	if (p->executions[a] == 0) {
+	    break;
+	}
+	fprintf(out, "%6u %12lu %6.2f%% ", a, p->executions[a],
+		100.0 * p->executions[a] / total);
+	if (is_branch(instrs[a])) {
+	    fprintf(out, "%12lu %12lu", p->jumps[a],
+		    p->executions[a] - p->jumps[a]);
+	} else {
+	    fprintf(out, "%12s %12s", "", "");
+	}
+	fprintf(out, "  %s\n", instruction_assembly_form(a, instrs[a]));
+    }
+    free(order);
+}
+
+// Print to out the execution counts of p totalled by the procedure
+// or label (in symbols) that each address is in,
+// the PROFILE_HOT_COUNT most executed first
+void profile_print_symbols(const profile_t *p, FILE *out,
+			   const bof_symbols_t *symbols)
+{
+    // the executions of each symbol are totalled at its index
+    // (and those of addresses in no symbol are not counted)
+    hot_address_t *order = malloc((symbols->count + 1)
+				  * sizeof(hot_address_t));
+    if (order == NULL) {
+	bail_with_error("Cannot allocate space to total the profile!");
+    }
+    for (uword_type i = 0; i < symbols->count; i++) {
+	order[i].addr = i;
+	order[i].executions = 0;
+    }
+    unsigned long total = 0;
+    uword_type sym = BOF_NO_SYMBOL;
+    for (address_type a = 0; a < p->text_words; a++) {
+	// (the symbol only changes at the address of another symbol)
+	if (a == 0 || bof_symbols_at(symbols, a) != BOF_NO_SYMBOL) {
+	    sym = bof_symbols_containing(symbols, a);
+	}
+	total += p->executions[a];
+	if (sym != BOF_NO_SYMBOL) {
+	    order[sym].executions += p->executions[a];
+	}
+    }
+    if (total > 0) {
+	qsort(order, symbols->count, sizeof(hot_address_t),
+	      compare_executions);
+	fprintf(out, "By procedure or label:\n");
+	for (unsigned int i = 0; i < PROFILE_HOT_COUNT && i < symbols->count;
+	     i++) {
+	    if (order[i].executions == 0) {
+		break;
+	    }
+	    fprintf(out, "%s: %.2f%% of instructions (%lu)\n",
+		    bof_symbols_name(symbols, order[i].addr),
+		    100.0 * order[i].executions / total, order[i].executions);
+	}
+    }
+    free(order);
+}
+
+// Requires: instrs is the VM's memory (so starts with the text section)
+// Write the profile p to out, for other tools, as tab-separated values:
+// a heading line, then one line for each address in the text section,
+// giving the address, the number of times it executed,
+// the number of times it was taken and not taken (for a conditional
+// branch, otherwise both are 0), its mnemonic, and its assembly form
+void profile_write(const profile_t *p, FILE *out, const bin_instr_t *instrs)
+{
+    fprintf(out, "address\texecutions\ttaken\tnot_taken\tmnemonic\tinstruction\n");
+    for (address_type a = 0; a < p->text_words; a++) {
+	unsigned long taken = 0;
+	unsigned long not_taken = 0;
+	if (is_branch(instrs[a])) {
+	    taken = p->jumps[a];
+	    not_taken = p->executions[a] - p->jumps[a];
+	}
+	fprintf(out, "%u\t%lu\t%lu\t%lu\t%s\t", a, p->executions[a],
+		taken, not_taken, instruction_mnemonic(instrs[a]));
+	// the assembly form may contain tabs (before a comment)
+	for (const char *c = instruction_assembly_form(a, instrs[a]);
+	     *c != '\0'; c++) {
+	    fputc(*c == '\t' ? ' ' : *c, out);
+	}
+	fputc('\n', out);
+    }
+}
@@ -0,0 +1,68 @@
+/* $Id$ */
+// Execution profiles: how often each instruction of the text section
+// ran, and how often it jumped
+#ifndef _PROFILE_H
+#define _PROFILE_H
+#include <stdio.h>
+#include "machine_types.h"
+#include "instruction.h"
+#include "bof.h"
+
+// the number of the most executed addresses printed in the table
+#define PROFILE_HOT_COUNT 20
+
+// The profile of one program's run
+typedef struct profile_s profile_t;
+
+// Return a new profile, with (zeroed) counters for a text section
+// of text_length words, exiting with an error message
+// if that is not possible
+extern profile_t *profile_create(unsigned int text_length);
+
+// Free the profile p
+extern void profile_destroy(profile_t *p);
+
+// Requires: addr is in the text section of p
+// Record that the instruction at addr is being executed
+extern void profile_execution(profile_t *p, address_type addr);
+
+// Requires: addr is in the text section of p
+// Record that the instruction at addr, which was just executed,
+// did not go on to the next address (so it jumped)
+extern void profile_jump(profile_t *p, address_type addr);
+
+// Return the execution counts of p, indexed by address, which
+// have room for one more than the length of the text section
+// (for run loops that count executions themselves)
+extern unsigned long *profile_execution_counts(profile_t *p);
+
+// Return the jump counts of p, indexed by address, which
+// have room for one more than the length of the text section
+// (for run loops that count jumps themselves)
+extern unsigned long *profile_jump_counts(profile_t *p);
+
+// Requires: instrs is the VM's memory (so starts with the text section)
+// Print to out the execution counts of p totalled by mnemonic,
+// followed by the PROFILE_HOT_COUNT most executed addresses
+// (with their instructions' assembly forms and,
+// for conditional branches, how often they were taken and not taken)
+extern void profile_print_table(const profile_t *p, FILE *out,
+				const bin_instr_t *instrs);
+
+// Print to out the execution counts of p totalled by the procedure
+// or label (in symbols) that each address is in (see
+// bof_symbols_containing), the PROFILE_HOT_COUNT most executed first,
+// in the form "name: 38.00% of instructions"
+extern void profile_print_symbols(const profile_t *p, FILE *out,
+				  const bof_symbols_t *symbols);
+
+// Requires: instrs is the VM's memory (so starts with the text section)
+// Write the profile p to out, for other tools, as tab-separated values:
+// a heading line, then one line for each address in the text section,
+// giving the address, the number of times it executed,
+// the number of times it was taken and not taken (for a conditional
+// branch, otherwise both are 0), its mnemonic, and its assembly form
+extern void profile_write(const profile_t *p, FILE *out,
+			  const bin_instr_t *instrs);
+
+#endif
@@ -0,0 +1,655 @@
+/* $Id$ */
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "randbof.h"
+#include "bof.h"
+#include "instruction.h"
+#include "regname.h"
+#include "utilities.h"
+
+// the registers the prologue sets to copies of $gp and $sp
+// (which are used as base registers, but never changed after that)
+#define R_GP 3
+#define R_SP 4
+// the registers that hold random values (never used as base registers)
+#define R_RANDOM 5
+#define NUM_RANDOM_REGISTERS 2
+
+// the words at these offsets from the start of the data section
+// are set by the generator, and never written by the program:
+// the address of a scratch word (for LWI), the address of the loop's
+// tail (for JMP) and of the first subroutine (for CSI), nonzero divisors
+// (for DIV), the loop counter (written only by the prologue and tail),
+// instructions that the program copies into its text section,
+// and a null-terminated string (for PSTR)
+#define D_POINTER 0
+#define D_TAIL 2
+#define D_SUBROUTINE 3
+#define D_DIVISORS 4
+#define NUM_DIVISORS 4
+#define D_COUNTER 8
+#define D_PATCHES 9
+#define NUM_PATCHES 3
+#define D_STRING 12
+// the first of the scratch words of the data section,
+// which the program reads and writes
+#define D_SCRATCH 16
+
+// the number of words of the stack (below $fp) the body uses,
+// which the prologue reserves by moving $sp down
+#define FRAME_WORDS 128
+
+// the gap between the text section and the data section, in words
+#define TEXT_GAP 4
+
+// the numbers of items in the body of the loop and in each subroutine,
+// and the most subroutines
+#define MIN_BODY_ITEMS 20
+#define MAX_BODY_ITEMS 80
+#define MAX_SUBROUTINE_ITEMS 30
+#define MAX_SUBROUTINES 3
+
+// the fewest and most iterations of the loop
+#define MIN_ITERATIONS 60
+#define MAX_ITERATIONS 120
+
+// the most item starts a forward branch chooses its target from
+#define MAX_TARGET_CHOICES 8
+
+// the most words of any item
+#define MAX_ITEM_WORDS 12
+
+// the kinds of instructions whose targets are filled in
+// after the instructions are generated
+typedef enum {fix_branch, fix_jrel, fix_jmpa, fix_call, fix_patch
+} fixup_kind;
+
+// an instruction whose target is filled in later
+typedef struct {
+    fixup_kind kind;
+    address_type addr;
+    // (the subroutine called, for fix_call)
+    unsigned int subroutine;
+} fixup_t;
+
+// The state of the generator of a program: the random number generator,
+// the text section, and where the items of the text start.
+// An item is one instruction, or a group of them that must run together
+// (so that branches only go to the start of an item).
+typedef struct {
+    uint64_t random;
+    bin_instr_t text[RANDBOF_MAX_TEXT_WORDS];
+    unsigned int count;
+    bool item_start[RANDBOF_MAX_TEXT_WORDS];
+    // which instructions (single items that compute) may be overwritten
+    // with another such instruction
+    bool patchable[RANDBOF_MAX_TEXT_WORDS];
+    fixup_t fixups[RANDBOF_MAX_TEXT_WORDS];
+    unsigned int num_fixups;
+    // the first fixup of the region (the body or a subroutine)
+    // being generated
+    unsigned int region_fixups;
+    address_type subroutines[MAX_SUBROUTINES];
+    unsigned int num_subroutines;
+    bool in_subroutine;
+    // may the body change $gp, or turn tracing on (once)?
+    bool changes_gp;
+    bool traces;
+} gen_t;
+
+// Return a random number less than n (which is not 0)
+static unsigned int choose(gen_t *g, unsigned int n)
+{
+    // the splitmix64 generator
+    uint64_t z = (g->random += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z = z ^ (z >> 31);
+    return (unsigned int) (z % n);
+}
+
+// Return a random signed number that fits in the given number of bits
+static int choose_signed(gen_t *g, unsigned int bits)
+{
+    return (int) choose(g, 1u << bits) - (1 << (bits - 1));
+}
+
+// the encodings of the formats of instructions
+
+static bin_instr_t comp_instr(func0_code func, unsigned int rt, int ot,
+			      unsigned int rs, int os)
+{
+    bin_instr_t i;
+    memset(&i, 0, sizeof(i));
+    i.comp.op = COMP_O;
+    i.comp.rt = rt;
+    i.comp.ot = ot;
+    i.comp.rs = rs;
+    i.comp.os = os;
+    i.comp.func = func;
+    return i;
+}
+
+static bin_instr_t othc_instr(func1_code func, unsigned int reg, int offset,
+			      int arg)
+{
+    bin_instr_t i;
+    memset(&i, 0, sizeof(i));
+    i.othc.op = OTHC_O;
+    i.othc.reg = reg;
+    i.othc.offset = offset;
+    i.othc.arg = arg;
+    i.othc.func = func;
+    return i;
+}
+
+static bin_instr_t syscall_instr(syscall_type code, unsigned int reg,
+				 int offset)
+{
+    bin_instr_t i;
+    memset(&i, 0, sizeof(i));
+    i.syscall.op = OTHC_O;
+    i.syscall.reg = reg;
+    i.syscall.offset = offset;
+    i.syscall.code = code;
+    i.syscall.func = SYS_F;
+    return i;
+}
+
+static bin_instr_t immed_instr(op_code op, unsigned int reg, int offset,
+			       int imm)
+{
+    bin_instr_t i;
+    memset(&i, 0, sizeof(i));
+    i.immed.op = op;
+    i.immed.reg = reg;
+    i.immed.offset = offset;
+    i.immed.immed = imm;
+    return i;
+}
+
+static bin_instr_t jump_instr(op_code op, address_type addr)
+{
+    bin_instr_t i;
+    memset(&i, 0, sizeof(i));
+    i.jump.op = op;
+    i.jump.addr = addr;
+    return i;
+}
+
+// Add i to the end of the text section
+static void emit(gen_t *g, bin_instr_t i)
+{
+    if (g->count >= RANDBOF_MAX_TEXT_WORDS) {
+	bail_with_error("A generated program is too long!");
+    }
+    g->text[g->count++] = i;
+}
+
+// Start an item at the end of the text section
+static void start_item(gen_t *g)
+{
+    if (g->count + MAX_ITEM_WORDS > RANDBOF_MAX_TEXT_WORDS) {
+	bail_with_error("A generated program is too long!");
+    }
+    g->item_start[g->count] = true;
+}
+
+// Record that the instruction to be emitted next needs a fixup of kind
+static void add_fixup(gen_t *g, fixup_kind kind, unsigned int subroutine)
+{
+    fixup_t *f = &g->fixups[g->num_fixups++];
+    f->kind = kind;
+    f->addr = g->count;
+    f->subroutine = subroutine;
+}
+
+// Return a base register for the reserved data words
+// (use_gp says whether $gp holds the start of the data section)
+static unsigned int data_base(gen_t *g, bool use_gp)
+{
+    return use_gp && choose(g, 2) == 0 ? GP : R_GP;
+}
+
+// Choose a memory operand (a base register and offset) that is
+// always in the memory, and that is a scratch word if it is stored into.
+// (use_gp says whether $gp holds the start of the data section.)
+static void operand(gen_t *g, bool store, bool use_gp,
+		    unsigned int *reg, int *offset)
+{
+    unsigned int c = choose(g, 5);
+    if (c < 2) {
+	*reg = c == 0 ? data_base(g, use_gp) : R_GP;
+	*offset = store
+	    ? D_SCRATCH + choose(g, RANDBOF_DATA_WORDS - D_SCRATCH)
+	    : choose(g, RANDBOF_DATA_WORDS);
+    } else if (c < 4) {
+	// (a push or pop of a few words keeps these in the stack)
+	*reg = c == 2 ? SP : R_SP;
+	*offset = choose(g, FRAME_WORDS);
+    } else {
+	*reg = FP;
+	*offset = - (int) choose(g, FRAME_WORDS);
+    }
+}
+
+// Return a random register that holds a random value
+static unsigned int random_register(gen_t *g)
+{
+    return R_RANDOM + choose(g, NUM_RANDOM_REGISTERS);
+}
+
+// the functions of the instructions that compute a word from two operands
+// (the first three are also used to pop the stack)
+static const func0_code binary_funcs[] = {
+    ADD_F, SUB_F, CPW_F, AND_F, BOR_F, NOR_F, XOR_F, NEG_F
+};
+#define NUM_BINARY_FUNCS (sizeof(binary_funcs) / sizeof(binary_funcs[0]))
+
+// the opcodes of the instructions with immediate operands that compute
+static const op_code immediate_ops[] = {
+    ADDI_O, ANDI_O, BORI_O, NORI_O, XORI_O
+};
+#define NUM_IMMEDIATE_OPS (sizeof(immediate_ops) / sizeof(immediate_ops[0]))
+
+// the opcodes of the conditional branches
+static const op_code branch_ops[] = {
+    BEQ_O, BGEZ_O, BGTZ_O, BLEZ_O, BLTZ_O, BNE_O
+};
+#define NUM_BRANCH_OPS (sizeof(branch_ops) / sizeof(branch_ops[0]))
+
+// the number of kinds of instructions that compute (see compute):
+// the binary ones, those with immediate operands,
+// and SCA, SWR, LWI, LIT, SLL, SRL, CFHI, CFLO, MUL, DIV, and NOP
+#define NUM_COMPUTE_KINDS (NUM_BINARY_FUNCS + NUM_IMMEDIATE_OPS + 11)
+
+// Return a random instruction that computes (and does not jump,
+// or change a register other than HI and LO), with each kind
+// of instruction equally likely
+// (use_gp says whether $gp holds the start of the data section)
+static bin_instr_t compute(gen_t *g, bool use_gp)
+{
+    unsigned int rt, rs;
+    int ot, os;
+    operand(g, true, use_gp, &rt, &ot);
+    operand(g, false, use_gp, &rs, &os);
+    unsigned int k = choose(g, NUM_COMPUTE_KINDS);
+    if (k < NUM_BINARY_FUNCS) {
+	return comp_instr(binary_funcs[k], rt, ot, rs, os);
+    }
+    k -= NUM_BINARY_FUNCS;
+    if (k < NUM_IMMEDIATE_OPS) {
+	return immed_instr(immediate_ops[k], rt, ot, choose_signed(g, 16));
+    }
+    switch (k - NUM_IMMEDIATE_OPS) {
+    case 0:
+	return comp_instr(SCA_F, rt, ot, choose(g, NUM_REGISTERS),
+			  choose_signed(g, 9));
+    case 1:
+	return comp_instr(SWR_F, rt, ot, choose(g, NUM_REGISTERS), 0);
+    case 2:
+	return comp_instr(LWI_F, rt, ot, data_base(g, use_gp), D_POINTER);
+    case 3:
+	return othc_instr(LIT_F, rt, ot, choose_signed(g, 12));
+    case 4: case 5:
+	return othc_instr(k == 4 + NUM_IMMEDIATE_OPS ? SLL_F : SRL_F, rt, ot,
+			  choose(g, 32));
+    case 6:
+	return othc_instr(CFHI_F, rt, ot, 0);
+    case 7:
+	return othc_instr(CFLO_F, rt, ot, 0);
+    case 8:
+	return othc_instr(MUL_F, rs, os, 0);
+    case 9:
+	return othc_instr(DIV_F, data_base(g, use_gp),
+			  D_DIVISORS + choose(g, NUM_DIVISORS), 0);
+    default:
+	return comp_instr(NOP_F, 0, 0, 0, 0);
+    }
+}
+
+// Emit an instruction that changes a register holding a random value
+static void emit_register_change(gen_t *g)
+{
+    unsigned int reg = random_register(g);
+    unsigned int rs;
+    int os;
+    switch (choose(g, 4)) {
+    case 0:
+	emit(g, comp_instr(CPR_F, reg, 0, choose(g, NUM_REGISTERS), 0));
+	break;
+    case 1:
+	emit(g, othc_instr(choose(g, 2) == 0 ? ARI_F : SRI_F, reg, 0,
+		     choose_signed(g, 12)));
+	break;
+    default:
+	operand(g, false, true, &rs, &os);
+	emit(g, comp_instr(LWR_F, reg, 0, rs, os));
+	break;
+    }
+}
+
+// Emit a system call that reads or writes
+static void emit_io(gen_t *g)
+{
+    unsigned int reg;
+    int offset;
+    switch (choose(g, 4)) {
+    case 0:
+	operand(g, false, true, &reg, &offset);
+	emit(g, syscall_instr(print_int_sc, reg, offset));
+	break;
+    case 1:
+	operand(g, false, true, &reg, &offset);
+	emit(g, syscall_instr(print_char_sc, reg, offset));
+	break;
+    case 2:
+	emit(g, syscall_instr(print_str_sc, data_base(g, true), D_STRING));
+	break;
+    default:
+	operand(g, true, true, &reg, &offset);
+	emit(g, syscall_instr(read_char_sc, reg, offset));
+	break;
+    }
+}
+
+// Emit a push of a word, some instructions that compute, and a pop
+// (the sequences that superinstructions and the stack cache speed up),
+// or a move of $sp, $fp, or $gp around such instructions
+static void emit_stack_group(gen_t *g)
+{
+    unsigned int reg;
+    int offset;
+    unsigned int k = 2 + choose(g, 3);
+    unsigned int inside = choose(g, 3);
+    switch (choose(g, 5)) {
+    case 0: case 1:
+	emit(g, othc_instr(SRI_F, SP, 0, 1));
+	if (choose(g, 2) == 0) {
+	    emit(g, othc_instr(LIT_F, SP, 0, choose_signed(g, 12)));
+	} else {
+	    operand(g, false, true, &reg, &offset);
+	    emit(g, comp_instr(CPW_F, SP, 0, reg, offset));
+	}
+	for (unsigned int i = 0; i < inside; i++) {
+	    emit(g, compute(g, true));
+	}
+	operand(g, true, true, &reg, &offset);
+	emit(g, comp_instr(binary_funcs[choose(g, 3)], reg, offset, SP, 0));
+	emit(g, othc_instr(ARI_F, SP, 0, 1));
+	break;
+    case 2:
+	emit(g, othc_instr(SRI_F, SP, 0, k));
+	for (unsigned int i = 0; i < inside; i++) {
+	    emit(g, compute(g, true));
+	}
+	emit(g, othc_instr(ARI_F, SP, 0, k));
+	break;
+    case 3:
+	if (choose(g, 2) == 0) {
+	    emit(g, othc_instr(SRI_F, FP, 0, k));
+	    emit(g, compute(g, true));
+	    emit(g, othc_instr(ARI_F, FP, 0, k));
+	} else {
+	    emit(g, comp_instr(CPR_F, R_RANDOM, 0, FP, 0));
+	    emit(g, comp_instr(CPR_F, FP, 0, SP, 0));
+	    emit(g, compute(g, true));
+	    emit(g, comp_instr(CPR_F, FP, 0, R_RANDOM, 0));
+	}
+	break;
+    default:
+	if (!g->changes_gp) {
+	    emit(g, compute(g, true));
+	    break;
+	}
+	// (the verifier then checks the uses of $gp when they run)
+	emit(g, othc_instr(ARI_F, GP, 0, k));
+	emit(g, compute(g, false));
+	emit(g, othc_instr(SRI_F, GP, 0, k));
+	break;
+    }
+}
+
+// Emit the sequences that save and restore registers
+// in an activation record (which superinstructions speed up)
+static void emit_register_group(gen_t *g)
+{
+    unsigned int reg;
+    int offset;
+    if (choose(g, 2) == 0) {
+	for (int i = 0; i < 4; i++) {
+	    operand(g, true, true, &reg, &offset);
+	    emit(g, comp_instr(SWR_F, reg, offset, choose(g, NUM_REGISTERS), 0));
+	}
+	emit(g, comp_instr(CPR_F, random_register(g), 0, random_register(g), 0));
+	emit(g, othc_instr(SRI_F, random_register(g), 0, choose_signed(g, 12)));
+    } else {
+	for (int i = 0; i < 3; i++) {
+	    operand(g, false, true, &reg, &offset);
+	    emit(g, comp_instr(LWR_F, random_register(g), 0, reg, offset));
+	}
+	emit(g, comp_instr(CPR_F, random_register(g), 0, choose(g, NUM_REGISTERS), 0));
+    }
+}
+
+// Emit a jump or branch forward (or a call, outside of subroutines)
+static void emit_jump(gen_t *g)
+{
+    unsigned int reg;
+    int offset;
+    unsigned int c = choose(g, g->in_subroutine ? 8 : 12);
+    if (c < 6) {
+	operand(g, false, true, &reg, &offset);
+	add_fixup(g, fix_branch, 0);
+	emit(g, immed_instr(branch_ops[c], reg, offset, 0));
+    } else if (c == 6) {
+	add_fixup(g, fix_jrel, 0);
+	emit(g, othc_instr(JREL_F, 0, 0, 0));
+    } else if (c == 7) {
+	add_fixup(g, fix_jmpa, 0);
+	emit(g, jump_instr(JMPA_O, 0));
+    } else if (c < 10) {
+	add_fixup(g, fix_call, choose(g, g->num_subroutines));
+	emit(g, jump_instr(CALL_O, 0));
+    } else if (c == 10) {
+	emit(g, othc_instr(CSI_F, data_base(g, true), D_SUBROUTINE, 0));
+    } else {
+	emit(g, othc_instr(JMP_F, data_base(g, true), D_TAIL, 0));
+    }
+}
+
+// Emit a random item
+static void emit_item(gen_t *g)
+{
+    start_item(g);
+    unsigned int c = choose(g, 100);
+    if (c < 40) {
+	g->patchable[g->count] = true;
+	emit(g, compute(g, true));
+    } else if (c < 50) {
+	emit_register_change(g);
+    } else if (c < 55) {
+	emit_io(g);
+    } else if (c < 67) {
+	emit_stack_group(g);
+    } else if (c < 71) {
+	emit_register_group(g);
+    } else if (c < 92) {
+	emit_jump(g);
+    } else if (c < 96) {
+	// a store into the text section (see fill_in_patches)
+	add_fixup(g, fix_patch, 0);
+	emit(g, comp_instr(CPW_F, R_GP, 0, R_GP, D_PATCHES + choose(g, NUM_PATCHES)));
+    } else if (c < 98 && g->traces) {
+	emit(g, syscall_instr(start_tracing_sc, 0, 0));
+	emit(g, compute(g, true));
+	emit(g, syscall_instr(stop_tracing_sc, 0, 0));
+	g->traces = false;
+    } else if (c == 99 && choose(g, 4) == 0) {
+	emit(g, syscall_instr(exit_sc, 0, choose(g, 10)));
+    } else {
+	emit(g, compute(g, true));
+    }
+}
+
+// Fill in the targets of the branches and jumps of the region
+// (the body or a subroutine) that ends with the item at end,
+// choosing one of the next few items after each
+static void fill_in_region(gen_t *g, address_type end)
+{
+    for (unsigned int f = g->region_fixups; f < g->num_fixups; f++) {
+	fixup_t *fx = &g->fixups[f];
+	if (fx->kind == fix_call || fx->kind == fix_patch) {
+	    continue;
+	}
+	address_type targets[MAX_TARGET_CHOICES];
+	unsigned int n = 0;
+	for (address_type a = fx->addr + 1; a <= end && n < MAX_TARGET_CHOICES;
+	     a++) {
+	    if (g->item_start[a]) {
+		targets[n++] = a;
+	    }
+	}
+	address_type target = targets[choose(g, n)];
+	bin_instr_t *i = &g->text[fx->addr];
+	if (fx->kind == fix_branch) {
+	    i->immed.immed = target - fx->addr;
+	} else if (fx->kind == fix_jrel) {
+	    i->othc.arg = target - fx->addr;
+	} else {
+	    i->jump.addr = target;
+	}
+    }
+    g->region_fixups = g->num_fixups;
+}
+
+// Fill in the stores into the text section, now that the start
+// of the data section (data_start) is known: each copies one of the
+// reserved instructions over a patchable instruction it can reach
+// (or becomes a NOP if there is none)
+static void fill_in_patches(gen_t *g, address_type data_start)
+{
+    address_type first = data_start > 256 ? data_start - 256 : 0;
+    unsigned int candidates = 0;
+    for (address_type a = first; a < g->count; a++) {
+	candidates += g->patchable[a];
+    }
+    for (unsigned int f = 0; f < g->num_fixups; f++) {
+	fixup_t *fx = &g->fixups[f];
+	if (fx->kind == fix_call) {
+	    g->text[fx->addr].jump.addr = g->subroutines[fx->subroutine];
+	} else if (fx->kind == fix_patch) {
+	    if (candidates == 0) {
+		g->text[fx->addr] = comp_instr(NOP_F, 0, 0, 0, 0);
+		continue;
+	    }
+	    unsigned int k = choose(g, candidates);
+	    address_type a = first;
+	    while (!g->patchable[a] || k-- > 0) {
+		a++;
+	    }
+	    g->text[fx->addr].comp.ot = (int) a - (int) data_start;
+	}
+    }
+}
+
+// Return a new random program (a binary object file's bytes, allocated
+// with malloc), which is the same for the same seed, and set *size
+// to its size in bytes. The program is a loop (of between 60 and 120
+// iterations) over a body of random instructions, whose branches
+// and jumps only go forward, and which calls random subroutines.
+void *randbof_generate(unsigned long seed, size_t *size)
+{
+    gen_t *g = calloc(1, sizeof(gen_t));
+    if (g == NULL) {
+	bail_with_error("Cannot allocate space to generate a program!");
+    }
+    g->random = seed;
+    g->changes_gp = choose(g, 4) == 0;
+    g->traces = choose(g, 8) == 0;
+    g->num_subroutines = 1 + choose(g, MAX_SUBROUTINES);
+    unsigned int iterations
+	= MIN_ITERATIONS + choose(g, MAX_ITERATIONS - MIN_ITERATIONS + 1);
+
+    // the prologue
+    emit(g, othc_instr(SRI_F, SP, 0, FRAME_WORDS));
+    emit(g, comp_instr(CPR_F, R_GP, 0, GP, 0));
+    emit(g, comp_instr(CPR_F, R_SP, 0, SP, 0));
+    emit(g, othc_instr(LIT_F, GP, D_COUNTER, iterations));
+    // (random words in the frame, so that operands are seldom 0)
+    for (unsigned int k = 0; k < FRAME_WORDS; k++) {
+	emit(g, comp_instr(CPW_F, SP, k, GP,
+			   D_SCRATCH + k % (RANDBOF_DATA_WORDS - D_SCRATCH)));
+    }
+    // the body, and the tail of the loop
+    address_type body = g->count;
+    unsigned int items
+	= MIN_BODY_ITEMS + choose(g, MAX_BODY_ITEMS - MIN_BODY_ITEMS + 1);
+    for (unsigned int i = 0; i < items; i++) {
+	emit_item(g);
+    }
+    address_type tail = g->count;
+    start_item(g);
+    emit(g, immed_instr(ADDI_O, GP, D_COUNTER, -1));
+    emit(g, immed_instr(BGTZ_O, GP, D_COUNTER, (int) body - (int) g->count));
+    emit(g, syscall_instr(exit_sc, 0, 0));
+    fill_in_region(g, tail);
+    // the subroutines
+    g->in_subroutine = true;
+    for (unsigned int s = 0; s < g->num_subroutines; s++) {
+	g->subroutines[s] = g->count;
+	items = 1 + choose(g, MAX_SUBROUTINE_ITEMS);
+	for (unsigned int i = 0; i < items; i++) {
+	    emit_item(g);
+	}
+	address_type end = g->count;
+	start_item(g);
+	emit(g, jump_instr(RTN_O, 0));
+	fill_in_region(g, end);
+    }
+
+    // the data section
+    address_type data_start = g->count + TEXT_GAP;
+    word_type data[RANDBOF_DATA_WORDS];
+    memset(data, 0, sizeof(data));
+    data[D_POINTER] = data_start + D_SCRATCH
+	+ choose(g, RANDBOF_DATA_WORDS - D_SCRATCH);
+    data[D_TAIL] = tail;
+    data[D_SUBROUTINE] = g->subroutines[0];
+    for (int i = 0; i < NUM_DIVISORS; i++) {
+	// (neither 0 nor -1, which could overflow)
+	word_type divisor = 2 + (word_type) choose(g, 1000);
+	data[D_DIVISORS + i] = choose(g, 2) == 0 ? divisor : -divisor;
+    }
+    for (int i = 0; i < NUM_PATCHES; i++) {
+	bin_instr_t patch = compute(g, true);
+	memcpy(&data[D_PATCHES + i], &patch, sizeof(patch));
+    }
+    memcpy(&data[D_STRING], "SSM\n", 4);
+    for (int i = D_SCRATCH; i < RANDBOF_DATA_WORDS; i++) {
+	data[i] = (word_type) (choose(g, 1u << 16) << 16 | choose(g, 1u << 16));
+    }
+    fill_in_patches(g, data_start);
+
+    BOFHeader bh;
+    bof_write_magic_to_header(&bh);
+    bh.text_start_address = 0;
+    bh.text_length = g->count;
+    bh.data_start_address = data_start;
+    bh.data_length = RANDBOF_DATA_WORDS;
+    bh.stack_bottom_addr = data_start + RANDBOF_DATA_WORDS
+	+ RANDBOF_STACK_WORDS;
+    size_t text_bytes = g->count * sizeof(bin_instr_t);
+    *size = sizeof(bh) + text_bytes + sizeof(data);
+    unsigned char *ret = malloc(*size);
+    if (ret == NULL) {
+	bail_with_error("Cannot allocate space for a generated program!");
+    }
+    memcpy(ret, &bh, sizeof(bh));
+    memcpy(ret + sizeof(bh), g->text, text_bytes);
+    memcpy(ret + sizeof(bh) + text_bytes, data, sizeof(data));
+    free(g);
+    return ret;
+}
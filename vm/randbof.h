@@ -0,0 +1,27 @@
+/* $Id$ */
+// A generator of random programs, in the form of binary object files,
+// that use the whole instruction set (including system calls, tracing,
+// changes to $gp, $sp, and $fp, and stores into the text section),
+// but pass the VM's verifier and run without errors,
+// to drive the shadow harness (see shadow.h)
+#ifndef _RANDBOF_H
+#define _RANDBOF_H
+#include <stddef.h>
+
+// the most words in the text section of a generated program
+#define RANDBOF_MAX_TEXT_WORDS 4096
+
+// the number of words in the data section of a generated program
+#define RANDBOF_DATA_WORDS 64
+
+// the number of words of the stack a generated program uses
+#define RANDBOF_STACK_WORDS 256
+
+// Return a new random program (a binary object file's bytes, allocated
+// with malloc), which is the same for the same seed, and set *size
+// to its size in bytes. The program is a loop (of between 60 and 120
+// iterations) over a body of random instructions, whose branches
+// and jumps only go forward, and which calls random subroutines.
+extern void *randbof_generate(unsigned long seed, size_t *size);
+
+#endif
@@ -0,0 +1,348 @@
+/* $Id$ */
+// setitimer and sigaction are only declared for -std=c17
+// with _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include "sampler.h"
+#include "decode.h"
+#include "utilities.h"
+
+// The timer is an interval timer that sends SIGPROF,
+// on hosts that have them
+#if defined(__unix__) || defined(__APPLE__)
+#define SAMPLER_TIMER 1
+#include <signal.h>
+#include <sys/time.h>
+#endif
+
+// The number of samples of one stack: the calls (depth of them,
+// outermost first) and the basic block sampled (count is 0
+// for an entry of the table that holds no stack)
+typedef struct {
+    unsigned long count;
+    address_type block;
+    unsigned int depth;
+    address_type calls[SAMPLER_MAX_DEPTH];
+} stack_count_t;
+
+struct sampler_s {
+    // the length of the text section being sampled
+    unsigned int text_words;
+    // for each address in the text section, the first address
+    // of its basic block
+    address_type *block_start;
+    // for each address in the text section, the number of samples
+    // of it (and at text_words, the number outside of the text section)
+    unsigned long *samples;
+    // the number of samples, and the number whose stacks were not counted
+    // (as the table of stacks was full)
+    unsigned long total;
+    unsigned long dropped;
+    // the stacks sampled (SAMPLER_STACKS of them), a hash table
+    // with linear probing
+    stack_count_t *stacks;
+};
+
+// an address and its number of samples, for sorting
+typedef struct {
+    address_type addr;
+    unsigned long samples;
+} hot_address_t;
+
+// Does d jump (so a basic block ends after it)?
+static bool jumps(const decoded_instr_t *d)
+{
+    switch (d->op) {
+    case DOP_BEQ: case DOP_BGEZ: case DOP_BGTZ: case DOP_BLEZ:
+    case DOP_BLTZ: case DOP_BNE:
+    case DOP_JMP: case DOP_CSI: case DOP_JREL: case DOP_JMPA:
+    case DOP_CALL: case DOP_RTN: case DOP_EXIT:
+	return true;
+    default:
+	return false;
+    }
+}
+
+// Does d jump to the address in its target field?
+static bool has_target(const decoded_instr_t *d)
+{
+    return jumps(d) && d->op != DOP_JMP && d->op != DOP_CSI
+	&& d->op != DOP_RTN && d->op != DOP_EXIT;
+}
+
+// Requires: instrs is the VM's memory (so starts with the text section)
+// Return a new sampler, with no samples, for the text section
+// of text_length words, finding its basic blocks (which start
+// at address 0, at each jump target, and after each jump).
+// Exit with an error message if that is not possible.
+sampler_t *sampler_create(const bin_instr_t *instrs, unsigned int text_length)
+{
+    sampler_t *s = malloc(sizeof(sampler_t));
+    if (s == NULL) {
+	bail_with_error("Cannot allocate a sampler!");
+    }
+    s->text_words = text_length;
+    s->total = 0;
+    s->dropped = 0;
+    // allocate at least one entry, so calloc does not return NULL
+    s->block_start = calloc(text_length + 1, sizeof(address_type));
+    s->samples = calloc(text_length + 1, sizeof(unsigned long));
+    s->stacks = calloc(SAMPLER_STACKS, sizeof(stack_count_t));
+    bool *is_start = calloc(text_length + 1, sizeof(bool));
+    if (s->block_start == NULL || s->samples == NULL || s->stacks == NULL
+	|| is_start == NULL) {
+	bail_with_error("Cannot allocate a sampler for %u instructions!",
+			text_length);
+    }
+    is_start[0] = true;
+    for (address_type a = 0; a < text_length; a++) {
+	decoded_instr_t d = decode_instr(a, instrs[a]);
+	if (has_target(&d) && d.target < text_length) {
+	    is_start[d.target] = true;
+	}
+	if (jumps(&d)) {
+	    is_start[a + 1] = true;
+	}
+    }
+    address_type current = 0;
+    for (address_type a = 0; a < text_length; a++) {
+	if (is_start[a]) {
+	    current = a;
+	}
+	s->block_start[a] = current;
+    }
+    free(is_start);
+    return s;
+}
+
+// Free the sampler s (if it is not NULL)
+void sampler_destroy(sampler_t *s)
+{
+    if (s != NULL) {
+	free(s->block_start);
+	free(s->samples);
+	free(s->stacks);
+	free(s);
+    }
+}
+
+// Record a sample of the program at pc, in the calls to the procedures
+// starting at the depth addresses in calls (outermost first).
+// This allocates nothing, so it can be called from a signal handler.
+void sampler_record(sampler_t *s, address_type pc,
+		    const address_type *calls, unsigned int depth)
+{
+    s->total++;
+    address_type block = pc;
+    if (pc < s->text_words) {
+	s->samples[pc]++;
+	block = s->block_start[pc];
+    } else {
+	s->samples[s->text_words]++;
+    }
+    // an FNV-1a hash of the stack
+    unsigned long hash = 2166136261u;
+    hash = (hash ^ block) * 16777619u;
+    for (unsigned int i = 0; i < depth; i++) {
+	hash = (hash ^ calls[i]) * 16777619u;
+    }
+    for (unsigned int probe = 0; probe < SAMPLER_STACKS; probe++) {
+	stack_count_t *e = &s->stacks[(hash + probe) % SAMPLER_STACKS];
+	if (e->count == 0) {
+	    e->block = block;
+	    e->depth = depth;
+	    memcpy(e->calls, calls, depth * sizeof(address_type));
+	    e->count = 1;
+	    return;
+	}
+	if (e->block == block && e->depth == depth
+	    && memcmp(e->calls, calls, depth * sizeof(address_type)) == 0) {
+	    e->count++;
+	    return;
+	}
+    }
+    s->dropped++;
+}
+
+// Return the number of samples of each address in the text section of s,
+// indexed by address
+const unsigned long *sampler_sample_counts(const sampler_t *s)
+{
+    return s->samples;
+}
+
+// Compare the hot_address_t values pointed to by a and b by their
+// sample counts, so qsort puts the most sampled first
+// (and equal counts in address order)
+static int compare_samples(const void *a, const void *b)
+{
+    const hot_address_t *x = a;
+    const hot_address_t *y = b;
+    if (x->samples != y->samples) {
+	return x->samples > y->samples ? -1 : 1;
+    }
+    return x->addr < y->addr ? -1 : (x->addr > y->addr);
+}
+
+// Sort the count counts (indexed by address) into order,
+// the most sampled first, returning the array (allocated with malloc)
+static hot_address_t *sort_counts(const unsigned long *counts,
+				  unsigned int count)
+{
+    hot_address_t *order = malloc((count + 1) * sizeof(hot_address_t));
+    if (order == NULL) {
+	bail_with_error("Cannot allocate space to sort the samples!");
+    }
+    for (address_type a = 0; a < count; a++) {
+	order[a].addr = a;
+	order[a].samples = counts[a];
+    }
+    qsort(order, count, sizeof(hot_address_t), compare_samples);
+    return order;
+}
+
+// Requires: instrs is the VM's memory (so starts with the text section)
+// Print to out the number of samples, followed by the SAMPLER_HOT_COUNT
+// most sampled addresses (with their instructions' assembly forms)
+// and basic blocks
+void sampler_print_table(const sampler_t *s, FILE *out,
+			 const bin_instr_t *instrs)
+{
+    fprintf(out, "Samples: %lu", s->total);
+    if (s->samples[s->text_words] != 0) {
+	fprintf(out, " (%lu outside the text section)",
+		s->samples[s->text_words]);
+    }
+    if (s->dropped != 0) {
+	fprintf(out, " (%lu with stacks not counted)", s->dropped);
+    }
+    newline(out);
+    if (s->total == 0) {
+	return;
+    }
+
+    hot_address_t *order = sort_counts(s->samples, s->text_words);
+    fprintf(out, "%6s %12s %7s  %s\n", "Addr", "Samples", "Percent",
+	    "Instruction");
+    for (unsigned int i = 0; i < SAMPLER_HOT_COUNT && i < s->text_words; i++) {
+	address_type a = order[i].addr;
+	if (order[i].samples == 0) {
+	    break;
+	}
+	fprintf(out, "%6u %12lu %6.2f%%  %s\n", a, order[i].samples,
+		100.0 * order[i].samples / s->total,
+		instruction_assembly_form(a, instrs[a]));
+    }
+    free(order);
+
+    // the samples of each block are totalled at its first address
+    unsigned long *blocks = calloc(s->text_words + 1, sizeof(unsigned long));
+    if (blocks == NULL) {
+	bail_with_error("Cannot allocate space to total the samples!");
+    }
+    for (address_type a = 0; a < s->text_words; a++) {
+	blocks[s->block_start[a]] += s->samples[a];
+    }
+    order = sort_counts(blocks, s->text_words);
+    fprintf(out, "%6s %6s %12s %7s\n", "Block", "to", "Samples", "Percent");
+    for (unsigned int i = 0; i < SAMPLER_HOT_COUNT && i < s->text_words; i++) {
+	address_type start = order[i].addr;
+	if (order[i].samples == 0) {
+	    break;
+	}
+	address_type end = start;
+	while (end + 1 < s->text_words && s->block_start[end + 1] == start) {
+	    end++;
+	}
+	fprintf(out, "%6u %6u %12lu %6.2f%%\n", start, end, order[i].samples,
+		100.0 * order[i].samples / s->total);
+    }
+    free(order);
+    free(blocks);
+}
+
+// Write the stacks sampled by s to out in the folded format,
+// naming the program's outermost frame "main", each procedure
+// by its symbol in symbols (if that is not NULL and it has one)
+// or else by its address (as "proc_23"), and ending each stack
+// with the basic block sampled (as "block_60")
+void sampler_write_folded(const sampler_t *s, FILE *out,
+			  const bof_symbols_t *symbols)
+{
+    for (unsigned int i = 0; i < SAMPLER_STACKS; i++) {
+	const stack_count_t *e = &s->stacks[i];
+	if (e->count == 0) {
+	    continue;
+	}
+	fprintf(out, "main");
+	for (unsigned int d = 0; d < e->depth; d++) {
+	    uword_type sym = symbols == NULL ? BOF_NO_SYMBOL
+		: bof_symbols_at(symbols, e->calls[d]);
+	    if (e->calls[d] == SAMPLER_UNKNOWN_FRAME) {
+		fprintf(out, ";?");
+	    } else if (sym != BOF_NO_SYMBOL) {
+		fprintf(out, ";%s", bof_symbols_name(symbols, sym));
+	    } else {
+		fprintf(out, ";proc_%u", e->calls[d]);
+	    }
+	}
+	fprintf(out, ";block_%u %lu\n", e->block, e->count);
+    }
+}
+
+#ifdef SAMPLER_TIMER
+// the function the timer calls
+static void (*timer_tick)(void) = NULL;
+
+// The handler for SIGPROF, which calls timer_tick
+static void on_timer(int sig)
+{
+    int saved_errno = errno;
+    if (timer_tick != NULL) {
+	timer_tick();
+    }
+    errno = saved_errno;
+}
+#endif
+
+// Make the timer call tick (in a handler for SIGPROF) rate times
+// for each second of CPU time this process uses, until sampler_stop.
+// Return false if there is no such timer on this host.
+bool sampler_start(unsigned int rate, void (*tick)(void))
+{
+#ifdef SAMPLER_TIMER
+    timer_tick = tick;
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_timer;
+    sigemptyset(&sa.sa_mask);
+    // so a read of the program's input is not interrupted
+    sa.sa_flags = SA_RESTART;
+    sigaction(SIGPROF, &sa, NULL);
+    long usecs = rate == 0 ? 1000000 : 1000000 / rate;
+    if (usecs < 1) {
+	usecs = 1;
+    }
+    struct itimerval it;
+    it.it_interval.tv_sec = usecs / 1000000;
+    it.it_interval.tv_usec = usecs % 1000000;
+    it.it_value = it.it_interval;
+    return setitimer(ITIMER_PROF, &it, NULL) == 0;
+#else
+    return false;
+#endif
+}
+
+// Stop the timer started by sampler_start
+void sampler_stop(void)
+{
+#ifdef SAMPLER_TIMER
+    struct itimerval it;
+    memset(&it, 0, sizeof(it));
+    setitimer(ITIMER_PROF, &it, NULL);
+#endif
+}
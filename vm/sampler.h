@@ -0,0 +1,83 @@
+/* $Id$ */
+// Statistical profiles: a timer (setitimer's ITIMER_PROF, whose SIGPROF
+// interrupts the VM a given number of times per second of CPU time)
+// samples the PC of the running program and its call stack,
+// which are totalled by address, by basic block, and by stack,
+// so the VM's run loops need not count anything.
+// The stacks are written in the folded format of flame graph tools:
+// one line per stack, with the frames (outermost first) separated
+// by semicolons, then a space and the number of samples.
+#ifndef _SAMPLER_H
+#define _SAMPLER_H
+#include <stdio.h>
+#include <stdbool.h>
+#include "machine_types.h"
+#include "instruction.h"
+#include "bof.h"
+
+// the default number of samples per second, and the most allowed
+#define SAMPLER_DEFAULT_RATE 1000
+#define SAMPLER_MAX_RATE 100000
+
+// the most calls a stack sample holds (deeper stacks are cut short,
+// losing their outermost calls)
+#define SAMPLER_MAX_DEPTH 64
+
+// the number of different stacks that can be counted
+// (samples of others are counted as dropped)
+#define SAMPLER_STACKS 4096
+
+// the number of addresses and of basic blocks printed in the table
+#define SAMPLER_HOT_COUNT 20
+
+// the frame in a stack for a call whose procedure is not known
+#define SAMPLER_UNKNOWN_FRAME ((address_type) -1)
+
+// The samples of one program's runs
+typedef struct sampler_s sampler_t;
+
+// Requires: instrs is the VM's memory (so starts with the text section)
+// Return a new sampler, with no samples, for the text section
+// of text_length words, finding its basic blocks (which start
+// at address 0, at each jump target, and after each jump).
+// Exit with an error message if that is not possible.
+extern sampler_t *sampler_create(const bin_instr_t *instrs,
+				 unsigned int text_length);
+
+// Free the sampler s (if it is not NULL)
+extern void sampler_destroy(sampler_t *s);
+
+// Record a sample of the program at pc, in the calls to the procedures
+// starting at the depth addresses in calls (outermost first).
+// This allocates nothing, so it can be called from a signal handler.
+extern void sampler_record(sampler_t *s, address_type pc,
+			   const address_type *calls, unsigned int depth);
+
+// Return the number of samples of each address in the text section of s,
+// indexed by address
+extern const unsigned long *sampler_sample_counts(const sampler_t *s);
+
+// Requires: instrs is the VM's memory (so starts with the text section)
+// Print to out the number of samples, followed by the SAMPLER_HOT_COUNT
+// most sampled addresses (with their instructions' assembly forms)
+// and basic blocks
+extern void sampler_print_table(const sampler_t *s, FILE *out,
+				const bin_instr_t *instrs);
+
+// Write the stacks sampled by s to out in the folded format,
+// naming the program's outermost frame "main", each procedure
+// by its symbol in symbols (if that is not NULL and it has one)
+// or else by its address (as "proc_23"), and ending each stack
+// with the basic block sampled (as "block_60")
+extern void sampler_write_folded(const sampler_t *s, FILE *out,
+				 const bof_symbols_t *symbols);
+
+// Make the timer call tick (in a handler for SIGPROF) rate times
+// for each second of CPU time this process uses, until sampler_stop.
+// Return false if there is no such timer on this host.
+extern bool sampler_start(unsigned int rate, void (*tick)(void));
+
+// Stop the timer started by sampler_start
+extern void sampler_stop(void);
+
+#endif
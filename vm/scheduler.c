@@ -0,0 +1,421 @@
+/* $Id$ */
+// clock_gettime is only declared for -std=c17 with _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <time.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "scheduler.h"
+#include "utilities.h"
+
+// Parked instances wait for their input with epoll on hosts that have it;
+// on others they are put back in the run queue (so they poll their input
+// each time they are run)
+#ifdef __linux__
+#define SCHEDULER_EPOLL 1
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#endif
+
+// the number of events the poller takes from epoll at once
+#define POLL_EVENTS 64
+
+// the most characters printed for an int (-2147483648)
+#define INT_CHARS 11
+
+// An instance: a machine and its program's input and output
+typedef struct instance_s {
+    machine_t *m;
+    // the program's input descriptor (or -1), whether it has been
+    // added to the epoll set, and whether its end has been read
+    int fd;
+    bool polled;
+    bool at_eof;
+    // the input read ahead but not yet read by the program
+    // is in_buf[in_next] .. in_buf[in_end-1]
+    unsigned char in_next;
+    unsigned char in_end;
+    unsigned char in_buf[SCHEDULER_INPUT_BYTES];
+    // the output (out_len bytes, in space for out_size)
+    char *out;
+    size_t out_len;
+    size_t out_size;
+    int exit_code;
+    // the next instance in the run queue
+    struct instance_s *next;
+} instance_t;
+
+struct scheduler_s {
+    scheduler_options_t opts;
+    // the instances (count of them, in space for size)
+    instance_t **instances;
+    unsigned int count;
+    unsigned int size;
+    // the run queue (from head to tail, linked by next),
+    // and the number of instances that have not finished;
+    // workers wait on has_work while the queue is empty
+    pthread_mutex_t lock;
+    pthread_cond_t has_work;
+    instance_t *head;
+    instance_t *tail;
+    unsigned int live;
+    atomic_ulong quanta;
+    atomic_ulong parks;
+#ifdef SCHEDULER_EPOLL
+    // the epoll set of the parked instances' descriptors, and an eventfd
+    // (also in that set) that wakes the poller when all have finished
+    int epoll_fd;
+    int wake_fd;
+    pthread_t poller;
+#endif
+};
+
+// Return the time, in seconds, from some fixed point in the past
+static double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Add the len characters at s to the output of inst,
+// exiting with an error message if there is no space for them
+static void add_output(instance_t *inst, const char *s, size_t len)
+{
+    if (inst->out_len + len > inst->out_size) {
+	size_t size = inst->out_size == 0 ? 64 : inst->out_size;
+	while (inst->out_len + len > size) {
+	    size *= 2;
+	}
+	inst->out = realloc(inst->out, size);
+	if (inst->out == NULL) {
+	    bail_with_error("Cannot allocate space for a program's output!");
+	}
+	inst->out_size = size;
+    }
+    memcpy(inst->out + inst->out_len, s, len);
+    inst->out_len += len;
+}
+
+// The callbacks for the system calls of the instance data
+
+// Print the string s, returning the number of characters printed
+static int print_str(void *data, const char *s)
+{
+    size_t len = strlen(s);
+    add_output(data, s, len);
+    return (int) len;
+}
+
+// Print i in decimal, returning the number of characters printed
+static int print_int(void *data, int i)
+{
+    char buf[INT_CHARS + 1];
+    int len = snprintf(buf, sizeof(buf), "%d", i);
+    add_output(data, buf, len);
+    return len;
+}
+
+// Print the character c, returning it (as an unsigned char)
+static int print_char(void *data, int c)
+{
+    char ch = (char) c;
+    add_output(data, &ch, 1);
+    return (unsigned char) ch;
+}
+
+// Return the next character of the input (as an unsigned char),
+// EOF at its end, or MACHINE_WOULD_BLOCK if none has arrived yet
+static int read_char(void *data)
+{
+    instance_t *inst = data;
+    while (inst->in_next == inst->in_end) {
+	if (inst->fd < 0 || inst->at_eof) {
+	    return EOF;
+	}
+	ssize_t n = read(inst->fd, inst->in_buf, sizeof(inst->in_buf));
+	if (n > 0) {
+	    inst->in_next = 0;
+	    inst->in_end = (unsigned char) n;
+	} else if (n == 0) {
+	    inst->at_eof = true;
+	} else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+	    return MACHINE_WOULD_BLOCK;
+	} else if (errno != EINTR) {
+	    // an input that cannot be read has ended
+	    inst->at_eof = true;
+	}
+    }
+    return inst->in_buf[inst->in_next++];
+}
+
+// Return a new scheduler, with no instances, that uses opts.
+// Exit with an error message if that is not possible.
+scheduler_t *scheduler_create(const scheduler_options_t *opts)
+{
+    scheduler_t *s = calloc(1, sizeof(scheduler_t));
+    if (s == NULL) {
+	bail_with_error("Cannot allocate a scheduler!");
+    }
+    s->opts = *opts;
+    pthread_mutex_init(&s->lock, NULL);
+    pthread_cond_init(&s->has_work, NULL);
+    atomic_init(&s->quanta, 0);
+    atomic_init(&s->parks, 0);
+#ifdef SCHEDULER_EPOLL
+    s->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    s->wake_fd = eventfd(0, EFD_CLOEXEC);
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.ptr = NULL;
+    if (s->epoll_fd < 0 || s->wake_fd < 0
+	|| epoll_ctl(s->epoll_fd, EPOLL_CTL_ADD, s->wake_fd, &ev) != 0) {
+	bail_with_error("Cannot create the scheduler's epoll set!");
+    }
+#endif
+    return s;
+}
+
+// Requires: m has a loaded program, and input_fd is open for reading
+// (or is -1, for a program with no input)
+// Add an instance that runs m, reading its program's input from input_fd
+// (which is made non-blocking), and return its number (the first
+// instance added is 0, the next 1, and so on).
+// The instance uses m's callbacks for input and output (see machine_set_io),
+// and s owns m and input_fd from now on.
+unsigned int scheduler_add(scheduler_t *s, machine_t *m, int input_fd)
+{
+    instance_t *inst = calloc(1, sizeof(instance_t));
+    if (inst == NULL) {
+	bail_with_error("Cannot allocate an instance!");
+    }
+    if (s->count == s->size) {
+	s->size = s->size == 0 ? 64 : 2 * s->size;
+	s->instances = realloc(s->instances, s->size * sizeof(instance_t *));
+	if (s->instances == NULL) {
+	    bail_with_error("Cannot allocate space for %u instances!",
+			    s->size);
+	}
+    }
+    inst->m = m;
+    inst->fd = input_fd;
+    if (input_fd >= 0) {
+	int flags = fcntl(input_fd, F_GETFL);
+	if (flags < 0 || fcntl(input_fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+	    bail_with_error("Cannot make an input descriptor non-blocking!");
+	}
+    }
+    machine_io_t io = {print_str, print_int, print_char, read_char, inst};
+    machine_set_io(m, &io);
+    s->instances[s->count] = inst;
+    return s->count++;
+}
+
+// Add inst to the back of the run queue of s, waking a worker
+static void make_ready(scheduler_t *s, instance_t *inst)
+{
+    pthread_mutex_lock(&s->lock);
+    inst->next = NULL;
+    if (s->tail == NULL) {
+	s->head = inst;
+    } else {
+	s->tail->next = inst;
+    }
+    s->tail = inst;
+    pthread_cond_signal(&s->has_work);
+    pthread_mutex_unlock(&s->lock);
+}
+
+// Park inst until its input descriptor is readable,
+// or (if that descriptor cannot be polled) put it back in the run queue
+static void park(scheduler_t *s, instance_t *inst)
+{
+    atomic_fetch_add_explicit(&s->parks, 1, memory_order_relaxed);
+#ifdef SCHEDULER_EPOLL
+    // each readiness event is taken once, so only one worker resumes it
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN | EPOLLONESHOT;
+    ev.data.ptr = inst;
+    int op = inst->polled ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+    if (epoll_ctl(s->epoll_fd, op, inst->fd, &ev) == 0) {
+	inst->polled = true;
+	return;
+    }
+    // (regular files cannot be polled, but are always readable)
+#endif
+    make_ready(s, inst);
+}
+
+// Record that inst has finished, with its program's exit code,
+// waking all workers (and the poller) if it was the last
+static void finish(scheduler_t *s, instance_t *inst, int exit_code)
+{
+    inst->exit_code = exit_code;
+    pthread_mutex_lock(&s->lock);
+    s->live--;
+    if (s->live == 0) {
+	pthread_cond_broadcast(&s->has_work);
+#ifdef SCHEDULER_EPOLL
+	uint64_t one = 1;
+	if (write(s->wake_fd, &one, sizeof(one)) != sizeof(one)) {
+	    bail_with_error("Cannot wake the scheduler's poller!");
+	}
+#endif
+    }
+    pthread_mutex_unlock(&s->lock);
+}
+
+// The body of a worker thread (whose scheduler is arg), which runs
+// instances from the run queue until all have finished
+static void *work(void *arg)
+{
+    scheduler_t *s = arg;
+    for (;;) {
+	pthread_mutex_lock(&s->lock);
+	while (s->head == NULL && s->live > 0) {
+	    pthread_cond_wait(&s->has_work, &s->lock);
+	}
+	instance_t *inst = s->head;
+	if (inst == NULL) {
+	    pthread_mutex_unlock(&s->lock);
+	    return NULL;
+	}
+	s->head = inst->next;
+	if (s->head == NULL) {
+	    s->tail = NULL;
+	}
+	pthread_mutex_unlock(&s->lock);
+
+	atomic_fetch_add_explicit(&s->quanta, 1, memory_order_relaxed);
+	switch (machine_run_steps(inst->m, s->opts.quantum)) {
+	case machine_stepping:
+	    make_ready(s, inst);
+	    break;
+	case machine_blocked:
+	    park(s, inst);
+	    break;
+	case machine_exited:
+	    finish(s, inst, machine_exit_code(inst->m));
+	    break;
+	default:
+	    {
+		const char *msg = machine_error_message(inst->m);
+		add_output(inst, msg, strlen(msg));
+		add_output(inst, "\n", 1);
+		finish(s, inst, EXIT_FAILURE);
+	    }
+	    break;
+	}
+    }
+}
+
+#ifdef SCHEDULER_EPOLL
+// The body of the poller thread (whose scheduler is arg), which puts
+// parked instances back in the run queue when their input is readable,
+// until all instances have finished
+static void *poll_inputs(void *arg)
+{
+    scheduler_t *s = arg;
+    struct epoll_event events[POLL_EVENTS];
+    for (;;) {
+	int n = epoll_wait(s->epoll_fd, events, POLL_EVENTS, -1);
+	if (n < 0 && errno != EINTR) {
+	    bail_with_error("Cannot wait for the instances' input!");
+	}
+	for (int i = 0; i < n; i++) {
+	    if (events[i].data.ptr == NULL) {
+		return NULL; // the wake_fd, so all have finished
+	    }
+	    make_ready(s, events[i].data.ptr);
+	}
+    }
+}
+#endif
+
+// Run the instances of s until each has exited or failed,
+// and set *stats to what happened
+void scheduler_run(scheduler_t *s, scheduler_stats_t *stats)
+{
+    double start = now();
+    s->live = s->count;
+    for (unsigned int i = 0; i < s->count; i++) {
+	make_ready(s, s->instances[i]);
+    }
+    unsigned int threads = s->opts.threads;
+    pthread_t workers[SCHEDULER_MAX_THREADS];
+#ifdef SCHEDULER_EPOLL
+    if (s->count > 0
+	&& pthread_create(&s->poller, NULL, poll_inputs, s) != 0) {
+	bail_with_error("Cannot start the scheduler's poller!");
+    }
+#endif
+    for (unsigned int t = 0; t < threads; t++) {
+	if (pthread_create(&workers[t], NULL, work, s) != 0) {
+	    bail_with_error("Cannot start worker thread %u!", t);
+	}
+    }
+    for (unsigned int t = 0; t < threads; t++) {
+	pthread_join(workers[t], NULL);
+    }
+#ifdef SCHEDULER_EPOLL
+    if (s->count > 0) {
+	pthread_join(s->poller, NULL);
+    }
+#endif
+
+    stats->seconds = now() - start;
+    stats->quanta = atomic_load(&s->quanta);
+    stats->parks = atomic_load(&s->parks);
+    stats->failures = 0;
+    for (unsigned int i = 0; i < s->count; i++) {
+	if (s->instances[i]->exit_code != EXIT_SUCCESS) {
+	    stats->failures++;
+	}
+    }
+}
+
+// Return the exit code of the program of instance i of s
+// (or EXIT_FAILURE after an error)
+int scheduler_exit_code(scheduler_t *s, unsigned int i)
+{
+    return s->instances[i]->exit_code;
+}
+
+// Return the output of the program of instance i of s, followed by
+// any error message (which is *size bytes long and not null-terminated)
+const char *scheduler_output(scheduler_t *s, unsigned int i, size_t *size)
+{
+    *size = s->instances[i]->out_len;
+    return s->instances[i]->out;
+}
+
+// Free s, with its instances (and their machines and outputs),
+// closing their input descriptors
+void scheduler_destroy(scheduler_t *s)
+{
+    for (unsigned int i = 0; i < s->count; i++) {
+	instance_t *inst = s->instances[i];
+	machine_destroy(inst->m);
+	if (inst->fd >= 0) {
+	    close(inst->fd);
+	}
+	free(inst->out);
+	free(inst);
+    }
+    free(s->instances);
+#ifdef SCHEDULER_EPOLL
+    close(s->epoll_fd);
+    close(s->wake_fd);
+#endif
+    pthread_mutex_destroy(&s->lock);
+    pthread_cond_destroy(&s->has_work);
+    free(s);
+}
@@ -0,0 +1,77 @@
+/* $Id$ */
+// A cooperative scheduler, which multiplexes many VM instances (each
+// a machine with a loaded program) onto a few worker threads.
+// A worker takes an instance from the run queue and runs it for
+// a quantum of instructions (so instances are preempted at instruction
+// boundaries), then puts it at the back of the queue. An instance whose
+// program reads input that has not arrived yet is parked, and put back
+// in the queue when epoll says that its input descriptor is readable.
+// Each instance's output is collected in memory.
+#ifndef _SCHEDULER_H
+#define _SCHEDULER_H
+#include <stdbool.h>
+#include <stddef.h>
+#include "machine.h"
+
+// the most worker threads a scheduler can use
+#define SCHEDULER_MAX_THREADS 256
+
+// the default number of instructions in a quantum
+#define SCHEDULER_DEFAULT_QUANTUM 10000
+
+// the number of bytes of input an instance reads ahead
+#define SCHEDULER_INPUT_BYTES 64
+
+// How to run the instances
+typedef struct {
+    // the number of worker threads (from 1 to SCHEDULER_MAX_THREADS)
+    unsigned int threads;
+    // the number of instructions an instance runs before it is preempted
+    unsigned long quantum;
+} scheduler_options_t;
+
+// What happened when the instances ran
+typedef struct {
+    // the elapsed time, in seconds
+    double seconds;
+    // the number of quanta run
+    unsigned long quanta;
+    // the number of times an instance was parked (waiting for input)
+    unsigned long parks;
+    // the number of instances that did not exit with EXIT_SUCCESS
+    unsigned int failures;
+} scheduler_stats_t;
+
+// The instances being scheduled
+typedef struct scheduler_s scheduler_t;
+
+// Return a new scheduler, with no instances, that uses opts.
+// Exit with an error message if that is not possible.
+extern scheduler_t *scheduler_create(const scheduler_options_t *opts);
+
+// Requires: m has a loaded program, and input_fd is open for reading
+// (or is -1, for a program with no input)
+// Add an instance that runs m, reading its program's input from input_fd
+// (which is made non-blocking), and return its number (the first
+// instance added is 0, the next 1, and so on).
+// The instance uses m's callbacks for input and output (see machine_set_io),
+// and s owns m and input_fd from now on.
+extern unsigned int scheduler_add(scheduler_t *s, machine_t *m, int input_fd);
+
+// Run the instances of s until each has exited or failed,
+// and set *stats to what happened
+extern void scheduler_run(scheduler_t *s, scheduler_stats_t *stats);
+
+// Return the exit code of the program of instance i of s
+// (or EXIT_FAILURE after an error)
+extern int scheduler_exit_code(scheduler_t *s, unsigned int i);
+
+// Return the output of the program of instance i of s, followed by
+// any error message (which is *size bytes long and not null-terminated)
+extern const char *scheduler_output(scheduler_t *s, unsigned int i, size_t *size);
+
+// Free s, with its instances (and their machines and outputs),
+// closing their input descriptors
+extern void scheduler_destroy(scheduler_t *s);
+
+#endif
@@ -0,0 +1,214 @@
+/* $Id$ */
+// sysconf and getrusage are only declared for -std=c17 with _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+// The scheduler's driver, which runs the programs listed in a job file
+// (as for vm_batch) as concurrent VM instances on a few threads,
+// each reading its input from its file (which may be a FIFO or a device,
+// so a program can wait for input that has not yet been written;
+// a FIFO with no writer when it is read reads as empty)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include "batch.h"
+#include "scheduler.h"
+#include "bof.h"
+#include "utilities.h"
+
+/* Print a usage message on stderr and exit with exit code 1. */
+static void usage(const char *cmdname)
+{
+    bail_with_error(
+		    "Usage: %s [-j threads] [-s steps] [-c copies] [-q] jobs\n%s\n%s\n%s\n%s\n%s\n%s",
+		    cmdname,
+		    "where each line of the file jobs is the name of a .bof file,",
+		    "optionally followed by the name of the file it reads as input,",
+		    "-j sets the number of worker threads (default: one per processor),",
+		    "-s sets the number of instructions in a quantum (default: 10000),",
+		    "-c runs that many instances of each job (default: 1),",
+		    "and -q does not print the jobs' outputs (only the statistics)");
+}
+
+// Return a copy of s (allocated with malloc), or NULL if s is NULL,
+// exiting with an error message if there is no space for it
+static char *copy_name(const char *s)
+{
+    if (s == NULL) {
+	return NULL;
+    }
+    char *ret = malloc(strlen(s) + 1);
+    if (ret == NULL) {
+	bail_with_error("Cannot allocate space for the name %s!", s);
+    }
+    return strcpy(ret, s);
+}
+
+// Add an instance running the program of job to s, whose memory
+// is just large enough for its program. Return false (setting the job's
+// output to the error message) if the program or its input
+// cannot be opened or loaded.
+static bool add_job(scheduler_t *s, batch_job_t *job, FILE *discard)
+{
+    char message[MACHINE_ERROR_SIZE + 64];
+    message[0] = '\0';
+    // bof_read_open exits if it cannot open the file,
+    // so report that for just this job
+    FILE *bof = fopen(job->bof_name, "rb");
+    int fd = -1;
+    if (bof == NULL) {
+	snprintf(message, sizeof(message), "Cannot open %s!\n",
+		 job->bof_name);
+    } else {
+	fclose(bof);
+	if (job->input_name != NULL) {
+	    // (a FIFO is opened without waiting for its writer)
+	    fd = open(job->input_name, O_RDONLY | O_NONBLOCK);
+	    if (fd < 0) {
+		snprintf(message, sizeof(message),
+			 "Cannot open input file %s!\n", job->input_name);
+	    }
+	}
+    }
+    if (message[0] == '\0') {
+	machine_t *m = machine_create();
+	// only tracing output is written to the streams
+	machine_set_streams(m, NULL, discard, NULL);
+	machine_set_memory_size(m, MACHINE_MEMORY_FIT);
+	BOFFILE bf = bof_map_open(job->bof_name);
+	bool loaded = machine_load(m, bf);
+	bof_close(bf);
+	if (loaded) {
+	    scheduler_add(s, m, fd);
+	    return true;
+	}
+	snprintf(message, sizeof(message), "%s\n", machine_error_message(m));
+	machine_destroy(m);
+	if (fd >= 0) {
+	    close(fd);
+	}
+    }
+    job->output_size = strlen(message);
+    job->output = copy_name(message);
+    job->exit_code = EXIT_FAILURE;
+    return false;
+}
+
+// Run the jobs listed in a file as instances scheduled on a few threads,
+// printing their outputs on stdout and the statistics on stderr
+int main(int argc, char *argv[])
+{
+    const char *cmdname = argv[0];
+    argc--;
+    argv++;
+
+    scheduler_options_t opts;
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    opts.threads = processors < 1 ? 1 : processors;
+    opts.quantum = SCHEDULER_DEFAULT_QUANTUM;
+    unsigned int copies = 1;
+    bool quiet = false;
+    while (argc > 1 && argv[0][0] == '-') {
+	if (strcmp(argv[0], "-q") == 0) {
+	    quiet = true;
+	    argc--;
+	    argv++;
+	} else if (strcmp(argv[0], "-j") == 0 && argc > 2) {
+	    int threads = atoi(argv[1]);
+	    if (threads < 1 || threads > SCHEDULER_MAX_THREADS) {
+		usage(cmdname);
+	    }
+	    opts.threads = threads;
+	    argc -= 2;
+	    argv += 2;
+	} else if (strcmp(argv[0], "-s") == 0 && argc > 2) {
+	    long steps = atol(argv[1]);
+	    if (steps < 1) {
+		usage(cmdname);
+	    }
+	    opts.quantum = steps;
+	    argc -= 2;
+	    argv += 2;
+	} else if (strcmp(argv[0], "-c") == 0 && argc > 2) {
+	    int n = atoi(argv[1]);
+	    if (n < 1) {
+		usage(cmdname);
+	    }
+	    copies = n;
+	    argc -= 2;
+	    argv += 2;
+	} else {
+	    usage(cmdname);
+	}
+    }
+    if (opts.threads > SCHEDULER_MAX_THREADS) {
+	opts.threads = SCHEDULER_MAX_THREADS;
+    }
+
+    // now there should be exactly 1 file argument
+    if (argc != 1 || argv[0][0] == '-') {
+	usage(cmdname);
+    }
+
+    unsigned int listed;
+    batch_job_t *listed_jobs = batch_read_jobs(argv[0], &listed);
+    unsigned int count = listed * copies;
+    batch_job_t *jobs = calloc(count == 0 ? 1 : count, sizeof(batch_job_t));
+    // the instance running each job (or -1 if it could not be started)
+    int *instance = malloc((count == 0 ? 1 : count) * sizeof(int));
+    if (jobs == NULL || instance == NULL) {
+	bail_with_error("Cannot allocate space for %u jobs!", count);
+    }
+    for (unsigned int j = 0; j < count; j++) {
+	jobs[j].bof_name = copy_name(listed_jobs[j / copies].bof_name);
+	jobs[j].input_name = copy_name(listed_jobs[j / copies].input_name);
+    }
+    batch_free_jobs(listed_jobs, listed);
+
+    FILE *discard = fopen("/dev/null", "w");
+    if (discard == NULL) {
+	bail_with_error("Cannot open /dev/null!");
+    }
+    scheduler_t *s = scheduler_create(&opts);
+    unsigned int added = 0;
+    for (unsigned int j = 0; j < count; j++) {
+	instance[j] = add_job(s, &jobs[j], discard) ? (int) added++ : -1;
+    }
+    scheduler_stats_t stats;
+    scheduler_run(s, &stats);
+    for (unsigned int j = 0; j < count; j++) {
+	if (instance[j] >= 0) {
+	    size_t size;
+	    const char *output = scheduler_output(s, instance[j], &size);
+	    jobs[j].exit_code = scheduler_exit_code(s, instance[j]);
+	    jobs[j].output = malloc(size == 0 ? 1 : size);
+	    if (jobs[j].output == NULL) {
+		bail_with_error("Cannot allocate space for an output!");
+	    }
+	    memcpy(jobs[j].output, output, size);
+	    jobs[j].output_size = size;
+	} else {
+	    stats.failures++;
+	}
+    }
+    if (!quiet) {
+	batch_print_outputs(stdout, jobs, count);
+    }
+
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    // avoid dividing by zero for a very fast run
+    double seconds = stats.seconds > 0 ? stats.seconds : 1e-9;
+    fprintf(stderr, "%u instances (%u failed) on %u threads in %.3f s: "
+	    "%.1f instances/s, %lu quanta, %lu parks, "
+	    "%ld KB peak resident (%.1f KB per instance)\n",
+	    count, stats.failures, opts.threads, stats.seconds,
+	    count / seconds, stats.quanta, stats.parks, ru.ru_maxrss,
+	    count == 0 ? 0.0 : (double) ru.ru_maxrss / count);
+    scheduler_destroy(s);
+    fclose(discard);
+    batch_free_jobs(jobs, count);
+    free(instance);
+    return stats.failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,409 @@
+/* $Id$ */
+// open_memstream and fmemopen are only declared for -std=c17
+// with _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "shadow.h"
+#include "instruction.h"
+#include "regname.h"
+#include "utilities.h"
+
+// the names of the engines, in the order of engine_type
+static const char *engine_names[] = {
+    "traced", "threaded", "tos", "jit"
+};
+
+// the names of the statuses of runs, in the order of machine_status
+static const char *status_names[] = {
+    "running", "exited", "failed", "blocked", "stopped"
+};
+
+// One of the two machines the harness runs, with its streams
+typedef struct {
+    machine_t *machine;
+    // the name of its engine
+    const char *name;
+    // its input (a copy of the harness's input),
+    // and its output and error streams, which are kept in memory
+    // (in output and errors, see open_memstream)
+    FILE *in;
+    FILE *out;
+    char *output;
+    size_t output_size;
+    FILE *err;
+    char *errors;
+    size_t errors_size;
+    // how its last run ended
+    machine_status status;
+    // a copy of its memory, for comparisons
+    word_type *memory;
+} side_t;
+
+// The two machines of a run in the harness,
+// the number of instructions the reference has executed,
+// and the address and encoding of the last one
+typedef struct {
+    side_t fast;
+    side_t ref;
+    unsigned long steps;
+    address_type last_pc;
+    bin_instr_t last_instr;
+} pair_t;
+
+// Set *opts to the defaults: the threaded engine with superinstructions,
+// comparing after each jump and every SHADOW_DEFAULT_INTERVAL
+// instructions, for at most SHADOW_DEFAULT_MAX_STEPS instructions
+void shadow_default_options(shadow_options_t *opts)
+{
+    opts->engine = threaded_engine;
+    opts->fusing = true;
+    opts->at_jumps = true;
+    opts->interval = SHADOW_DEFAULT_INTERVAL;
+    opts->max_steps = SHADOW_DEFAULT_MAX_STEPS;
+    opts->memory_words = 0;
+}
+
+// Create the machine of s, using engine e, with its streams,
+// and load the program in the size bytes at bof into it.
+// Return whether that worked.
+static bool side_start(side_t *s, engine_type e, const shadow_options_t *opts,
+		       const void *bof, size_t size,
+		       const char *input, size_t input_size)
+{
+    s->name = engine_names[e];
+    // (fmemopen does not write into the input, but takes a char *)
+    s->in = fmemopen(input == NULL ? "" : (char *) input, input_size, "r");
+    s->out = open_memstream(&s->output, &s->output_size);
+    s->err = open_memstream(&s->errors, &s->errors_size);
+    if (s->in == NULL || s->out == NULL || s->err == NULL) {
+	bail_with_error("Cannot open the streams for the %s engine!",
+			s->name);
+    }
+    s->machine = machine_create();
+    machine_set_streams(s->machine, s->in, s->out, s->err);
+    machine_set_engine(s->machine, e);
+    machine_set_fusion(s->machine, opts->fusing);
+    machine_set_memory_size(s->machine, opts->memory_words);
+    s->memory = NULL;
+    if (!machine_load_bytes(s->machine, bof, size)) {
+	s->status = machine_failed;
+	return false;
+    }
+    s->status = machine_stepping;
+    s->memory = malloc(machine_memory_size(s->machine) * sizeof(word_type));
+    if (s->memory == NULL) {
+	bail_with_error("Cannot allocate a copy of the memory!");
+    }
+    return true;
+}
+
+// Free the machine of s and its streams
+static void side_finish(side_t *s)
+{
+    machine_destroy(s->machine);
+    fclose(s->in);
+    fclose(s->out);
+    fclose(s->err);
+    free(s->output);
+    free(s->errors);
+    free(s->memory);
+}
+
+// Run the machine of s for (at most) steps instructions,
+// if it is still running
+static void side_run(side_t *s, unsigned long steps)
+{
+    if (s->status == machine_stepping) {
+	s->status = machine_run_steps(s->machine, steps);
+    }
+}
+
+// Start the machines of p, loading the program into each.
+// Return whether the program could be loaded.
+static bool pair_start(pair_t *p, const shadow_options_t *opts,
+		       const void *bof, size_t size,
+		       const char *input, size_t input_size)
+{
+    p->steps = 0;
+    p->last_pc = 0;
+    p->last_instr.jump.op = 0;
+    p->last_instr.jump.addr = 0;
+    bool loaded = side_start(&p->ref, traced_engine, opts, bof, size,
+			     input, input_size);
+    return side_start(&p->fast, opts->engine, opts, bof, size,
+		      input, input_size) && loaded;
+}
+
+// Free the machines of p
+static void pair_finish(pair_t *p)
+{
+    side_finish(&p->fast);
+    side_finish(&p->ref);
+}
+
+// Execute the next instruction on the reference machine of p,
+// remembering it, and return whether it jumped
+static bool ref_step(pair_t *p)
+{
+    machine_t *ref = p->ref.machine;
+    p->last_pc = machine_pc(ref);
+    word_type w = 0;
+    machine_read_memory(ref, p->last_pc, &w, 1);
+    memcpy(&p->last_instr, &w, sizeof(p->last_instr));
+    side_run(&p->ref, 1);
+    p->steps++;
+    return machine_pc(ref) != p->last_pc + 1;
+}
+
+// Run the reference machine of p, one instruction at a time,
+// for the next chunk of at most limit instructions: up to and including
+// the next jump, if at_jumps is true, or until it stops running.
+// Return the number of instructions it executed.
+static unsigned long ref_chunk(pair_t *p, bool at_jumps, unsigned long limit)
+{
+    unsigned long executed = 0;
+    while (executed < limit && p->ref.status == machine_stepping) {
+	executed++;
+	if (ref_step(p) && at_jumps) {
+	    break;
+	}
+    }
+    return executed;
+}
+
+// Print the name of each side (fast first) and its value of what
+// on out (if out is not NULL), as a difference between them
+static void print_difference(FILE *out, const pair_t *p, const char *what,
+			     long fast, long ref)
+{
+    if (out != NULL) {
+	fprintf(out, "  %s: %ld (%s) but %ld (%s)\n", what,
+		fast, p->fast.name, ref, p->ref.name);
+    }
+}
+
+// Compare the states of the machines of p, printing each difference
+// on out (if out is not NULL). Return whether they are the same.
+// (After errors, only the statuses are compared, as the machines
+// may stop at different points of the failing instruction.)
+static bool compare_states(pair_t *p, FILE *out)
+{
+    machine_t *fm = p->fast.machine;
+    machine_t *rm = p->ref.machine;
+    bool same = true;
+    if (p->fast.status != p->ref.status) {
+	if (out != NULL) {
+	    fprintf(out, "  status: %s (%s) but %s (%s)\n",
+		    status_names[p->fast.status], p->fast.name,
+		    status_names[p->ref.status], p->ref.name);
+	}
+	same = false;
+    }
+    if (p->fast.status == machine_failed || p->ref.status == machine_failed) {
+	return same;
+    }
+    if (p->fast.status == machine_exited && p->ref.status == machine_exited
+	&& machine_exit_code(fm) != machine_exit_code(rm)) {
+	print_difference(out, p, "exit code", machine_exit_code(fm),
+			 machine_exit_code(rm));
+	same = false;
+    }
+    if (machine_pc(fm) != machine_pc(rm)) {
+	print_difference(out, p, "PC", machine_pc(fm), machine_pc(rm));
+	same = false;
+    }
+    for (unsigned int r = 0; r < NUM_REGISTERS; r++) {
+	if (machine_register(fm, r) != machine_register(rm, r)) {
+	    print_difference(out, p, regname_get(r), machine_register(fm, r),
+			     machine_register(rm, r));
+	    same = false;
+	}
+    }
+    word_type fhi, flo, rhi, rlo;
+    machine_hi_lo(fm, &fhi, &flo);
+    machine_hi_lo(rm, &rhi, &rlo);
+    if (fhi != rhi) {
+	print_difference(out, p, "HI", fhi, rhi);
+	same = false;
+    }
+    if (flo != rlo) {
+	print_difference(out, p, "LO", flo, rlo);
+	same = false;
+    }
+    address_type words = machine_memory_size(rm);
+    machine_read_memory(fm, 0, p->fast.memory, words);
+    machine_read_memory(rm, 0, p->ref.memory, words);
+    if (memcmp(p->fast.memory, p->ref.memory, words * sizeof(word_type))
+	!= 0) {
+	unsigned int reported = 0;
+	for (address_type wa = 0; wa < words; wa++) {
+	    if (p->fast.memory[wa] != p->ref.memory[wa]
+		&& reported++ < SHADOW_MAX_WORDS_REPORTED) {
+		char what[32];
+		sprintf(what, "memory[%u]", wa);
+		print_difference(out, p, what, p->fast.memory[wa],
+				 p->ref.memory[wa]);
+	    }
+	}
+	if (out != NULL && reported > SHADOW_MAX_WORDS_REPORTED) {
+	    fprintf(out, "  (and %u more words of memory)\n",
+		    reported - SHADOW_MAX_WORDS_REPORTED);
+	}
+	same = false;
+    }
+    fflush(p->fast.out);
+    fflush(p->ref.out);
+    if (p->fast.output_size != p->ref.output_size
+	|| memcmp(p->fast.output, p->ref.output, p->ref.output_size) != 0) {
+	print_difference(out, p, "bytes of output", p->fast.output_size,
+			 p->ref.output_size);
+	same = false;
+    }
+    return same;
+}
+
+// Run the machines of p in lockstep, comparing their states
+// after each chunk of instructions (see ref_chunk), until they differ,
+// the reference stops running, or it has executed stop_at instructions.
+// Add the number of comparisons to *comparisons, and set *chunk
+// to the number of instructions in the last chunk.
+// Return whether the machines differ.
+static bool lockstep(pair_t *p, const shadow_options_t *opts,
+		     unsigned long stop_at, unsigned long *comparisons,
+		     unsigned long *chunk)
+{
+    *chunk = 0;
+    while (p->ref.status == machine_stepping && p->steps < stop_at) {
+	unsigned long limit = opts->interval;
+	if (limit > stop_at - p->steps) {
+	    limit = stop_at - p->steps;
+	}
+	*chunk = ref_chunk(p, opts->at_jumps, limit);
+	side_run(&p->fast, *chunk);
+	(*comparisons)++;
+	if (!compare_states(p, NULL)) {
+	    return true;
+	}
+    }
+    return false;
+}
+
+// Run the program again (on the machines of p), in the same chunks,
+// up to the start instructions after which the machines were
+// last the same, then run the next steps instructions in one chunk.
+// Return whether the machines differ after that.
+static bool replay(pair_t *p, const shadow_options_t *opts,
+		   unsigned long start, unsigned long steps,
+		   const void *bof, size_t size,
+		   const char *input, size_t input_size)
+{
+    pair_start(p, opts, bof, size, input, input_size);
+    unsigned long comparisons = 0;
+    unsigned long chunk;
+    if (lockstep(p, opts, start, &comparisons, &chunk)) {
+	return true;  // (the run is not repeatable)
+    }
+    ref_chunk(p, false, steps);
+    side_run(&p->fast, steps);
+    return !compare_states(p, NULL);
+}
+
+// Print the report of a difference between the machines of p
+// (named by name) on out, found after the given instruction,
+// which was the last of the chunk of chunk instructions
+static void print_report(FILE *out, const char *name, pair_t *p,
+			 unsigned long chunk)
+{
+    fprintf(out, "%s: the %s engine differs from the %s engine "
+	    "after instruction %lu, %s\n", name, p->fast.name, p->ref.name,
+	    p->steps, instruction_assembly_form(p->last_pc, p->last_instr));
+    if (chunk > 1) {
+	fprintf(out, "(the %s engine ran instructions %lu to %lu "
+		"in one run, so any of them may be wrong)\n",
+		p->fast.name, p->steps - chunk + 1, p->steps);
+    }
+    compare_states(p, out);
+    side_t *sides[] = {&p->fast, &p->ref};
+    for (int i = 0; i < 2; i++) {
+	side_t *s = sides[i];
+	fprintf(out, "The state of the %s engine:\n", s->name);
+	if (s->status == machine_failed) {
+	    fflush(s->err);
+	    fprintf(out, "%.*s", (int) s->errors_size, s->errors);
+	} else {
+	    machine_print_state(s->machine, out);
+	}
+    }
+}
+
+// Run the program in the size bytes at bof (a binary object file)
+// on a machine with opts's engine and on one with the traced engine,
+// each reading its own copy of the input_size bytes at input,
+// comparing their PCs, registers, HI and LO, memory, output, and status
+// at the points opts calls for, and set *result to what happened.
+// If they differ, run it again to find the first instruction
+// after which they differ, and print that instruction and both states
+// (named by name) on report. Return whether they never differed.
+bool shadow_run(const char *name, const void *bof, size_t size,
+		const char *input, size_t input_size,
+		const shadow_options_t *opts, FILE *report,
+		shadow_result_t *result)
+{
+    pair_t p;
+    result->loaded = pair_start(&p, opts, bof, size, input, input_size);
+    result->diverged = false;
+    result->comparisons = 0;
+    if (!result->loaded) {
+	fflush(p.ref.err);
+	fprintf(report, "%s: cannot be loaded: %.*s", name,
+		(int) p.ref.errors_size, p.ref.errors);
+	result->steps = 0;
+	result->status = machine_failed;
+	result->exit_code = EXIT_FAILURE;
+	pair_finish(&p);
+	return true;
+    }
+    unsigned long chunk;
+    result->diverged = lockstep(&p, opts, opts->max_steps,
+				&result->comparisons, &chunk);
+    result->steps = p.steps;
+    result->status = p.ref.status;
+    result->exit_code = machine_exit_code(p.ref.machine);
+    if (!result->diverged) {
+	pair_finish(&p);
+	return true;
+    }
+
+    // find the shortest run from the start of the chunk after which
+    // the machines differ (a binary search, as the machines are
+    // assumed to differ after longer runs when they do after a shorter one)
+    unsigned long start = p.steps - chunk;
+    unsigned long low = 1;
+    unsigned long high = chunk;
+    while (low < high) {
+	unsigned long mid = low + (high - low) / 2;
+	pair_t q;
+	bool differ = replay(&q, opts, start, mid, bof, size,
+			     input, input_size);
+	pair_finish(&q);
+	if (differ) {
+	    high = mid;
+	} else {
+	    low = mid + 1;
+	}
+    }
+    pair_t q;
+    if (replay(&q, opts, start, low, bof, size, input, input_size)
+	&& q.steps == start + low) {
+	print_report(report, name, &q, low);
+	result->steps = q.steps;
+    } else {
+	// the difference could not be found again, so report the chunk
+	print_report(report, name, &p, chunk);
+    }
+    pair_finish(&q);
+    pair_finish(&p);
+    return false;
+}
@@ -0,0 +1,75 @@
+/* $Id$ */
+// A shadow harness, which runs a program on a fast engine and,
+// in lockstep with it, on the reference interpreter (the traced engine,
+// which uses machine_execute_instr), comparing their states
+// to find the first instruction where the fast engine goes wrong
+#ifndef _SHADOW_H
+#define _SHADOW_H
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "machine.h"
+
+// the most instructions run between comparisons (by default)
+#define SHADOW_DEFAULT_INTERVAL 1000
+
+// the most instructions a run executes (by default)
+#define SHADOW_DEFAULT_MAX_STEPS 10000000UL
+
+// the most differing memory words listed in a report
+#define SHADOW_MAX_WORDS_REPORTED 8
+
+// How to run a program in the harness
+typedef struct {
+    // the engine compared with the traced engine (see machine.h)
+    engine_type engine;
+    // should superinstructions be formed (in the fast engine)?
+    bool fusing;
+    // compare the states after each jump (at the ends of basic blocks)?
+    bool at_jumps;
+    // the most instructions run between comparisons
+    unsigned long interval;
+    // stop (without finding a difference) after this many instructions
+    unsigned long max_steps;
+    // the size of each machine's memory, in words
+    // (or 0 for the default size, see machine_set_memory_size)
+    address_type memory_words;
+} shadow_options_t;
+
+// What a run in the harness found
+typedef struct {
+    // could the program be loaded?
+    bool loaded;
+    // did the engines differ?
+    bool diverged;
+    // the number of instructions that the reference executed
+    // (up to and including the first one after which the engines differ)
+    unsigned long steps;
+    // the number of times the states were compared
+    unsigned long comparisons;
+    // how the reference's run ended (machine_stepping if it was stopped
+    // after max_steps instructions)
+    machine_status status;
+    // the reference's exit code (if it exited)
+    int exit_code;
+} shadow_result_t;
+
+// Set *opts to the defaults: the threaded engine with superinstructions,
+// comparing after each jump and every SHADOW_DEFAULT_INTERVAL
+// instructions, for at most SHADOW_DEFAULT_MAX_STEPS instructions
+extern void shadow_default_options(shadow_options_t *opts);
+
+// Run the program in the size bytes at bof (a binary object file)
+// on a machine with opts's engine and on one with the traced engine,
+// each reading its own copy of the input_size bytes at input,
+// comparing their PCs, registers, HI and LO, memory, output, and status
+// at the points opts calls for, and set *result to what happened.
+// If they differ, run it again to find the first instruction
+// after which they differ, and print that instruction and both states
+// (named by name) on report. Return whether they never differed.
+extern bool shadow_run(const char *name, const void *bof, size_t size,
+		       const char *input, size_t input_size,
+		       const shadow_options_t *opts, FILE *report,
+		       shadow_result_t *result);
+
+#endif
@@ -0,0 +1,209 @@
+/* $Id$ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "shadow.h"
+#include "randbof.h"
+#include "machine.h"
+#include "utilities.h"
+
+// the size of the buffer for the name of a generated program
+#define NAME_SIZE 64
+
+/* Print a usage message on stderr and exit with exit code 1. */
+static void usage(const char *cmdname)
+{
+    bail_with_error(
+		    "Usage: %s [-e engine] [-n] [-c count] [-s steps] [-m words] [-i input] file.bof\n%s%s%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s",
+		    cmdname, "   or: ", cmdname,
+		    " [-e engine] [-n] [-c count] [-s steps] [-m words] -g seed [-r runs] [-w file.bof]",
+		    "which runs a program on engine and on the traced engine in lockstep,",
+		    "and reports the first instruction after which their states differ,",
+		    "where engine is threaded (the default), tos, or jit,",
+		    "-n turns off superinstructions (in the threaded engine),",
+		    "-c compares the states every count instructions (by default,",
+		    "after each jump and every 1000 instructions),",
+		    "-s stops after steps instructions (default: 10000000),",
+		    "-m sets the size of the memory (default: 32768 words),",
+		    "-i names the file the program reads as its input,",
+		    "-g runs the random programs generated from seed and the next",
+		    "runs - 1 seeds (default: 1) instead of file.bof,",
+		    "and -w writes the program generated from seed to file.bof");
+}
+
+// Return the contents of the file named filename (allocated with malloc),
+// and set *size to its size in bytes.
+// Exit with an error message if it cannot be read.
+static char *read_file(const char *filename, size_t *size)
+{
+    FILE *f = fopen(filename, "rb");
+    if (f == NULL) {
+	bail_with_error("Cannot open %s!", filename);
+    }
+    long bytes;
+    if (fseek(f, 0, SEEK_END) != 0 || (bytes = ftell(f)) < 0) {
+	bail_with_error("Cannot find the size of %s!", filename);
+    }
+    rewind(f);
+    // (at least 1 byte, so malloc returns a buffer)
+    char *ret = malloc(bytes + 1);
+    if (ret == NULL) {
+	bail_with_error("Cannot allocate space for %s!", filename);
+    }
+    if (fread(ret, 1, bytes, f) != (size_t) bytes) {
+	bail_with_error("Cannot read %s!", filename);
+    }
+    fclose(f);
+    *size = bytes;
+    return ret;
+}
+
+// Print what the run named name that did not differ found on out
+static void print_agreement(FILE *out, const char *name,
+			    const shadow_options_t *opts,
+			    const shadow_result_t *result)
+{
+    fprintf(out, "%s: the engines agree on %lu instructions "
+	    "(%lu comparisons), ", name, result->steps, result->comparisons);
+    if (result->status == machine_exited) {
+	fprintf(out, "and the program exited with code %d\n",
+		result->exit_code);
+    } else if (result->status == machine_failed) {
+	fprintf(out, "and the program failed with an error\n");
+    } else {
+	fprintf(out, "and the program was stopped after %lu instructions\n",
+		opts->max_steps);
+    }
+}
+
+// Run a program (or random programs) on a fast engine and the traced
+// engine in lockstep, and report the first difference between them
+int main(int argc, char *argv[])
+{
+    const char *cmdname = argv[0];
+    argc--;
+    argv++;
+
+    shadow_options_t opts;
+    shadow_default_options(&opts);
+    const char *input_name = NULL;
+    const char *write_name = NULL;
+    bool generating = false;
+    unsigned long seed = 0;
+    unsigned long runs = 1;
+    while (argc > 0 && argv[0][0] == '-') {
+	if (strcmp(argv[0], "-n") == 0) {
+	    opts.fusing = false;
+	    argc--;
+	    argv++;
+	} else if (strcmp(argv[0], "-c") == 0 && argc > 1) {
+	    long count = atol(argv[1]);
+	    if (count < 1) {
+		usage(cmdname);
+	    }
+	    opts.at_jumps = false;
+	    opts.interval = count;
+	    argc -= 2;
+	    argv += 2;
+	} else if (strcmp(argv[0], "-s") == 0 && argc > 1) {
+	    long steps = atol(argv[1]);
+	    if (steps < 1) {
+		usage(cmdname);
+	    }
+	    opts.max_steps = steps;
+	    argc -= 2;
+	    argv += 2;
+	} else if (strcmp(argv[0], "-m") == 0 && argc > 1) {
+	    long words = atol(argv[1]);
+	    if (words < 1 || words > MACHINE_MAX_MEMORY_WORDS) {
+		usage(cmdname);
+	    }
+	    opts.memory_words = (address_type) words;
+	    argc -= 2;
+	    argv += 2;
+	} else if (strcmp(argv[0], "-i") == 0 && argc > 1) {
+	    input_name = argv[1];
+	    argc -= 2;
+	    argv += 2;
+	} else if (strcmp(argv[0], "-g") == 0 && argc > 1) {
+	    generating = true;
+	    seed = strtoul(argv[1], NULL, 0);
+	    argc -= 2;
+	    argv += 2;
+	} else if (strcmp(argv[0], "-r") == 0 && argc > 1) {
+	    long count = atol(argv[1]);
+	    if (count < 1) {
+		usage(cmdname);
+	    }
+	    runs = count;
+	    argc -= 2;
+	    argv += 2;
+	} else if (strcmp(argv[0], "-w") == 0 && argc > 1) {
+	    write_name = argv[1];
+	    argc -= 2;
+	    argv += 2;
+	} else if (strcmp(argv[0], "-e") == 0 && argc > 1) {
+	    if (strcmp(argv[1], "threaded") == 0) {
+		opts.engine = threaded_engine;
+	    } else if (strcmp(argv[1], "tos") == 0) {
+		opts.engine = stack_cached_engine;
+	    } else if (strcmp(argv[1], "jit") == 0) {
+		opts.engine = jit_engine;
+	    } else {
+		usage(cmdname);
+	    }
+	    argc -= 2;
+	    argv += 2;
+	} else {
+	    usage(cmdname);
+	}
+    }
+    // there should be exactly 1 file argument, unless generating
+    if (argc != (generating ? 0 : 1) || (!generating && write_name != NULL)) {
+	usage(cmdname);
+    }
+
+    size_t input_size = 0;
+    char *input = input_name == NULL ? NULL
+	: read_file(input_name, &input_size);
+    shadow_result_t result;
+    if (!generating) {
+	size_t size;
+	char *bof = read_file(argv[0], &size);
+	bool agreed = shadow_run(argv[0], bof, size, input, input_size,
+				 &opts, stdout, &result);
+	if (agreed && result.loaded) {
+	    print_agreement(stdout, argv[0], &opts, &result);
+	}
+	free(bof);
+	free(input);
+	return agreed && result.loaded ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    unsigned long differing = 0;
+    unsigned long instructions = 0;
+    for (unsigned long r = 0; r < runs; r++) {
+	size_t size;
+	void *bof = randbof_generate(seed + r, &size);
+	if (r == 0 && write_name != NULL) {
+	    BOFFILE bf = bof_write_open(write_name);
+	    bof_write_bytes(bf, size, bof);
+	    bof_close(bf);
+	}
+	char name[NAME_SIZE];
+	sprintf(name, "seed %lu", seed + r);
+	if (!shadow_run(name, bof, size, input, input_size, &opts, stdout,
+			&result) || !result.loaded) {
+	    differing++;
+	} else if (runs == 1) {
+	    print_agreement(stdout, name, &opts, &result);
+	}
+	instructions += result.steps;
+	free(bof);
+    }
+    printf("%lu random programs (seeds %lu to %lu), %lu instructions: "
+	   "%lu differ\n", runs, seed, seed + runs - 1, instructions,
+	   differing);
+    free(input);
+    return differing == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
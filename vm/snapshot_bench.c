@@ -0,0 +1,147 @@
+/* $Id$ */
+// A benchmark that compares loading a program from its .bof file
+// (a cold load) with restoring a snapshot taken after loading it,
+// both alone and followed by running the program
+// clock_gettime is only declared for -std=c17 with _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bof.h"
+#include "machine.h"
+#include "utilities.h"
+
+// the number of times each way of starting the program is timed
+#define DEFAULT_REPEATS 10000
+
+/* Print a usage message on stderr and exit with exit code 1. */
+static void usage(const char *cmdname)
+{
+    bail_with_error(
+		    "Usage: %s [-e engine] [-r repeats] file.bof\n%s\n%s",
+		    cmdname,
+		    "where engine is threaded (the default), tos, jit, or traced,",
+		    "and repeats is how often each is timed (default: 10000)");
+}
+
+// Return the time, in seconds, from some fixed point in the past
+static double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Load the program in the file named bof_name into m,
+// exiting with an error message if that fails
+static void cold_load(machine_t *m, const char *bof_name)
+{
+    BOFFILE bf = bof_map_open(bof_name);
+    if (!machine_load(m, bf)) {
+	bail_with_error("Cannot load %s!", bof_name);
+    }
+    bof_close(bf);
+}
+
+// Restore the snapshot s into m,
+// exiting with an error message if that fails
+static void restore(machine_t *m, const machine_snapshot_t *s)
+{
+    if (!machine_restore(m, s)) {
+	bail_with_error("Cannot restore the snapshot!");
+    }
+}
+
+// Print how long each of the repeats took on average to out,
+// given the total time (in seconds) since start that they took
+static void print_time(FILE *out, const char *what, double start,
+		       int repeats)
+{
+    double seconds = now() - start;
+    fprintf(out, "%-22s %10.2f us/run\n", what, seconds * 1e6 / repeats);
+}
+
+// Time cold loads and snapshot restores of the .bof file given,
+// with and without running the program, and print the times on stdout
+int main(int argc, char *argv[])
+{
+    const char *cmdname = argv[0];
+    argc--;
+    argv++;
+
+    machine_t *m = machine_create();
+    int repeats = DEFAULT_REPEATS;
+    while (argc > 1 && argv[0][0] == '-') {
+	if (strcmp(argv[0], "-r") == 0 && argc > 2) {
+	    repeats = atoi(argv[1]);
+	    if (repeats < 1) {
+		usage(cmdname);
+	    }
+	} else if (strcmp(argv[0], "-e") == 0 && argc > 2) {
+	    if (strcmp(argv[1], "threaded") == 0) {
+		machine_set_engine(m, threaded_engine);
+	    } else if (strcmp(argv[1], "tos") == 0) {
+		machine_set_engine(m, stack_cached_engine);
+	    } else if (strcmp(argv[1], "jit") == 0) {
+		machine_set_engine(m, jit_engine);
+	    } else if (strcmp(argv[1], "traced") == 0) {
+		machine_set_engine(m, traced_engine);
+	    } else {
+		usage(cmdname);
+	    }
+	} else {
+	    usage(cmdname);
+	}
+	argc -= 2;
+	argv += 2;
+    }
+    if (argc != 1 || argv[0][0] == '-') {
+	usage(cmdname);
+    }
+    const char *bof_name = argv[0];
+
+    // the program's input is empty, and its output is discarded
+    FILE *in = tmpfile();
+    FILE *out = fopen("/dev/null", "w");
+    if (in == NULL || out == NULL) {
+	bail_with_error("Cannot open the program's input and output!");
+    }
+    machine_set_streams(m, in, out, out);
+
+    printf("%s, %d runs of each:\n", bof_name, repeats);
+    double start = now();
+    for (int i = 0; i < repeats; i++) {
+	cold_load(m, bof_name);
+    }
+    print_time(stdout, "cold load", start, repeats);
+
+    machine_snapshot_t *s = machine_snapshot(m, NULL);
+    start = now();
+    for (int i = 0; i < repeats; i++) {
+	restore(m, s);
+    }
+    print_time(stdout, "restore", start, repeats);
+
+    start = now();
+    for (int i = 0; i < repeats; i++) {
+	cold_load(m, bof_name);
+	machine_run(m, false);
+    }
+    print_time(stdout, "cold load and run", start, repeats);
+
+    // the cold loads have replaced the snapshot's decoded program
+    restore(m, s);
+    start = now();
+    for (int i = 0; i < repeats; i++) {
+	restore(m, s);
+	machine_run(m, false);
+    }
+    print_time(stdout, "restore and run", start, repeats);
+
+    machine_snapshot_destroy(s);
+    machine_destroy(m);
+    fclose(in);
+    fclose(out);
+    return EXIT_SUCCESS;
+}
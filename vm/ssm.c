@@ -0,0 +1,178 @@
+/* $Id$ */
+#include <stdlib.h>
+#include <string.h>
+#include "ssm.h"
+#include "machine.h"
+#include "regname.h"
+#include "utilities.h"
+
+// what ssm_error returns for a VM that is run before anything is loaded
+#define NOT_LOADED_MESSAGE "No program has been loaded!"
+
+// ssm.h only uses the standard headers, so check that it agrees with the VM
+_Static_assert(SSM_NUM_REGISTERS == NUM_REGISTERS,
+	       "ssm.h has the wrong number of registers");
+_Static_assert(sizeof(int32_t) == sizeof(word_type),
+	       "ssm.h has the wrong size of word");
+
+struct ssm_s {
+    machine_t *machine;
+    // has a program been loaded (even if that failed)?
+    bool loaded;
+};
+
+// Return a new VM, with nothing loaded, that uses the threaded engine
+// and stdin and stdout, and does not print error messages (see ssm_error).
+// Exit with an error message if there is no space for it.
+ssm_t *ssm_create(void)
+{
+    ssm_t *vm = malloc(sizeof(ssm_t));
+    if (vm == NULL) {
+	bail_with_error("Cannot allocate a VM!");
+    }
+    vm->machine = machine_create();
+    vm->loaded = false;
+    machine_set_streams(vm->machine, stdin, stdout, NULL);
+    return vm;
+}
+
+// Free the VM vm (if it is not NULL)
+void ssm_destroy(ssm_t *vm)
+{
+    if (vm != NULL) {
+	machine_destroy(vm->machine);
+	free(vm);
+    }
+}
+
+// Make vm run programs with the engine named name
+// ("threaded", "tos", "jit", or "traced").
+// Return false (and leave the engine as it was) for any other name.
+bool ssm_set_engine(ssm_t *vm, const char *name)
+{
+    if (strcmp(name, "threaded") == 0) {
+	machine_set_engine(vm->machine, threaded_engine);
+    } else if (strcmp(name, "tos") == 0) {
+	machine_set_engine(vm->machine, stack_cached_engine);
+    } else if (strcmp(name, "jit") == 0) {
+	machine_set_engine(vm->machine, jit_engine);
+    } else if (strcmp(name, "traced") == 0) {
+	machine_set_engine(vm->machine, traced_engine);
+    } else {
+	return false;
+    }
+    return true;
+}
+
+// Make vm use the callbacks in io (those that are not NULL)
+// for the program's input and output; if io is NULL,
+// vm goes back to using stdin and stdout
+void ssm_set_io(ssm_t *vm, const ssm_io_t *io)
+{
+    if (io == NULL) {
+	machine_set_io(vm->machine, NULL);
+	return;
+    }
+    machine_io_t mio;
+    mio.print_str = io->print_str;
+    mio.print_int = io->print_int;
+    mio.print_char = io->print_char;
+    mio.read_char = io->read_char;
+    mio.data = io->data;
+    machine_set_io(vm->machine, &mio);
+}
+
+// Make vm run the programs it loads with a memory of words words,
+// or, if words is 0, with the default size (32K words, or just enough
+// for the program's stack if that is larger).
+// Return false (and leave the size as it was) if words is too large.
+bool ssm_set_memory_words(ssm_t *vm, uint32_t words)
+{
+    if (words > MACHINE_MAX_MEMORY_WORDS) {
+	return false;
+    }
+    machine_set_memory_size(vm->machine, words);
+    return true;
+}
+
+// Load the program in the size bytes at bytes, which are the contents
+// of a binary object file, into vm (replacing any program it had),
+// and get ready to run it. Return false if it cannot be loaded
+// (see ssm_error).
+bool ssm_load(ssm_t *vm, const void *bytes, size_t size)
+{
+    vm->loaded = true;
+    return machine_load_bytes(vm->machine, bytes, size);
+}
+
+// Run the program loaded into vm for at most max_steps instructions,
+// or until it exits if max_steps is 0.
+// Return SSM_RUNNING if it can be run further, SSM_EXITED if it
+// has exited (see ssm_exit_code), or SSM_ERROR if it cannot be run,
+// because of an error or because no program was loaded (see ssm_error).
+ssm_status ssm_run(ssm_t *vm, unsigned long max_steps)
+{
+    if (!vm->loaded) {
+	return SSM_ERROR;
+    }
+    switch (machine_run_steps(vm->machine, max_steps)) {
+    case machine_stepping:
+	return SSM_RUNNING;
+    case machine_exited:
+	return SSM_EXITED;
+    default:
+	return SSM_ERROR;
+    }
+}
+
+// Return the exit code of the program that vm ran
+// (which is 0 until it exits)
+int ssm_exit_code(ssm_t *vm)
+{
+    return machine_exit_code(vm->machine);
+}
+
+// Return the message describing the error that stopped vm's last
+// load or run, or NULL if there was none
+const char *ssm_error(ssm_t *vm)
+{
+    if (!vm->loaded) {
+	return NOT_LOADED_MESSAGE;
+    }
+    return machine_error_message(vm->machine);
+}
+
+// Print the last instructions vm executed (oldest first) in assembly
+// form to out, with the registers before some of them, then the
+// registers now (for finding out how a program came to an error)
+void ssm_print_history(ssm_t *vm, FILE *out)
+{
+    if (vm->loaded) {
+	machine_print_flight_record(vm->machine, out);
+    }
+}
+
+// Return the value of vm's program counter (a word address)
+uint32_t ssm_get_pc(ssm_t *vm)
+{
+    return machine_pc(vm->machine);
+}
+
+// Requires: r < SSM_NUM_REGISTERS
+// Return the value of vm's general purpose register r
+int32_t ssm_get_register(ssm_t *vm, unsigned int r)
+{
+    return machine_register(vm->machine, r);
+}
+
+// Copy the count words of vm's memory starting at word address addr
+// into words, returning false (and copying nothing)
+// if any of them are outside of memory
+bool ssm_read_memory(ssm_t *vm, uint32_t addr, int32_t *words, size_t count)
+{
+    if (count > MACHINE_MAX_MEMORY_WORDS) {
+	return false;
+    }
+    return machine_read_memory(vm->machine, addr, (word_type *) words,
+			       (unsigned int) count);
+}
@@ -0,0 +1,101 @@
+/* $Id$ */
+// libssm: the VM as a library, for embedding it in other programs.
+// A program that uses it includes just this header (which needs only
+// the standard headers) and links with libssm.a or libssm.so.
+// Each VM is independent of the others, so different threads
+// can use different VMs at once (but not the same VM).
+#ifndef _SSM_H
+#define _SSM_H
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// the number of general purpose registers
+#define SSM_NUM_REGISTERS 8
+
+// A VM, with its registers, memory, and loaded program
+typedef struct ssm_s ssm_t;
+
+// What a run of a VM (see ssm_run) ended with
+typedef enum {SSM_RUNNING, SSM_EXITED, SSM_ERROR} ssm_status;
+
+// Callbacks for the program's input and output system calls
+// (PSTR, PINT, PCH, and RCH), which are passed data.
+// A NULL callback uses the VM's standard input or output.
+// Each returns what the system call leaves on the stack:
+// print_str and print_int return the number of characters printed,
+// print_char returns the character printed,
+// and read_char returns the character read (or EOF).
+typedef struct {
+    int (*print_str)(void *data, const char *s);
+    int (*print_int)(void *data, int i);
+    int (*print_char)(void *data, int c);
+    int (*read_char)(void *data);
+    void *data;
+} ssm_io_t;
+
+// Return a new VM, with nothing loaded, that uses the threaded engine
+// and stdin and stdout, and does not print error messages (see ssm_error).
+// Exit with an error message if there is no space for it.
+extern ssm_t *ssm_create(void);
+
+// Free the VM vm (if it is not NULL)
+extern void ssm_destroy(ssm_t *vm);
+
+// Make vm run programs with the engine named name
+// ("threaded", "tos", "jit", or "traced").
+// Return false (and leave the engine as it was) for any other name.
+extern bool ssm_set_engine(ssm_t *vm, const char *name);
+
+// Make vm use the callbacks in io (those that are not NULL)
+// for the program's input and output; if io is NULL,
+// vm goes back to using stdin and stdout
+extern void ssm_set_io(ssm_t *vm, const ssm_io_t *io);
+
+// Make vm run the programs it loads with a memory of words words,
+// or, if words is 0, with the default size (32K words, or just enough
+// for the program's stack if that is larger).
+// Return false (and leave the size as it was) if words is too large.
+extern bool ssm_set_memory_words(ssm_t *vm, uint32_t words);
+
+// Load the program in the size bytes at bytes, which are the contents
+// of a binary object file, into vm (replacing any program it had),
+// and get ready to run it. Return false if it cannot be loaded
+// (see ssm_error).
+extern bool ssm_load(ssm_t *vm, const void *bytes, size_t size);
+
+// Run the program loaded into vm for at most max_steps instructions,
+// or until it exits if max_steps is 0.
+// Return SSM_RUNNING if it can be run further, SSM_EXITED if it
+// has exited (see ssm_exit_code), or SSM_ERROR if it cannot be run,
+// because of an error or because no program was loaded (see ssm_error).
+extern ssm_status ssm_run(ssm_t *vm, unsigned long max_steps);
+
+// Return the exit code of the program that vm ran
+// (which is 0 until it exits)
+extern int ssm_exit_code(ssm_t *vm);
+
+// Return the message describing the error that stopped vm's last
+// load or run, or NULL if there was none
+extern const char *ssm_error(ssm_t *vm);
+
+// Print the last instructions vm executed (oldest first) in assembly
+// form to out, with the registers before some of them, then the
+// registers now (for finding out how a program came to an error)
+extern void ssm_print_history(ssm_t *vm, FILE *out);
+
+// Return the value of vm's program counter (a word address)
+extern uint32_t ssm_get_pc(ssm_t *vm);
+
+// Requires: r < SSM_NUM_REGISTERS
+// Return the value of vm's general purpose register r
+extern int32_t ssm_get_register(ssm_t *vm, unsigned int r);
+
+// Copy the count words of vm's memory starting at word address addr
+// into words, returning false (and copying nothing)
+// if any of them are outside of memory
+extern bool ssm_read_memory(ssm_t *vm, uint32_t addr, int32_t *words,
+			    size_t count);
+
+#endif
@@ -1,25 +1,76 @@
 /* $Id: symtab.c,v 1.4 2024/07/26 12:44:46 leavens Exp $ */
 #include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
 #include <string.h>
 #include <assert.h>
 #include "symtab.h"
 #include "utilities.h"
 
-// For a data structure, we use an array (for now),
-// although a hash table might be better...
+// For a data structure, we use an array that grows as needed
+// (keeping the entries in the order they were inserted, for iteration),
+// with a hash table (using linear probing) of indexes into it by name
 
 // size is also the index of the next element to allocate
 static int size;
+// the number of entries there is space for
+static int capacity;
 // The data structure is such that the first size entries contain actual data
-static id_attrs_assoc entries[MAX_SYMTAB_SIZE];
+static id_attrs_assoc *entries = NULL;
+// The hash table, with 2*capacity buckets (a power of 2), each holding
+// the index of an entry, or -1 if it is empty
+static int *buckets = NULL;
 
 // The symbol table's invariant
 void symtab_okay()
 {
     assert(0 <= size);
-    assert(size < MAX_SYMTAB_SIZE);
-    for (int i = size; i < MAX_SYMTAB_SIZE; i++) {
-	assert(entries[i].name == NULL);
+    assert(size <= capacity);
+    assert(entries != NULL && buckets != NULL);
+}
+
+// Return the hash of name (its FNV-1a hash)
+static uint32_t name_hash(const char *name)
+{
+    uint32_t h = 2166136261u;
+    for (const unsigned char *c = (const unsigned char *) name; *c != '\0';
+	 c++) {
+	h = (h ^ *c) * 16777619u;
+    }
+    return h;
+}
+
+// Return the bucket for name: the one holding its entry's index,
+// or else the empty one where that would go
+static int find_bucket(const char *name)
+{
+    int mask = 2 * capacity - 1;
+    int b = name_hash(name) & mask;
+    while (buckets[b] >= 0 && strcmp(entries[buckets[b]].name, name) != 0) {
+	b = (b + 1) & mask;
+    }
+    return b;
+}
+
+// Make space for new_capacity entries (and twice as many buckets),
+// keeping the size entries there are
+static void resize(int new_capacity)
+{
+    id_attrs_assoc *e = realloc(entries, new_capacity * sizeof(id_attrs_assoc));
+    int *bs = malloc(2 * new_capacity * sizeof(int));
+    if (e == NULL || bs == NULL) {
+	bail_with_error("No space to grow the symtab to %d entries!",
+			new_capacity);
+    }
+    entries = e;
+    free(buckets);
+    buckets = bs;
+    capacity = new_capacity;
+    for (int b = 0; b < 2 * capacity; b++) {
+	buckets[b] = -1;
+    }
+    for (int i = 0; i < size; i++) {
+	buckets[find_bucket(entries[i].name)] = i;
     }
 }
 
@@ -27,13 +78,7 @@ void symtab_okay()
 void symtab_initialize()
 {
     size = 0; // no data yet
-    id_attrs_assoc none;
-    none.name = NULL;
-    none.file_loc = NULL;
-    none.addr = 0;
-    for (int i = 0; i < MAX_SYMTAB_SIZE; i++) {
-	entries[i] = none;
-    }
+    resize(SYMTAB_INITIAL_SIZE);
     symtab_okay();
 }
 
@@ -44,26 +89,29 @@ unsigned int symtab_size() { return size; }
 bool symtab_empty() { return size == 0; }
 
 // Is this symbol table full? (I.e., can it not hold more mappings?)
-// (i.e., is symtab_size() equal to MAX_SYMTAB_SIZE-1)?
-bool symtab_full() { return size >= MAX_SYMTAB_SIZE; }
+// (It never is, as it grows when needed.)
+bool symtab_full() { return false; }
 
 // Is the given name associated with some attributes?
 bool symtab_defined(const char *name)
 {
     id_attrs_assoc *v = symtab_lookup(name);
     return v != NULL;
-}    
+}
 
 // Requires: !symtab_full
 // Requires: !symtab_defined(attrs.name)
 // Remember the given attributes (i.e., an association from attrs.name
 // to the other parts of attrs)
+// Exit with an error message if there is no space for them.
 void symtab_insert(id_attrs_assoc attrs)
 {
-    if (symtab_full()) {
-	bail_with_error("The symtab is full!");
+    if (size == capacity) {
+	resize(2 * capacity);
     }
-    entries[size++] = attrs;
+    entries[size] = attrs;
+    buckets[find_bucket(attrs.name)] = size;
+    size++;
 }
 
 // if name == NULL or if name is not defined, return -1
@@ -73,17 +121,13 @@ static int find_index(const char *name)
     if (name == NULL) {
 	return -1;
     }
-    for (int i = 0; i < size; i++) {
-	if (strcmp(entries[i].name, name) == 0) {
-	    return i;
-	}
-    }
-    return -1;
+    return buckets[find_bucket(name)];
 }
 
 
 // Return (a pointer to) the attributes of the given name
 // or NULL if there is no association for that name.
+// (The pointer is only valid until the next symtab_insert.)
 id_attrs_assoc *symtab_lookup(const char *name)
 {
     int i = find_index(name);
@@ -123,7 +167,7 @@ bool symtab_more_after(const char *name)
 const char *symtab_next_name(const char *name)
 {
     int i = find_index(name);
-    if (i < 0 || i >= size) {
+    if (i < 0 || i + 1 >= size) {
 	return NULL;
     } else {
 	return entries[i+1].name;
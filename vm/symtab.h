@@ -5,8 +5,9 @@
 #include <stdbool.h>
 #include "id_attrs_assoc.h"
 
-// Maximum number of names/attributes that can be stored in a symboltable
-#define MAX_SYMTAB_SIZE 1024
+// Initial number of names/attributes that a symbol table has space for
+// (it grows as needed, so this is not a limit)
+#define SYMTAB_INITIAL_SIZE 1024
 
 // initialize the symbol table
 extern void symtab_initialize();
@@ -18,7 +19,7 @@ extern unsigned int symtab_size();
 extern bool symtab_empty();
 
 // Is this symbol table full? (I.e., can it not hold more mappings?)
-// (i.e., is symtab_size() equal to MAX_SYMTAB_SIZE-1)?
+// (It never is, as it grows when needed.)
 extern bool symtab_full();
 
 // Is the given name associated with some attributes?
@@ -28,10 +29,12 @@ extern bool symtab_defined(const char *name);
 // Requires: !symtab_defined(attrs.name)
 // Remember the given attributes (i.e., an association from attrs.name
 // to the other parts of attrs)
+// Exit with an error message if there is no space for them.
 extern void symtab_insert(id_attrs_assoc attrs);
 
 // Return a pointer to the attributes of the given name
 // or NULL if there is no association for that name.
+// (The pointer is only valid until the next symtab_insert.)
 extern id_attrs_assoc *symtab_lookup(const char *name);
 
 // Start an iteration by returning the first name in the symbol table,
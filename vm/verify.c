@@ -0,0 +1,241 @@
+/* $Id$ */
+#include <stdio.h>
+#include <stdbool.h>
+#include "machine.h"
+#include "regname.h"
+#include "verify.h"
+
+// kinds of memory operands, as bits
+// the top of the stack (the word at GPR[SP])
+#define OPND_TOP 1
+// the word at GPR[ra] + oa
+#define OPND_A 2
+// the word at GPR[rb] + ob
+#define OPND_B 4
+
+// the memory operands used by each plain decoded_op (see machine_ops.inc)
+static const unsigned char operand_kinds[DOP_CHECK] = {
+    [DOP_ADD] = OPND_TOP | OPND_A | OPND_B,
+    [DOP_SUB] = OPND_TOP | OPND_A | OPND_B,
+    [DOP_CPW] = OPND_A | OPND_B,
+    [DOP_AND] = OPND_TOP | OPND_A | OPND_B,
+    [DOP_BOR] = OPND_TOP | OPND_A | OPND_B,
+    [DOP_NOR] = OPND_TOP | OPND_A | OPND_B,
+    [DOP_XOR] = OPND_TOP | OPND_A | OPND_B,
+    [DOP_LWR] = OPND_B,
+    [DOP_SWR] = OPND_A,
+    [DOP_SCA] = OPND_A,
+    [DOP_LWI] = OPND_A | OPND_B,
+    [DOP_NEG] = OPND_A | OPND_B,
+    [DOP_LIT] = OPND_A,
+    [DOP_MUL] = OPND_TOP | OPND_A,
+    [DOP_DIV] = OPND_TOP | OPND_A,
+    [DOP_CFHI] = OPND_A,
+    [DOP_CFLO] = OPND_A,
+    [DOP_SLL] = OPND_TOP | OPND_A,
+    [DOP_SRL] = OPND_TOP | OPND_A,
+    [DOP_JMP] = OPND_A,
+    [DOP_CSI] = OPND_A,
+    [DOP_ADDI] = OPND_A,
+    [DOP_ANDI] = OPND_A,
+    [DOP_BORI] = OPND_A,
+    [DOP_NORI] = OPND_A,
+    [DOP_XORI] = OPND_A,
+    [DOP_BEQ] = OPND_TOP | OPND_A,
+    [DOP_BGEZ] = OPND_A,
+    [DOP_BGTZ] = OPND_A,
+    [DOP_BLEZ] = OPND_A,
+    [DOP_BLTZ] = OPND_A,
+    [DOP_BNE] = OPND_TOP | OPND_A,
+    [DOP_PSTR] = OPND_TOP | OPND_A,
+    [DOP_PINT] = OPND_TOP | OPND_A,
+    [DOP_PCH] = OPND_TOP | OPND_A,
+    [DOP_RCH] = OPND_A,
+};
+
+// Requires: op is not a superinstruction, and d is the decoded form
+// of an instruction (with op as its plain decoded_op).
+// Put the memory operands of d into operands (which has room for
+// VERIFY_MAX_OPERANDS), and return how many there are.
+// (The words that LWI and PSTR reach through their operands
+// are not included.)
+int verify_operands(decoded_op op, const decoded_instr_t *d,
+		    verify_operand_t *operands)
+{
+    if (op >= DOP_CHECK) {
+	return 0;
+    }
+    int n = 0;
+    if (operand_kinds[op] & OPND_TOP) {
+	operands[n].reg = SP;
+	operands[n].offset = 0;
+	n++;
+    }
+    if (operand_kinds[op] & OPND_A) {
+	operands[n].reg = d->ra;
+	operands[n].offset = d->oa;
+	n++;
+    }
+    if (operand_kinds[op] & OPND_B) {
+	operands[n].reg = d->rb;
+	operands[n].offset = d->ob;
+	n++;
+    }
+    return n;
+}
+
+// Does the (plain) decoded instruction d change the register d->ra?
+static bool writes_register(const decoded_instr_t *d)
+{
+    switch (d->op) {
+    case DOP_CPR: case DOP_LWR: case DOP_ARI: case DOP_SRI:
+	return true;
+    default:
+	return false;
+    }
+}
+
+// Does d go to the address d->target (when it jumps)?
+static bool has_target(const decoded_instr_t *d)
+{
+    switch (d->op) {
+    case DOP_BEQ: case DOP_BGEZ: case DOP_BGTZ: case DOP_BLEZ:
+    case DOP_BLTZ: case DOP_BNE:
+    case DOP_JMPA: case DOP_CALL: case DOP_JREL:
+	return true;
+    default:
+	return false;
+    }
+}
+
+// Is the word at GPR[o.reg] + o.offset always in memory,
+// given the invariant (see verify.h) and what vs knows?
+static bool operand_safe(const verify_state_t *vs, verify_operand_t o)
+{
+    if (!vs->gp_fixed) {
+	return false;
+    }
+    int lowest;
+    if (o.reg == GP) {
+	lowest = vs->data_start + o.offset;
+	return 0 <= lowest && (address_type) lowest < vs->memory_words;
+    } else if (o.reg == SP || o.reg == FP) {
+	// GPR[GP] < GPR[SP] <= GPR[FP] < the memory size, and accesses
+	// up to VERIFY_GUARD_WORDS past the end of memory are harmless
+	lowest = vs->data_start + 1 + o.offset;
+	return 0 <= lowest && o.offset <= VERIFY_GUARD_WORDS;
+    }
+    return false;
+}
+
+// Requires: d is the plain decoded form of an instruction
+// Return the checks (VERIFY_CHECK_ADDRESSES and VERIFY_CHECK_STACK bits)
+// that d needs when it runs in the text section verified with vs
+unsigned int verify_checks(const verify_state_t *vs,
+			   const decoded_instr_t *d)
+{
+    unsigned int ret = 0;
+    if (writes_register(d) && (d->ra == GP || d->ra == SP || d->ra == FP)) {
+	ret |= VERIFY_CHECK_STACK;
+    }
+    if (d->op == DOP_LWI || d->op == DOP_PSTR) {
+	// the word (or string) they reach through the operand
+	// may be anywhere
+	ret |= VERIFY_CHECK_ADDRESSES;
+    }
+    verify_operand_t operands[VERIFY_MAX_OPERANDS];
+    int n = verify_operands(d->op, d, operands);
+    for (int i = 0; i < n; i++) {
+	if (!operand_safe(vs, operands[i])) {
+	    ret |= VERIFY_CHECK_ADDRESSES;
+	}
+    }
+    return ret;
+}
+
+// Verify the (plain) decoded instruction d, found at address addr,
+// returning NULL if it passes, and otherwise a message describing
+// the error (put in vs->message)
+static const char *verify_instr(verify_state_t *vs, const decoded_instr_t *d,
+				address_type addr)
+{
+    if (d->op == DOP_INVALID) {
+	snprintf(vs->message, VERIFY_MESSAGE_SIZE,
+		 "Verification error: the word at address %u %s!",
+		 addr, "in the text section is not a legal instruction");
+	return vs->message;
+    }
+    if (has_target(d) && d->target >= vs->text_words) {
+	snprintf(vs->message, VERIFY_MESSAGE_SIZE, "%s %u %s (%u) %s (%u)!",
+		 "Verification error: the instruction at address",
+		 addr, "jumps to an address", d->target,
+		 "outside of the text section, whose length is",
+		 vs->text_words);
+	return vs->message;
+    }
+    return NULL;
+}
+
+// Mark the (plain) decoded instruction d to be checked when it runs,
+// if it needs that
+static void mark(const verify_state_t *vs, decoded_instr_t *d)
+{
+    if (verify_checks(vs, d) != 0) {
+	d->checked = d->op;
+	d->op = DOP_CHECK;
+    }
+}
+
+// Requires: decoded holds the decoded form of the text section,
+// which is count words long, data_start_address is the initial
+// value of $gp, and memory_words is the size of the memory
+// Verify the text section, recording what is known about it in vs,
+// and mark each entry of decoded that needs checks when it runs
+// (by making its op DOP_CHECK).
+// Return NULL if the text section passes, and otherwise
+// a message describing the error (which is in vs).
+const char *verify_text(verify_state_t *vs, decoded_instr_t *decoded,
+			unsigned int count, address_type data_start_address,
+			address_type memory_words)
+{
+    vs->text_words = count;
+    vs->data_start = data_start_address;
+    vs->memory_words = memory_words;
+    vs->gp_fixed = true;
+    for (address_type a = 0; a < count; a++) {
+	const char *error = verify_instr(vs, &decoded[a], a);
+	if (error != NULL) {
+	    return error;
+	}
+	if (writes_register(&decoded[a]) && decoded[a].ra == GP) {
+	    vs->gp_fixed = false;
+	}
+    }
+    for (address_type a = 0; a < count; a++) {
+	mark(vs, &decoded[a]);
+    }
+    return NULL;
+}
+
+// Requires: d was just decoded again from the word at address addr
+// (which was overwritten), and verify_text was called with vs for the text.
+// Verify d, and mark it if it needs checks when it runs.
+// Set *again to whether the other entries in the text must be decoded
+// (and verified) again, because d changes $gp.
+// Return NULL if d passes, and otherwise a message describing
+// the error (which is in vs).
+const char *verify_redecoded(verify_state_t *vs, decoded_instr_t *d,
+			     address_type addr, bool *again)
+{
+    *again = false;
+    const char *error = verify_instr(vs, d, addr);
+    if (error != NULL) {
+	return error;
+    }
+    if (vs->gp_fixed && writes_register(d) && d->ra == GP) {
+	vs->gp_fixed = false;
+	*again = true;
+    }
+    mark(vs, d);
+    return NULL;
+}
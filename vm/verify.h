@@ -0,0 +1,107 @@
+/* $Id$ */
+// Load-time verification of the text section, which finds the checks
+// that can be done once, before running, and marks the instructions
+// whose checks can only be done while running
+#ifndef _VERIFY_H
+#define _VERIFY_H
+#include <stdbool.h>
+#include "machine_types.h"
+#include "decode.h"
+
+// The verifier rejects a text section that contains an illegal
+// instruction (including an unknown function or system call code)
+// or a branch, JREL, JMPA, or CALL whose target is not in the text.
+// So the run loops only need to check the PC after an indirect jump
+// (JMP, CSI, or RTN), which they always do.
+//
+// The verifier also ensures that the run loops never index outside
+// of the memory array and keep the invariant
+//     0 <= GPR[GP] < GPR[SP] <= GPR[FP] < the memory size,
+// without checking each instruction. An instruction that changes
+// $gp, $sp, or $fp is checked when it runs, and so keeps the invariant.
+// If no instruction in the text changes $gp, then it always holds
+// the start of the data section, so an address formed from $gp, $sp,
+// or $fp and an offset is at least 0 when its offset is not too
+// negative; it is also less than the memory size plus VERIFY_GUARD_WORDS
+// when its offset is at most VERIFY_GUARD_WORDS. (Loads just above
+// the end of memory read zeros; stores there are reported on hosts
+// where the guard words are in read-only pages, see machine.c.)
+// The addresses used by every other instruction are checked
+// when it runs.
+
+// the number of extra words after the end of memory
+// (the largest offset from $sp or $fp that is not checked)
+#define VERIFY_GUARD_WORDS 256
+
+// bits of the checks needed by an instruction
+// an address it uses may be outside of memory
+#define VERIFY_CHECK_ADDRESSES 1
+// it changes $gp, $sp, or $fp (so may break the invariant)
+#define VERIFY_CHECK_STACK 2
+
+// a memory operand of an instruction: the word at GPR[reg] + offset
+typedef struct {
+    unsigned char reg;
+    short offset;
+} verify_operand_t;
+
+// the most memory operands an instruction has
+#define VERIFY_MAX_OPERANDS 3
+
+// the size of the buffer for an error message
+#define VERIFY_MESSAGE_SIZE 256
+
+// What the verifier knows about the text section it last verified
+// (one for each machine)
+typedef struct {
+    // the length of the text section
+    unsigned int text_words;
+    // the start of the data section (the initial value of $gp)
+    address_type data_start;
+    // the size of the memory (in words)
+    address_type memory_words;
+    // is $gp never changed by the text section?
+    bool gp_fixed;
+    // the message describing the last verification error
+    char message[VERIFY_MESSAGE_SIZE];
+} verify_state_t;
+
+// Requires: op is not a superinstruction, and d is the decoded form
+// of an instruction (with op as its plain decoded_op).
+// Put the memory operands of d into operands (which has room for
+// VERIFY_MAX_OPERANDS), and return how many there are.
+// (The words that LWI and PSTR reach through their operands
+// are not included.)
+extern int verify_operands(decoded_op op, const decoded_instr_t *d,
+			   verify_operand_t *operands);
+
+// Requires: decoded holds the decoded form of the text section,
+// which is count words long, data_start_address is the initial
+// value of $gp, and memory_words is the size of the memory
+// Verify the text section, recording what is known about it in vs,
+// and mark each entry of decoded that needs checks when it runs
+// (by making its op DOP_CHECK).
+// Return NULL if the text section passes, and otherwise
+// a message describing the error (which is in vs).
+extern const char *verify_text(verify_state_t *vs, decoded_instr_t *decoded,
+			       unsigned int count,
+			       address_type data_start_address,
+			       address_type memory_words);
+
+// Requires: d is the plain decoded form of an instruction
+// Return the checks (VERIFY_CHECK_ADDRESSES and VERIFY_CHECK_STACK bits)
+// that d needs when it runs in the text section verified with vs
+extern unsigned int verify_checks(const verify_state_t *vs,
+				  const decoded_instr_t *d);
+
+// Requires: d was just decoded again from the word at address addr
+// (which was overwritten), and verify_text was called with vs for the text.
+// Verify d, and mark it if it needs checks when it runs.
+// Set *again to whether the other entries in the text must be decoded
+// (and verified) again, because d changes $gp.
+// Return NULL if d passes, and otherwise a message describing
+// the error (which is in vs).
+extern const char *verify_redecoded(verify_state_t *vs, decoded_instr_t *d,
+				    address_type addr, bool *again);
+
+#endif
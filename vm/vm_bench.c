@@ -0,0 +1,469 @@
+/* $Id$ */
+// A microbenchmark of the VM's engines: for each class of instructions
+// (as in instruction.h), it builds a program that runs instructions
+// of that class in a tight loop, runs it with each engine, and prints
+// the throughput (in millions of instructions per second) and the time
+// per instruction. The results can be saved as a baseline, and later
+// results compared with it, to catch performance regressions.
+// clock_gettime is only declared for -std=c17 with _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bof.h"
+#include "instruction.h"
+#include "machine.h"
+#include "regname.h"
+#include "utilities.h"
+
+// the default number of loop iterations in each program
+#define DEFAULT_ITERATIONS 200000
+// the default number of runs of each program (the fastest is reported)
+#define DEFAULT_REPEATS 5
+// the default slowdown (in percent) that counts as a regression
+#define DEFAULT_THRESHOLD 10.0
+
+// the most words of text a benchmark program has
+#define MAX_TEXT 512
+// where the program's global data (the loop counter) and stack start
+#define DATA_START 1024
+#define STACK_BOTTOM 4096
+// the number of times each loop body repeats its group of instructions
+#define GROUP_REPEATS 4
+
+// the classes of instructions benchmarked
+typedef enum {comp_class, other_comp_class, immed_class, branch_class,
+	      jump_class, syscall_class, NUM_CLASSES} bench_class;
+
+static const char *class_names[NUM_CLASSES] = {
+    "computational", "other-comp", "immediate", "branch",
+    "jump/call/rtn", "syscall"
+};
+
+// the engines, in the order they are run
+#define NUM_ENGINES 4
+static const engine_type engines[NUM_ENGINES] = {
+    traced_engine, threaded_engine, stack_cached_engine, jit_engine
+};
+static const char *engine_names[NUM_ENGINES] = {
+    "traced", "threaded", "tos", "jit"
+};
+
+// A program being built: its header, text, and the one word of
+// global data (the loop counter), with the number of instructions
+// a run of it executes
+typedef struct {
+    BOFHeader header;
+    bin_instr_t text[MAX_TEXT];
+    word_type counter;
+    address_type length;
+    unsigned long executed;
+} program_t;
+
+// A result of the benchmark: the time per instruction (in nanoseconds)
+// of a class of instructions in an engine
+typedef struct {
+    char class_name[32];
+    char engine_name[32];
+    double ns_per_instr;
+} result_t;
+
+/* Print a usage message on stderr and exit with exit code 1. */
+static void usage(const char *cmdname)
+{
+    bail_with_error(
+		    "Usage: %s [-e engine] [-n iterations] [-r repeats] [-w file | -c file [-x percent]]\n%s\n%s\n%s\n%s\n%s\n%s",
+		    cmdname,
+		    "where engine is the only one run: threaded, tos, jit, or traced,",
+		    "iterations is how often each program's loop runs (default: 200000),",
+		    "repeats is how often each program is run (default: 5; the fastest counts),",
+		    "-w writes the results to file (as a baseline),",
+		    "-c compares the results with the baseline in file, and exits with 1",
+		    "if any is slower than it by more than percent (default: 10)");
+}
+
+// Return the time, in seconds, from some fixed point in the past
+static double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Add the instruction bi to the end of the text of p
+static void emit(program_t *p, bin_instr_t bi)
+{
+    if (p->length >= MAX_TEXT) {
+	bail_with_error("A benchmark program is too long!");
+    }
+    p->text[p->length++] = bi;
+}
+
+// Add a computational instruction (with function code func) to p
+static void emit_comp(program_t *p, func_type func, reg_num_type rt,
+		      offset_type ot, reg_num_type rs, offset_type os)
+{
+    bin_instr_t bi;
+    bi.comp = (comp_instr_t) {COMP_O, rt, ot, rs, os, func};
+    emit(p, bi);
+}
+
+// Add an other computational instruction (with function code func) to p
+static void emit_othc(program_t *p, func_type func, reg_num_type reg,
+		      offset_type offset, arg_type arg)
+{
+    bin_instr_t bi;
+    bi.othc = (other_comp_instr_t) {OTHC_O, reg, offset, arg, func};
+    emit(p, bi);
+}
+
+// Add a system call (with the given code) to p
+static void emit_syscall(program_t *p, syscall_type code, reg_num_type reg,
+			 offset_type offset)
+{
+    bin_instr_t bi;
+    bi.syscall = (syscall_instr_t) {OTHC_O, reg, offset, code, SYS_F};
+    emit(p, bi);
+}
+
+// Add an immediate instruction (with opcode op) to p
+static void emit_immed(program_t *p, op_code op, reg_num_type reg,
+		       offset_type offset, immediate_type immed)
+{
+    bin_instr_t bi;
+    bi.immed = (immed_instr_t) {op, reg, offset, immed};
+    emit(p, bi);
+}
+
+// Add a jump instruction (with opcode op) to p
+static void emit_jump(program_t *p, op_code op, address_type addr)
+{
+    bin_instr_t bi;
+    bi.jump = (jump_instr_t) {op, addr};
+    emit(p, bi);
+}
+
+// Add one group of the instructions of class c to p,
+// returning how many instructions running it executes
+static unsigned int emit_group(program_t *p, bench_class c)
+{
+    address_type start = p->length;
+    switch (c) {
+    case comp_class:
+	emit_comp(p, NOP_F, 0, 0, 0, 0);
+	emit_comp(p, ADD_F, SP, -3, SP, -1);
+	emit_comp(p, SUB_F, SP, -4, SP, -2);
+	emit_comp(p, CPW_F, SP, -5, SP, -1);
+	emit_comp(p, AND_F, SP, -3, SP, -2);
+	emit_comp(p, BOR_F, SP, -4, SP, -1);
+	emit_comp(p, NOR_F, SP, -5, SP, -2);
+	emit_comp(p, XOR_F, SP, -3, SP, -1);
+	emit_comp(p, LWR_F, 3, 0, SP, -1);
+	emit_comp(p, SWR_F, SP, -6, 3, 0);
+	emit_comp(p, CPR_F, 4, 0, 3, 0);
+	emit_comp(p, SCA_F, SP, -7, SP, -1);
+	emit_comp(p, NEG_F, SP, -4, SP, -2);
+	break;
+    case other_comp_class:
+	emit_othc(p, LIT_F, SP, -3, 5);
+	emit_othc(p, ARI_F, 5, 0, 3);
+	emit_othc(p, SRI_F, 5, 0, 3);
+	emit_othc(p, MUL_F, SP, -1, 0);
+	emit_othc(p, DIV_F, SP, -2, 0);
+	emit_othc(p, CFHI_F, SP, -3, 0);
+	emit_othc(p, CFLO_F, SP, -4, 0);
+	emit_othc(p, SLL_F, SP, -5, 2);
+	emit_othc(p, SRL_F, SP, -5, 1);
+	break;
+    case immed_class:
+	emit_immed(p, ADDI_O, SP, -3, 1);
+	emit_immed(p, ANDI_O, SP, -4, 0xff);
+	emit_immed(p, BORI_O, SP, -4, 0x10);
+	emit_immed(p, NORI_O, SP, -5, 0);
+	emit_immed(p, XORI_O, SP, -5, 0x55);
+	break;
+    case branch_class:
+	// each goes to the next instruction, whether taken or not
+	emit_immed(p, BEQ_O, SP, 0, 1);
+	emit_immed(p, BNE_O, SP, -1, 1);
+	emit_immed(p, BGEZ_O, SP, -1, 1);
+	emit_immed(p, BGTZ_O, SP, -8, 1);
+	emit_immed(p, BLEZ_O, SP, -8, 1);
+	emit_immed(p, BLTZ_O, SP, -1, 1);
+	break;
+    case jump_class:
+	// the procedure (at address 1) just returns
+	emit_jump(p, CALL_O, 1);
+	emit_jump(p, JMPA_O, p->length + 1);
+	emit_othc(p, JREL_F, 0, 0, 1);
+	return 4;
+    case syscall_class:
+	// the output is discarded
+	emit_syscall(p, print_char_sc, SP, -1);
+	emit_syscall(p, print_int_sc, SP, -1);
+	break;
+    default:
+	bail_with_error("Bad benchmark class (%d)!", c);
+    }
+    return p->length - start;
+}
+
+// Build the program for the class c into p, whose loop runs
+// iterations times
+static void build_program(program_t *p, bench_class c,
+			  unsigned long iterations)
+{
+    memset(p, 0, sizeof(*p));
+    // a jump over the procedure called by the jump class, which returns
+    emit_jump(p, JMPA_O, 2);
+    emit(p, (bin_instr_t) {.jump = (jump_instr_t) {RTN_O, 0}});
+    // the operands (the instructions use the words from SP-8 to SP)
+    emit_othc(p, LIT_F, SP, 0, 100);
+    emit_othc(p, LIT_F, SP, -1, 7);
+    emit_othc(p, LIT_F, SP, -2, 3);
+    emit_othc(p, LIT_F, SP, -8, 0);
+    p->executed = 5;
+
+    // the loop, which counts down the global data word
+    address_type loop = p->length;
+    unsigned int per_iteration = 2;
+    for (int i = 0; i < GROUP_REPEATS; i++) {
+	per_iteration += emit_group(p, c);
+    }
+    emit_immed(p, ADDI_O, GP, 0, -1);
+    emit_immed(p, BGTZ_O, GP, 0, (immediate_type) loop - p->length);
+    emit_syscall(p, exit_sc, 0, 0);
+    p->executed += iterations * per_iteration + 1;
+
+    p->counter = (word_type) iterations;
+    bof_write_magic_to_header(&p->header);
+    p->header.text_start_address = 0;
+    p->header.text_length = p->length;
+    p->header.data_start_address = DATA_START;
+    p->header.data_length = 1;
+    p->header.stack_bottom_addr = STACK_BOTTOM;
+}
+
+// Load the program p into m (as a binary object file would be loaded),
+// exiting with an error message if that fails
+static void load(machine_t *m, const program_t *p)
+{
+    static unsigned char bytes[sizeof(BOFHeader)
+			       + (MAX_TEXT + 1) * BYTES_PER_WORD];
+    size_t text_bytes = p->length * BYTES_PER_WORD;
+    memcpy(bytes, &p->header, sizeof(BOFHeader));
+    memcpy(bytes + sizeof(BOFHeader), p->text, text_bytes);
+    memcpy(bytes + sizeof(BOFHeader) + text_bytes, &p->counter,
+	   BYTES_PER_WORD);
+    if (!machine_load_bytes(m, bytes,
+			    sizeof(BOFHeader) + text_bytes + BYTES_PER_WORD)) {
+	bail_with_error("Cannot load the benchmark program!");
+    }
+}
+
+// Check that running the program p in m executes p->executed
+// instructions, exiting with an error message if not
+static void check_executed(machine_t *m, const program_t *p,
+			   const char *class_name)
+{
+    load(m, p);
+    if (machine_run_steps(m, p->executed - 1) != machine_stepping
+	|| machine_run_steps(m, 1) != machine_exited) {
+	bail_with_error("The %s benchmark does not execute %lu instructions!",
+			class_name, p->executed);
+    }
+}
+
+// Return the fastest time (in seconds) of repeats runs of the program p
+// in m, exiting with an error message if one fails
+static double time_runs(machine_t *m, const program_t *p, int repeats)
+{
+    double best = 0;
+    for (int i = 0; i < repeats; i++) {
+	load(m, p);
+	double start = now();
+	int exit_code = machine_run(m, false);
+	double seconds = now() - start;
+	if (exit_code != EXIT_SUCCESS) {
+	    bail_with_error("A benchmark program failed (exit code %d)!",
+			    exit_code);
+	}
+	if (i == 0 || seconds < best) {
+	    best = seconds;
+	}
+    }
+    return best;
+}
+
+// Read the results in the baseline file named filename into results
+// (which has room for max of them), returning how many were read
+static int read_baseline(const char *filename, result_t *results, int max)
+{
+    FILE *f = fopen(filename, "r");
+    if (f == NULL) {
+	bail_with_error("Cannot open baseline file %s!", filename);
+    }
+    int count = 0;
+    while (count < max
+	   && fscanf(f, "%31s %31s %lf", results[count].class_name,
+		     results[count].engine_name,
+		     &results[count].ns_per_instr) == 3) {
+	count++;
+    }
+    fclose(f);
+    return count;
+}
+
+// Return the result for the given class and engine in the count
+// results, or NULL if there is none
+static const result_t *find_result(const result_t *results, int count,
+				   const char *class_name,
+				   const char *engine_name)
+{
+    for (int i = 0; i < count; i++) {
+	if (strcmp(results[i].class_name, class_name) == 0
+	    && strcmp(results[i].engine_name, engine_name) == 0) {
+	    return &results[i];
+	}
+    }
+    return NULL;
+}
+
+// Run the benchmark programs with the engines chosen on the command line,
+// printing their throughputs on stdout
+int main(int argc, char *argv[])
+{
+    const char *cmdname = argv[0];
+    argc--;
+    argv++;
+
+    int engine_choice = -1;
+    unsigned long iterations = DEFAULT_ITERATIONS;
+    int repeats = DEFAULT_REPEATS;
+    const char *write_name = NULL;
+    const char *compare_name = NULL;
+    double threshold = DEFAULT_THRESHOLD;
+    while (argc > 0) {
+	if (argc < 2 || argv[0][0] != '-') {
+	    usage(cmdname);
+	} else if (strcmp(argv[0], "-e") == 0) {
+	    for (int e = 0; e < NUM_ENGINES; e++) {
+		if (strcmp(argv[1], engine_names[e]) == 0) {
+		    engine_choice = e;
+		}
+	    }
+	    if (engine_choice < 0) {
+		usage(cmdname);
+	    }
+	} else if (strcmp(argv[0], "-n") == 0) {
+	    long n = atol(argv[1]);
+	    if (n < 1 || n > 0x7fffffff) {
+		usage(cmdname);
+	    }
+	    iterations = n;
+	} else if (strcmp(argv[0], "-r") == 0) {
+	    repeats = atoi(argv[1]);
+	    if (repeats < 1) {
+		usage(cmdname);
+	    }
+	} else if (strcmp(argv[0], "-w") == 0) {
+	    write_name = argv[1];
+	} else if (strcmp(argv[0], "-c") == 0) {
+	    compare_name = argv[1];
+	} else if (strcmp(argv[0], "-x") == 0) {
+	    threshold = atof(argv[1]);
+	    if (threshold <= 0) {
+		usage(cmdname);
+	    }
+	} else {
+	    usage(cmdname);
+	}
+	argc -= 2;
+	argv += 2;
+    }
+    if (write_name != NULL && compare_name != NULL) {
+	usage(cmdname);
+    }
+
+    result_t baseline[NUM_CLASSES * NUM_ENGINES];
+    int baseline_count = 0;
+    if (compare_name != NULL) {
+	baseline_count = read_baseline(compare_name, baseline,
+				       NUM_CLASSES * NUM_ENGINES);
+    }
+    FILE *baseline_out = NULL;
+    if (write_name != NULL) {
+	baseline_out = fopen(write_name, "w");
+	if (baseline_out == NULL) {
+	    bail_with_error("Cannot open baseline file %s for writing!",
+			    write_name);
+	}
+    }
+
+    machine_t *m = machine_create();
+    // the programs read nothing, and their output is discarded
+    FILE *in = tmpfile();
+    FILE *out = fopen("/dev/null", "w");
+    if (in == NULL || out == NULL) {
+	bail_with_error("Cannot open the programs' input and output!");
+    }
+    machine_set_streams(m, in, out, out);
+
+    printf("%lu iterations, fastest of %d runs:\n", iterations, repeats);
+    printf("%-14s %-9s %10s %10s", "Class", "Engine", "MIPS", "ns/instr");
+    if (compare_name != NULL) {
+	printf(" %10s %8s", "baseline", "change");
+    }
+    newline(stdout);
+    int regressions = 0;
+    program_t p;
+    for (bench_class c = 0; c < NUM_CLASSES; c++) {
+	build_program(&p, c, iterations);
+	machine_set_engine(m, threaded_engine);
+	check_executed(m, &p, class_names[c]);
+	for (int e = 0; e < NUM_ENGINES; e++) {
+	    if (engine_choice >= 0 && e != engine_choice) {
+		continue;
+	    }
+	    machine_set_engine(m, engines[e]);
+	    double seconds = time_runs(m, &p, repeats);
+	    double ns = seconds * 1e9 / p.executed;
+	    printf("%-14s %-9s %10.1f %10.3f", class_names[c],
+		   engine_names[e], p.executed / seconds / 1e6, ns);
+	    if (compare_name != NULL) {
+		const result_t *r = find_result(baseline, baseline_count,
+						class_names[c], engine_names[e]);
+		if (r == NULL) {
+		    printf(" %10s", "none");
+		} else {
+		    double change = 100.0 * (ns - r->ns_per_instr)
+			/ r->ns_per_instr;
+		    printf(" %10.3f %+7.1f%%", r->ns_per_instr, change);
+		    if (change > threshold) {
+			printf("  SLOWER");
+			regressions++;
+		    }
+		}
+	    }
+	    newline(stdout);
+	    if (baseline_out != NULL) {
+		fprintf(baseline_out, "%s %s %.6f\n", class_names[c],
+			engine_names[e], ns);
+	    }
+	}
+    }
+
+    if (baseline_out != NULL && fclose(baseline_out) != 0) {
+	bail_with_error("Cannot write baseline file %s!", write_name);
+    }
+    machine_destroy(m);
+    fclose(in);
+    fclose(out);
+    if (regressions > 0) {
+	printf("%d result(s) more than %.1f%% slower than the baseline\n",
+	       regressions, threshold);
+	return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
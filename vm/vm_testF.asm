@@ -0,0 +1,69 @@
+	# $Id$
+	# exercises the code sequences that the VM fuses into superinstructions
+	# (when not tracing), including stores into the program's own text
+	.text start
+start:	NOTR
+	CPR $r3, $fp         # set up an activation record, as the compiler does
+	SWR $sp, -1, $sp
+	SWR $sp, -2, $fp
+	SWR $sp, -3, $r3
+	SWR $sp, -4, $ra
+	CPR $fp, $sp
+	SRI $sp, 4
+	SWR $fp, -3, $fp
+	SRI $sp, 1
+	CPW $sp, 0, $gp, 0   # push the loop counter (10)
+	CPR $r3, $fp
+	CALL p
+	ADDI $sp, 0, -1
+	BGTZ $sp, 0, -3
+	ARI $sp, 1
+	LWR $r4, $gp, 2      # $r4 is 0
+patch:	SRI $sp, 1           # first push 7, then (after patching) push 9
+	LIT $sp, 0, 7
+	BEQ $gp, 5, 3        # done if the top of stack is 9
+	CPW $r4, 18, $gp, 3  # make the LIT above be LIT $sp, 0, 9
+	JMPA patch
+	PINT $sp, 0
+	CPW $r4, 24, $gp, 4  # change the ARI below into ARI $sp, 2
+	ARI $sp, 1
+	STRA
+	PINT $gp, 1
+	EXIT 0
+p:	SWR $sp, -1, $sp     # procedure p adds 5 to the global at $gp+1
+	SWR $sp, -2, $fp
+	SWR $sp, -3, $r3
+	SWR $sp, -4, $ra
+	CPR $fp, $sp
+	SRI $sp, 4
+	SRI $sp, 1
+	LIT $sp, 0, 5
+	SRI $sp, 1
+	CPW $sp, 0, $gp, 1
+	ADD $sp, 1, $sp, 1
+	ARI $sp, 1
+	CPW $gp, 1, $sp, 0
+	ARI $sp, 1
+	SRI $sp, 1
+	LIT $sp, 0, 3
+	SRI $sp, 1
+	LIT $sp, 0, 1
+	SUB $sp, 1, $sp, 0
+	ARI $sp, 1
+	ARI $sp, 1
+	CPR $r6, $fp
+	LWR $r6, $r6, -3
+	LWR $ra, $fp, -4
+	LWR $r3, $fp, -1
+	LWR $fp, $fp, -2
+	CPR $sp, $r3
+	RTN
+	.data 1024
+	WORD count = 10
+	WORD sum = 0
+	WORD zero = 0
+	WORD lit9 = 269025297
+	WORD ari2 = 537002001
+	WORD nine = 9
+	.stack 4096
+	.end
@@ -0,0 +1,25 @@
+	# $Id$
+	# sums the squares of 1 to count, calling square for each
+	# (assembled in version 2 of the BOF format, see the Makefile)
+	.text main
+main:	SRI $sp, 1             # allocate a word for i on the stack
+	CPW $sp, 0, $gp, 0     # i = count
+loop:	CALL square            # sum = sum + i * i
+	ADDI $sp, 0, -1        # i = i - 1
+	BGTZ $sp, 0, -2        # repeat while i > 0
+	PINT $gp, 1            # print sum (14)
+	EXIT 0
+
+	# square adds the square of the stack top to sum
+square:	MUL $sp, 0             # LO = i * i
+	SRI $sp, 1
+	CFLO $sp, 0            # push LO
+	ADD $gp, 1, $gp, 1     # sum = LO + sum
+	ARI $sp, 1             # pop LO
+	RTN
+
+	.data 1024
+	WORD count = 3
+	WORD sum
+	.stack 4096
+	.end
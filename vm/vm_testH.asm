@@ -0,0 +1,20 @@
+	# $Id$
+	# prints a line several times; its text and data repeat, so they
+	# compress well (assembled with compression, see the Makefile)
+	.text start
+start:	NOTR
+	PSTR $gp, 0
+	PSTR $gp, 0
+	PSTR $gp, 0
+	PSTR $gp, 0
+	PSTR $gp, 0
+	PSTR $gp, 0
+	PSTR $gp, 0
+	PSTR $gp, 0
+	STRA
+	EXIT 0
+	.data 512
+	STRING[4] line = "compressed\n"
+	STRING[64] blank = ""
+	.stack 4096
+	.end
@@ -0,0 +1,2007 @@
+	# generated by make (see the Makefile)
+	.text start
+start:	JMPA l1996
+l1:	NOP
+l2:	NOP
+l3:	NOP
+l4:	NOP
+l5:	NOP
+l6:	NOP
+l7:	NOP
+l8:	NOP
+l9:	NOP
+l10:	NOP
+l11:	NOP
+l12:	NOP
+l13:	NOP
+l14:	NOP
+l15:	NOP
+l16:	NOP
+l17:	NOP
+l18:	NOP
+l19:	NOP
+l20:	NOP
+l21:	NOP
+l22:	NOP
+l23:	NOP
+l24:	NOP
+l25:	NOP
+l26:	NOP
+l27:	NOP
+l28:	NOP
+l29:	NOP
+l30:	NOP
+l31:	NOP
+l32:	NOP
+l33:	NOP
+l34:	NOP
+l35:	NOP
+l36:	NOP
+l37:	NOP
+l38:	NOP
+l39:	NOP
+l40:	NOP
+l41:	NOP
+l42:	NOP
+l43:	NOP
+l44:	NOP
+l45:	NOP
+l46:	NOP
+l47:	NOP
+l48:	NOP
+l49:	NOP
+l50:	NOP
+l51:	NOP
+l52:	NOP
+l53:	NOP
+l54:	NOP
+l55:	NOP
+l56:	NOP
+l57:	NOP
+l58:	NOP
+l59:	NOP
+l60:	NOP
+l61:	NOP
+l62:	NOP
+l63:	NOP
+l64:	NOP
+l65:	NOP
+l66:	NOP
+l67:	NOP
+l68:	NOP
+l69:	NOP
+l70:	NOP
+l71:	NOP
+l72:	NOP
+l73:	NOP
+l74:	NOP
+l75:	NOP
+l76:	NOP
+l77:	NOP
+l78:	NOP
+l79:	NOP
+l80:	NOP
+l81:	NOP
+l82:	NOP
+l83:	NOP
+l84:	NOP
+l85:	NOP
+l86:	NOP
+l87:	NOP
+l88:	NOP
+l89:	NOP
+l90:	NOP
+l91:	NOP
+l92:	NOP
+l93:	NOP
+l94:	NOP
+l95:	NOP
+l96:	NOP
+l97:	NOP
+l98:	NOP
+l99:	NOP
+l100:	NOP
+l101:	NOP
+l102:	NOP
+l103:	NOP
+l104:	NOP
+l105:	NOP
+l106:	NOP
+l107:	NOP
+l108:	NOP
+l109:	NOP
+l110:	NOP
+l111:	NOP
+l112:	NOP
+l113:	NOP
+l114:	NOP
+l115:	NOP
+l116:	NOP
+l117:	NOP
+l118:	NOP
+l119:	NOP
+l120:	NOP
+l121:	NOP
+l122:	NOP
+l123:	NOP
+l124:	NOP
+l125:	NOP
+l126:	NOP
+l127:	NOP
+l128:	NOP
+l129:	NOP
+l130:	NOP
+l131:	NOP
+l132:	NOP
+l133:	NOP
+l134:	NOP
+l135:	NOP
+l136:	NOP
+l137:	NOP
+l138:	NOP
+l139:	NOP
+l140:	NOP
+l141:	NOP
+l142:	NOP
+l143:	NOP
+l144:	NOP
+l145:	NOP
+l146:	NOP
+l147:	NOP
+l148:	NOP
+l149:	NOP
+l150:	NOP
+l151:	NOP
+l152:	NOP
+l153:	NOP
+l154:	NOP
+l155:	NOP
+l156:	NOP
+l157:	NOP
+l158:	NOP
+l159:	NOP
+l160:	NOP
+l161:	NOP
+l162:	NOP
+l163:	NOP
+l164:	NOP
+l165:	NOP
+l166:	NOP
+l167:	NOP
+l168:	NOP
+l169:	NOP
+l170:	NOP
+l171:	NOP
+l172:	NOP
+l173:	NOP
+l174:	NOP
+l175:	NOP
+l176:	NOP
+l177:	NOP
+l178:	NOP
+l179:	NOP
+l180:	NOP
+l181:	NOP
+l182:	NOP
+l183:	NOP
+l184:	NOP
+l185:	NOP
+l186:	NOP
+l187:	NOP
+l188:	NOP
+l189:	NOP
+l190:	NOP
+l191:	NOP
+l192:	NOP
+l193:	NOP
+l194:	NOP
+l195:	NOP
+l196:	NOP
+l197:	NOP
+l198:	NOP
+l199:	NOP
+l200:	NOP
+l201:	NOP
+l202:	NOP
+l203:	NOP
+l204:	NOP
+l205:	NOP
+l206:	NOP
+l207:	NOP
+l208:	NOP
+l209:	NOP
+l210:	NOP
+l211:	NOP
+l212:	NOP
+l213:	NOP
+l214:	NOP
+l215:	NOP
+l216:	NOP
+l217:	NOP
+l218:	NOP
+l219:	NOP
+l220:	NOP
+l221:	NOP
+l222:	NOP
+l223:	NOP
+l224:	NOP
+l225:	NOP
+l226:	NOP
+l227:	NOP
+l228:	NOP
+l229:	NOP
+l230:	NOP
+l231:	NOP
+l232:	NOP
+l233:	NOP
+l234:	NOP
+l235:	NOP
+l236:	NOP
+l237:	NOP
+l238:	NOP
+l239:	NOP
+l240:	NOP
+l241:	NOP
+l242:	NOP
+l243:	NOP
+l244:	NOP
+l245:	NOP
+l246:	NOP
+l247:	NOP
+l248:	NOP
+l249:	NOP
+l250:	NOP
+l251:	NOP
+l252:	NOP
+l253:	NOP
+l254:	NOP
+l255:	NOP
+l256:	NOP
+l257:	NOP
+l258:	NOP
+l259:	NOP
+l260:	NOP
+l261:	NOP
+l262:	NOP
+l263:	NOP
+l264:	NOP
+l265:	NOP
+l266:	NOP
+l267:	NOP
+l268:	NOP
+l269:	NOP
+l270:	NOP
+l271:	NOP
+l272:	NOP
+l273:	NOP
+l274:	NOP
+l275:	NOP
+l276:	NOP
+l277:	NOP
+l278:	NOP
+l279:	NOP
+l280:	NOP
+l281:	NOP
+l282:	NOP
+l283:	NOP
+l284:	NOP
+l285:	NOP
+l286:	NOP
+l287:	NOP
+l288:	NOP
+l289:	NOP
+l290:	NOP
+l291:	NOP
+l292:	NOP
+l293:	NOP
+l294:	NOP
+l295:	NOP
+l296:	NOP
+l297:	NOP
+l298:	NOP
+l299:	NOP
+l300:	NOP
+l301:	NOP
+l302:	NOP
+l303:	NOP
+l304:	NOP
+l305:	NOP
+l306:	NOP
+l307:	NOP
+l308:	NOP
+l309:	NOP
+l310:	NOP
+l311:	NOP
+l312:	NOP
+l313:	NOP
+l314:	NOP
+l315:	NOP
+l316:	NOP
+l317:	NOP
+l318:	NOP
+l319:	NOP
+l320:	NOP
+l321:	NOP
+l322:	NOP
+l323:	NOP
+l324:	NOP
+l325:	NOP
+l326:	NOP
+l327:	NOP
+l328:	NOP
+l329:	NOP
+l330:	NOP
+l331:	NOP
+l332:	NOP
+l333:	NOP
+l334:	NOP
+l335:	NOP
+l336:	NOP
+l337:	NOP
+l338:	NOP
+l339:	NOP
+l340:	NOP
+l341:	NOP
+l342:	NOP
+l343:	NOP
+l344:	NOP
+l345:	NOP
+l346:	NOP
+l347:	NOP
+l348:	NOP
+l349:	NOP
+l350:	NOP
+l351:	NOP
+l352:	NOP
+l353:	NOP
+l354:	NOP
+l355:	NOP
+l356:	NOP
+l357:	NOP
+l358:	NOP
+l359:	NOP
+l360:	NOP
+l361:	NOP
+l362:	NOP
+l363:	NOP
+l364:	NOP
+l365:	NOP
+l366:	NOP
+l367:	NOP
+l368:	NOP
+l369:	NOP
+l370:	NOP
+l371:	NOP
+l372:	NOP
+l373:	NOP
+l374:	NOP
+l375:	NOP
+l376:	NOP
+l377:	NOP
+l378:	NOP
+l379:	NOP
+l380:	NOP
+l381:	NOP
+l382:	NOP
+l383:	NOP
+l384:	NOP
+l385:	NOP
+l386:	NOP
+l387:	NOP
+l388:	NOP
+l389:	NOP
+l390:	NOP
+l391:	NOP
+l392:	NOP
+l393:	NOP
+l394:	NOP
+l395:	NOP
+l396:	NOP
+l397:	NOP
+l398:	NOP
+l399:	NOP
+l400:	NOP
+l401:	NOP
+l402:	NOP
+l403:	NOP
+l404:	NOP
+l405:	NOP
+l406:	NOP
+l407:	NOP
+l408:	NOP
+l409:	NOP
+l410:	NOP
+l411:	NOP
+l412:	NOP
+l413:	NOP
+l414:	NOP
+l415:	NOP
+l416:	NOP
+l417:	NOP
+l418:	NOP
+l419:	NOP
+l420:	NOP
+l421:	NOP
+l422:	NOP
+l423:	NOP
+l424:	NOP
+l425:	NOP
+l426:	NOP
+l427:	NOP
+l428:	NOP
+l429:	NOP
+l430:	NOP
+l431:	NOP
+l432:	NOP
+l433:	NOP
+l434:	NOP
+l435:	NOP
+l436:	NOP
+l437:	NOP
+l438:	NOP
+l439:	NOP
+l440:	NOP
+l441:	NOP
+l442:	NOP
+l443:	NOP
+l444:	NOP
+l445:	NOP
+l446:	NOP
+l447:	NOP
+l448:	NOP
+l449:	NOP
+l450:	NOP
+l451:	NOP
+l452:	NOP
+l453:	NOP
+l454:	NOP
+l455:	NOP
+l456:	NOP
+l457:	NOP
+l458:	NOP
+l459:	NOP
+l460:	NOP
+l461:	NOP
+l462:	NOP
+l463:	NOP
+l464:	NOP
+l465:	NOP
+l466:	NOP
+l467:	NOP
+l468:	NOP
+l469:	NOP
+l470:	NOP
+l471:	NOP
+l472:	NOP
+l473:	NOP
+l474:	NOP
+l475:	NOP
+l476:	NOP
+l477:	NOP
+l478:	NOP
+l479:	NOP
+l480:	NOP
+l481:	NOP
+l482:	NOP
+l483:	NOP
+l484:	NOP
+l485:	NOP
+l486:	NOP
+l487:	NOP
+l488:	NOP
+l489:	NOP
+l490:	NOP
+l491:	NOP
+l492:	NOP
+l493:	NOP
+l494:	NOP
+l495:	NOP
+l496:	NOP
+l497:	NOP
+l498:	NOP
+l499:	NOP
+l500:	NOP
+l501:	NOP
+l502:	NOP
+l503:	NOP
+l504:	NOP
+l505:	NOP
+l506:	NOP
+l507:	NOP
+l508:	NOP
+l509:	NOP
+l510:	NOP
+l511:	NOP
+l512:	NOP
+l513:	NOP
+l514:	NOP
+l515:	NOP
+l516:	NOP
+l517:	NOP
+l518:	NOP
+l519:	NOP
+l520:	NOP
+l521:	NOP
+l522:	NOP
+l523:	NOP
+l524:	NOP
+l525:	NOP
+l526:	NOP
+l527:	NOP
+l528:	NOP
+l529:	NOP
+l530:	NOP
+l531:	NOP
+l532:	NOP
+l533:	NOP
+l534:	NOP
+l535:	NOP
+l536:	NOP
+l537:	NOP
+l538:	NOP
+l539:	NOP
+l540:	NOP
+l541:	NOP
+l542:	NOP
+l543:	NOP
+l544:	NOP
+l545:	NOP
+l546:	NOP
+l547:	NOP
+l548:	NOP
+l549:	NOP
+l550:	NOP
+l551:	NOP
+l552:	NOP
+l553:	NOP
+l554:	NOP
+l555:	NOP
+l556:	NOP
+l557:	NOP
+l558:	NOP
+l559:	NOP
+l560:	NOP
+l561:	NOP
+l562:	NOP
+l563:	NOP
+l564:	NOP
+l565:	NOP
+l566:	NOP
+l567:	NOP
+l568:	NOP
+l569:	NOP
+l570:	NOP
+l571:	NOP
+l572:	NOP
+l573:	NOP
+l574:	NOP
+l575:	NOP
+l576:	NOP
+l577:	NOP
+l578:	NOP
+l579:	NOP
+l580:	NOP
+l581:	NOP
+l582:	NOP
+l583:	NOP
+l584:	NOP
+l585:	NOP
+l586:	NOP
+l587:	NOP
+l588:	NOP
+l589:	NOP
+l590:	NOP
+l591:	NOP
+l592:	NOP
+l593:	NOP
+l594:	NOP
+l595:	NOP
+l596:	NOP
+l597:	NOP
+l598:	NOP
+l599:	NOP
+l600:	NOP
+l601:	NOP
+l602:	NOP
+l603:	NOP
+l604:	NOP
+l605:	NOP
+l606:	NOP
+l607:	NOP
+l608:	NOP
+l609:	NOP
+l610:	NOP
+l611:	NOP
+l612:	NOP
+l613:	NOP
+l614:	NOP
+l615:	NOP
+l616:	NOP
+l617:	NOP
+l618:	NOP
+l619:	NOP
+l620:	NOP
+l621:	NOP
+l622:	NOP
+l623:	NOP
+l624:	NOP
+l625:	NOP
+l626:	NOP
+l627:	NOP
+l628:	NOP
+l629:	NOP
+l630:	NOP
+l631:	NOP
+l632:	NOP
+l633:	NOP
+l634:	NOP
+l635:	NOP
+l636:	NOP
+l637:	NOP
+l638:	NOP
+l639:	NOP
+l640:	NOP
+l641:	NOP
+l642:	NOP
+l643:	NOP
+l644:	NOP
+l645:	NOP
+l646:	NOP
+l647:	NOP
+l648:	NOP
+l649:	NOP
+l650:	NOP
+l651:	NOP
+l652:	NOP
+l653:	NOP
+l654:	NOP
+l655:	NOP
+l656:	NOP
+l657:	NOP
+l658:	NOP
+l659:	NOP
+l660:	NOP
+l661:	NOP
+l662:	NOP
+l663:	NOP
+l664:	NOP
+l665:	NOP
+l666:	NOP
+l667:	NOP
+l668:	NOP
+l669:	NOP
+l670:	NOP
+l671:	NOP
+l672:	NOP
+l673:	NOP
+l674:	NOP
+l675:	NOP
+l676:	NOP
+l677:	NOP
+l678:	NOP
+l679:	NOP
+l680:	NOP
+l681:	NOP
+l682:	NOP
+l683:	NOP
+l684:	NOP
+l685:	NOP
+l686:	NOP
+l687:	NOP
+l688:	NOP
+l689:	NOP
+l690:	NOP
+l691:	NOP
+l692:	NOP
+l693:	NOP
+l694:	NOP
+l695:	NOP
+l696:	NOP
+l697:	NOP
+l698:	NOP
+l699:	NOP
+l700:	NOP
+l701:	NOP
+l702:	NOP
+l703:	NOP
+l704:	NOP
+l705:	NOP
+l706:	NOP
+l707:	NOP
+l708:	NOP
+l709:	NOP
+l710:	NOP
+l711:	NOP
+l712:	NOP
+l713:	NOP
+l714:	NOP
+l715:	NOP
+l716:	NOP
+l717:	NOP
+l718:	NOP
+l719:	NOP
+l720:	NOP
+l721:	NOP
+l722:	NOP
+l723:	NOP
+l724:	NOP
+l725:	NOP
+l726:	NOP
+l727:	NOP
+l728:	NOP
+l729:	NOP
+l730:	NOP
+l731:	NOP
+l732:	NOP
+l733:	NOP
+l734:	NOP
+l735:	NOP
+l736:	NOP
+l737:	NOP
+l738:	NOP
+l739:	NOP
+l740:	NOP
+l741:	NOP
+l742:	NOP
+l743:	NOP
+l744:	NOP
+l745:	NOP
+l746:	NOP
+l747:	NOP
+l748:	NOP
+l749:	NOP
+l750:	NOP
+l751:	NOP
+l752:	NOP
+l753:	NOP
+l754:	NOP
+l755:	NOP
+l756:	NOP
+l757:	NOP
+l758:	NOP
+l759:	NOP
+l760:	NOP
+l761:	NOP
+l762:	NOP
+l763:	NOP
+l764:	NOP
+l765:	NOP
+l766:	NOP
+l767:	NOP
+l768:	NOP
+l769:	NOP
+l770:	NOP
+l771:	NOP
+l772:	NOP
+l773:	NOP
+l774:	NOP
+l775:	NOP
+l776:	NOP
+l777:	NOP
+l778:	NOP
+l779:	NOP
+l780:	NOP
+l781:	NOP
+l782:	NOP
+l783:	NOP
+l784:	NOP
+l785:	NOP
+l786:	NOP
+l787:	NOP
+l788:	NOP
+l789:	NOP
+l790:	NOP
+l791:	NOP
+l792:	NOP
+l793:	NOP
+l794:	NOP
+l795:	NOP
+l796:	NOP
+l797:	NOP
+l798:	NOP
+l799:	NOP
+l800:	NOP
+l801:	NOP
+l802:	NOP
+l803:	NOP
+l804:	NOP
+l805:	NOP
+l806:	NOP
+l807:	NOP
+l808:	NOP
+l809:	NOP
+l810:	NOP
+l811:	NOP
+l812:	NOP
+l813:	NOP
+l814:	NOP
+l815:	NOP
+l816:	NOP
+l817:	NOP
+l818:	NOP
+l819:	NOP
+l820:	NOP
+l821:	NOP
+l822:	NOP
+l823:	NOP
+l824:	NOP
+l825:	NOP
+l826:	NOP
+l827:	NOP
+l828:	NOP
+l829:	NOP
+l830:	NOP
+l831:	NOP
+l832:	NOP
+l833:	NOP
+l834:	NOP
+l835:	NOP
+l836:	NOP
+l837:	NOP
+l838:	NOP
+l839:	NOP
+l840:	NOP
+l841:	NOP
+l842:	NOP
+l843:	NOP
+l844:	NOP
+l845:	NOP
+l846:	NOP
+l847:	NOP
+l848:	NOP
+l849:	NOP
+l850:	NOP
+l851:	NOP
+l852:	NOP
+l853:	NOP
+l854:	NOP
+l855:	NOP
+l856:	NOP
+l857:	NOP
+l858:	NOP
+l859:	NOP
+l860:	NOP
+l861:	NOP
+l862:	NOP
+l863:	NOP
+l864:	NOP
+l865:	NOP
+l866:	NOP
+l867:	NOP
+l868:	NOP
+l869:	NOP
+l870:	NOP
+l871:	NOP
+l872:	NOP
+l873:	NOP
+l874:	NOP
+l875:	NOP
+l876:	NOP
+l877:	NOP
+l878:	NOP
+l879:	NOP
+l880:	NOP
+l881:	NOP
+l882:	NOP
+l883:	NOP
+l884:	NOP
+l885:	NOP
+l886:	NOP
+l887:	NOP
+l888:	NOP
+l889:	NOP
+l890:	NOP
+l891:	NOP
+l892:	NOP
+l893:	NOP
+l894:	NOP
+l895:	NOP
+l896:	NOP
+l897:	NOP
+l898:	NOP
+l899:	NOP
+l900:	NOP
+l901:	NOP
+l902:	NOP
+l903:	NOP
+l904:	NOP
+l905:	NOP
+l906:	NOP
+l907:	NOP
+l908:	NOP
+l909:	NOP
+l910:	NOP
+l911:	NOP
+l912:	NOP
+l913:	NOP
+l914:	NOP
+l915:	NOP
+l916:	NOP
+l917:	NOP
+l918:	NOP
+l919:	NOP
+l920:	NOP
+l921:	NOP
+l922:	NOP
+l923:	NOP
+l924:	NOP
+l925:	NOP
+l926:	NOP
+l927:	NOP
+l928:	NOP
+l929:	NOP
+l930:	NOP
+l931:	NOP
+l932:	NOP
+l933:	NOP
+l934:	NOP
+l935:	NOP
+l936:	NOP
+l937:	NOP
+l938:	NOP
+l939:	NOP
+l940:	NOP
+l941:	NOP
+l942:	NOP
+l943:	NOP
+l944:	NOP
+l945:	NOP
+l946:	NOP
+l947:	NOP
+l948:	NOP
+l949:	NOP
+l950:	NOP
+l951:	NOP
+l952:	NOP
+l953:	NOP
+l954:	NOP
+l955:	NOP
+l956:	NOP
+l957:	NOP
+l958:	NOP
+l959:	NOP
+l960:	NOP
+l961:	NOP
+l962:	NOP
+l963:	NOP
+l964:	NOP
+l965:	NOP
+l966:	NOP
+l967:	NOP
+l968:	NOP
+l969:	NOP
+l970:	NOP
+l971:	NOP
+l972:	NOP
+l973:	NOP
+l974:	NOP
+l975:	NOP
+l976:	NOP
+l977:	NOP
+l978:	NOP
+l979:	NOP
+l980:	NOP
+l981:	NOP
+l982:	NOP
+l983:	NOP
+l984:	NOP
+l985:	NOP
+l986:	NOP
+l987:	NOP
+l988:	NOP
+l989:	NOP
+l990:	NOP
+l991:	NOP
+l992:	NOP
+l993:	NOP
+l994:	NOP
+l995:	NOP
+l996:	NOP
+l997:	NOP
+l998:	NOP
+l999:	NOP
+l1000:	NOP
+l1001:	NOP
+l1002:	NOP
+l1003:	NOP
+l1004:	NOP
+l1005:	NOP
+l1006:	NOP
+l1007:	NOP
+l1008:	NOP
+l1009:	NOP
+l1010:	NOP
+l1011:	NOP
+l1012:	NOP
+l1013:	NOP
+l1014:	NOP
+l1015:	NOP
+l1016:	NOP
+l1017:	NOP
+l1018:	NOP
+l1019:	NOP
+l1020:	NOP
+l1021:	NOP
+l1022:	NOP
+l1023:	NOP
+l1024:	NOP
+l1025:	NOP
+l1026:	NOP
+l1027:	NOP
+l1028:	NOP
+l1029:	NOP
+l1030:	NOP
+l1031:	NOP
+l1032:	NOP
+l1033:	NOP
+l1034:	NOP
+l1035:	NOP
+l1036:	NOP
+l1037:	NOP
+l1038:	NOP
+l1039:	NOP
+l1040:	NOP
+l1041:	NOP
+l1042:	NOP
+l1043:	NOP
+l1044:	NOP
+l1045:	NOP
+l1046:	NOP
+l1047:	NOP
+l1048:	NOP
+l1049:	NOP
+l1050:	NOP
+l1051:	NOP
+l1052:	NOP
+l1053:	NOP
+l1054:	NOP
+l1055:	NOP
+l1056:	NOP
+l1057:	NOP
+l1058:	NOP
+l1059:	NOP
+l1060:	NOP
+l1061:	NOP
+l1062:	NOP
+l1063:	NOP
+l1064:	NOP
+l1065:	NOP
+l1066:	NOP
+l1067:	NOP
+l1068:	NOP
+l1069:	NOP
+l1070:	NOP
+l1071:	NOP
+l1072:	NOP
+l1073:	NOP
+l1074:	NOP
+l1075:	NOP
+l1076:	NOP
+l1077:	NOP
+l1078:	NOP
+l1079:	NOP
+l1080:	NOP
+l1081:	NOP
+l1082:	NOP
+l1083:	NOP
+l1084:	NOP
+l1085:	NOP
+l1086:	NOP
+l1087:	NOP
+l1088:	NOP
+l1089:	NOP
+l1090:	NOP
+l1091:	NOP
+l1092:	NOP
+l1093:	NOP
+l1094:	NOP
+l1095:	NOP
+l1096:	NOP
+l1097:	NOP
+l1098:	NOP
+l1099:	NOP
+l1100:	NOP
+l1101:	NOP
+l1102:	NOP
+l1103:	NOP
+l1104:	NOP
+l1105:	NOP
+l1106:	NOP
+l1107:	NOP
+l1108:	NOP
+l1109:	NOP
+l1110:	NOP
+l1111:	NOP
+l1112:	NOP
+l1113:	NOP
+l1114:	NOP
+l1115:	NOP
+l1116:	NOP
+l1117:	NOP
+l1118:	NOP
+l1119:	NOP
+l1120:	NOP
+l1121:	NOP
+l1122:	NOP
+l1123:	NOP
+l1124:	NOP
+l1125:	NOP
+l1126:	NOP
+l1127:	NOP
+l1128:	NOP
+l1129:	NOP
+l1130:	NOP
+l1131:	NOP
+l1132:	NOP
+l1133:	NOP
+l1134:	NOP
+l1135:	NOP
+l1136:	NOP
+l1137:	NOP
+l1138:	NOP
+l1139:	NOP
+l1140:	NOP
+l1141:	NOP
+l1142:	NOP
+l1143:	NOP
+l1144:	NOP
+l1145:	NOP
+l1146:	NOP
+l1147:	NOP
+l1148:	NOP
+l1149:	NOP
+l1150:	NOP
+l1151:	NOP
+l1152:	NOP
+l1153:	NOP
+l1154:	NOP
+l1155:	NOP
+l1156:	NOP
+l1157:	NOP
+l1158:	NOP
+l1159:	NOP
+l1160:	NOP
+l1161:	NOP
+l1162:	NOP
+l1163:	NOP
+l1164:	NOP
+l1165:	NOP
+l1166:	NOP
+l1167:	NOP
+l1168:	NOP
+l1169:	NOP
+l1170:	NOP
+l1171:	NOP
+l1172:	NOP
+l1173:	NOP
+l1174:	NOP
+l1175:	NOP
+l1176:	NOP
+l1177:	NOP
+l1178:	NOP
+l1179:	NOP
+l1180:	NOP
+l1181:	NOP
+l1182:	NOP
+l1183:	NOP
+l1184:	NOP
+l1185:	NOP
+l1186:	NOP
+l1187:	NOP
+l1188:	NOP
+l1189:	NOP
+l1190:	NOP
+l1191:	NOP
+l1192:	NOP
+l1193:	NOP
+l1194:	NOP
+l1195:	NOP
+l1196:	NOP
+l1197:	NOP
+l1198:	NOP
+l1199:	NOP
+l1200:	NOP
+l1201:	NOP
+l1202:	NOP
+l1203:	NOP
+l1204:	NOP
+l1205:	NOP
+l1206:	NOP
+l1207:	NOP
+l1208:	NOP
+l1209:	NOP
+l1210:	NOP
+l1211:	NOP
+l1212:	NOP
+l1213:	NOP
+l1214:	NOP
+l1215:	NOP
+l1216:	NOP
+l1217:	NOP
+l1218:	NOP
+l1219:	NOP
+l1220:	NOP
+l1221:	NOP
+l1222:	NOP
+l1223:	NOP
+l1224:	NOP
+l1225:	NOP
+l1226:	NOP
+l1227:	NOP
+l1228:	NOP
+l1229:	NOP
+l1230:	NOP
+l1231:	NOP
+l1232:	NOP
+l1233:	NOP
+l1234:	NOP
+l1235:	NOP
+l1236:	NOP
+l1237:	NOP
+l1238:	NOP
+l1239:	NOP
+l1240:	NOP
+l1241:	NOP
+l1242:	NOP
+l1243:	NOP
+l1244:	NOP
+l1245:	NOP
+l1246:	NOP
+l1247:	NOP
+l1248:	NOP
+l1249:	NOP
+l1250:	NOP
+l1251:	NOP
+l1252:	NOP
+l1253:	NOP
+l1254:	NOP
+l1255:	NOP
+l1256:	NOP
+l1257:	NOP
+l1258:	NOP
+l1259:	NOP
+l1260:	NOP
+l1261:	NOP
+l1262:	NOP
+l1263:	NOP
+l1264:	NOP
+l1265:	NOP
+l1266:	NOP
+l1267:	NOP
+l1268:	NOP
+l1269:	NOP
+l1270:	NOP
+l1271:	NOP
+l1272:	NOP
+l1273:	NOP
+l1274:	NOP
+l1275:	NOP
+l1276:	NOP
+l1277:	NOP
+l1278:	NOP
+l1279:	NOP
+l1280:	NOP
+l1281:	NOP
+l1282:	NOP
+l1283:	NOP
+l1284:	NOP
+l1285:	NOP
+l1286:	NOP
+l1287:	NOP
+l1288:	NOP
+l1289:	NOP
+l1290:	NOP
+l1291:	NOP
+l1292:	NOP
+l1293:	NOP
+l1294:	NOP
+l1295:	NOP
+l1296:	NOP
+l1297:	NOP
+l1298:	NOP
+l1299:	NOP
+l1300:	NOP
+l1301:	NOP
+l1302:	NOP
+l1303:	NOP
+l1304:	NOP
+l1305:	NOP
+l1306:	NOP
+l1307:	NOP
+l1308:	NOP
+l1309:	NOP
+l1310:	NOP
+l1311:	NOP
+l1312:	NOP
+l1313:	NOP
+l1314:	NOP
+l1315:	NOP
+l1316:	NOP
+l1317:	NOP
+l1318:	NOP
+l1319:	NOP
+l1320:	NOP
+l1321:	NOP
+l1322:	NOP
+l1323:	NOP
+l1324:	NOP
+l1325:	NOP
+l1326:	NOP
+l1327:	NOP
+l1328:	NOP
+l1329:	NOP
+l1330:	NOP
+l1331:	NOP
+l1332:	NOP
+l1333:	NOP
+l1334:	NOP
+l1335:	NOP
+l1336:	NOP
+l1337:	NOP
+l1338:	NOP
+l1339:	NOP
+l1340:	NOP
+l1341:	NOP
+l1342:	NOP
+l1343:	NOP
+l1344:	NOP
+l1345:	NOP
+l1346:	NOP
+l1347:	NOP
+l1348:	NOP
+l1349:	NOP
+l1350:	NOP
+l1351:	NOP
+l1352:	NOP
+l1353:	NOP
+l1354:	NOP
+l1355:	NOP
+l1356:	NOP
+l1357:	NOP
+l1358:	NOP
+l1359:	NOP
+l1360:	NOP
+l1361:	NOP
+l1362:	NOP
+l1363:	NOP
+l1364:	NOP
+l1365:	NOP
+l1366:	NOP
+l1367:	NOP
+l1368:	NOP
+l1369:	NOP
+l1370:	NOP
+l1371:	NOP
+l1372:	NOP
+l1373:	NOP
+l1374:	NOP
+l1375:	NOP
+l1376:	NOP
+l1377:	NOP
+l1378:	NOP
+l1379:	NOP
+l1380:	NOP
+l1381:	NOP
+l1382:	NOP
+l1383:	NOP
+l1384:	NOP
+l1385:	NOP
+l1386:	NOP
+l1387:	NOP
+l1388:	NOP
+l1389:	NOP
+l1390:	NOP
+l1391:	NOP
+l1392:	NOP
+l1393:	NOP
+l1394:	NOP
+l1395:	NOP
+l1396:	NOP
+l1397:	NOP
+l1398:	NOP
+l1399:	NOP
+l1400:	NOP
+l1401:	NOP
+l1402:	NOP
+l1403:	NOP
+l1404:	NOP
+l1405:	NOP
+l1406:	NOP
+l1407:	NOP
+l1408:	NOP
+l1409:	NOP
+l1410:	NOP
+l1411:	NOP
+l1412:	NOP
+l1413:	NOP
+l1414:	NOP
+l1415:	NOP
+l1416:	NOP
+l1417:	NOP
+l1418:	NOP
+l1419:	NOP
+l1420:	NOP
+l1421:	NOP
+l1422:	NOP
+l1423:	NOP
+l1424:	NOP
+l1425:	NOP
+l1426:	NOP
+l1427:	NOP
+l1428:	NOP
+l1429:	NOP
+l1430:	NOP
+l1431:	NOP
+l1432:	NOP
+l1433:	NOP
+l1434:	NOP
+l1435:	NOP
+l1436:	NOP
+l1437:	NOP
+l1438:	NOP
+l1439:	NOP
+l1440:	NOP
+l1441:	NOP
+l1442:	NOP
+l1443:	NOP
+l1444:	NOP
+l1445:	NOP
+l1446:	NOP
+l1447:	NOP
+l1448:	NOP
+l1449:	NOP
+l1450:	NOP
+l1451:	NOP
+l1452:	NOP
+l1453:	NOP
+l1454:	NOP
+l1455:	NOP
+l1456:	NOP
+l1457:	NOP
+l1458:	NOP
+l1459:	NOP
+l1460:	NOP
+l1461:	NOP
+l1462:	NOP
+l1463:	NOP
+l1464:	NOP
+l1465:	NOP
+l1466:	NOP
+l1467:	NOP
+l1468:	NOP
+l1469:	NOP
+l1470:	NOP
+l1471:	NOP
+l1472:	NOP
+l1473:	NOP
+l1474:	NOP
+l1475:	NOP
+l1476:	NOP
+l1477:	NOP
+l1478:	NOP
+l1479:	NOP
+l1480:	NOP
+l1481:	NOP
+l1482:	NOP
+l1483:	NOP
+l1484:	NOP
+l1485:	NOP
+l1486:	NOP
+l1487:	NOP
+l1488:	NOP
+l1489:	NOP
+l1490:	NOP
+l1491:	NOP
+l1492:	NOP
+l1493:	NOP
+l1494:	NOP
+l1495:	NOP
+l1496:	NOP
+l1497:	NOP
+l1498:	NOP
+l1499:	NOP
+l1500:	NOP
+l1501:	NOP
+l1502:	NOP
+l1503:	NOP
+l1504:	NOP
+l1505:	NOP
+l1506:	NOP
+l1507:	NOP
+l1508:	NOP
+l1509:	NOP
+l1510:	NOP
+l1511:	NOP
+l1512:	NOP
+l1513:	NOP
+l1514:	NOP
+l1515:	NOP
+l1516:	NOP
+l1517:	NOP
+l1518:	NOP
+l1519:	NOP
+l1520:	NOP
+l1521:	NOP
+l1522:	NOP
+l1523:	NOP
+l1524:	NOP
+l1525:	NOP
+l1526:	NOP
+l1527:	NOP
+l1528:	NOP
+l1529:	NOP
+l1530:	NOP
+l1531:	NOP
+l1532:	NOP
+l1533:	NOP
+l1534:	NOP
+l1535:	NOP
+l1536:	NOP
+l1537:	NOP
+l1538:	NOP
+l1539:	NOP
+l1540:	NOP
+l1541:	NOP
+l1542:	NOP
+l1543:	NOP
+l1544:	NOP
+l1545:	NOP
+l1546:	NOP
+l1547:	NOP
+l1548:	NOP
+l1549:	NOP
+l1550:	NOP
+l1551:	NOP
+l1552:	NOP
+l1553:	NOP
+l1554:	NOP
+l1555:	NOP
+l1556:	NOP
+l1557:	NOP
+l1558:	NOP
+l1559:	NOP
+l1560:	NOP
+l1561:	NOP
+l1562:	NOP
+l1563:	NOP
+l1564:	NOP
+l1565:	NOP
+l1566:	NOP
+l1567:	NOP
+l1568:	NOP
+l1569:	NOP
+l1570:	NOP
+l1571:	NOP
+l1572:	NOP
+l1573:	NOP
+l1574:	NOP
+l1575:	NOP
+l1576:	NOP
+l1577:	NOP
+l1578:	NOP
+l1579:	NOP
+l1580:	NOP
+l1581:	NOP
+l1582:	NOP
+l1583:	NOP
+l1584:	NOP
+l1585:	NOP
+l1586:	NOP
+l1587:	NOP
+l1588:	NOP
+l1589:	NOP
+l1590:	NOP
+l1591:	NOP
+l1592:	NOP
+l1593:	NOP
+l1594:	NOP
+l1595:	NOP
+l1596:	NOP
+l1597:	NOP
+l1598:	NOP
+l1599:	NOP
+l1600:	NOP
+l1601:	NOP
+l1602:	NOP
+l1603:	NOP
+l1604:	NOP
+l1605:	NOP
+l1606:	NOP
+l1607:	NOP
+l1608:	NOP
+l1609:	NOP
+l1610:	NOP
+l1611:	NOP
+l1612:	NOP
+l1613:	NOP
+l1614:	NOP
+l1615:	NOP
+l1616:	NOP
+l1617:	NOP
+l1618:	NOP
+l1619:	NOP
+l1620:	NOP
+l1621:	NOP
+l1622:	NOP
+l1623:	NOP
+l1624:	NOP
+l1625:	NOP
+l1626:	NOP
+l1627:	NOP
+l1628:	NOP
+l1629:	NOP
+l1630:	NOP
+l1631:	NOP
+l1632:	NOP
+l1633:	NOP
+l1634:	NOP
+l1635:	NOP
+l1636:	NOP
+l1637:	NOP
+l1638:	NOP
+l1639:	NOP
+l1640:	NOP
+l1641:	NOP
+l1642:	NOP
+l1643:	NOP
+l1644:	NOP
+l1645:	NOP
+l1646:	NOP
+l1647:	NOP
+l1648:	NOP
+l1649:	NOP
+l1650:	NOP
+l1651:	NOP
+l1652:	NOP
+l1653:	NOP
+l1654:	NOP
+l1655:	NOP
+l1656:	NOP
+l1657:	NOP
+l1658:	NOP
+l1659:	NOP
+l1660:	NOP
+l1661:	NOP
+l1662:	NOP
+l1663:	NOP
+l1664:	NOP
+l1665:	NOP
+l1666:	NOP
+l1667:	NOP
+l1668:	NOP
+l1669:	NOP
+l1670:	NOP
+l1671:	NOP
+l1672:	NOP
+l1673:	NOP
+l1674:	NOP
+l1675:	NOP
+l1676:	NOP
+l1677:	NOP
+l1678:	NOP
+l1679:	NOP
+l1680:	NOP
+l1681:	NOP
+l1682:	NOP
+l1683:	NOP
+l1684:	NOP
+l1685:	NOP
+l1686:	NOP
+l1687:	NOP
+l1688:	NOP
+l1689:	NOP
+l1690:	NOP
+l1691:	NOP
+l1692:	NOP
+l1693:	NOP
+l1694:	NOP
+l1695:	NOP
+l1696:	NOP
+l1697:	NOP
+l1698:	NOP
+l1699:	NOP
+l1700:	NOP
+l1701:	NOP
+l1702:	NOP
+l1703:	NOP
+l1704:	NOP
+l1705:	NOP
+l1706:	NOP
+l1707:	NOP
+l1708:	NOP
+l1709:	NOP
+l1710:	NOP
+l1711:	NOP
+l1712:	NOP
+l1713:	NOP
+l1714:	NOP
+l1715:	NOP
+l1716:	NOP
+l1717:	NOP
+l1718:	NOP
+l1719:	NOP
+l1720:	NOP
+l1721:	NOP
+l1722:	NOP
+l1723:	NOP
+l1724:	NOP
+l1725:	NOP
+l1726:	NOP
+l1727:	NOP
+l1728:	NOP
+l1729:	NOP
+l1730:	NOP
+l1731:	NOP
+l1732:	NOP
+l1733:	NOP
+l1734:	NOP
+l1735:	NOP
+l1736:	NOP
+l1737:	NOP
+l1738:	NOP
+l1739:	NOP
+l1740:	NOP
+l1741:	NOP
+l1742:	NOP
+l1743:	NOP
+l1744:	NOP
+l1745:	NOP
+l1746:	NOP
+l1747:	NOP
+l1748:	NOP
+l1749:	NOP
+l1750:	NOP
+l1751:	NOP
+l1752:	NOP
+l1753:	NOP
+l1754:	NOP
+l1755:	NOP
+l1756:	NOP
+l1757:	NOP
+l1758:	NOP
+l1759:	NOP
+l1760:	NOP
+l1761:	NOP
+l1762:	NOP
+l1763:	NOP
+l1764:	NOP
+l1765:	NOP
+l1766:	NOP
+l1767:	NOP
+l1768:	NOP
+l1769:	NOP
+l1770:	NOP
+l1771:	NOP
+l1772:	NOP
+l1773:	NOP
+l1774:	NOP
+l1775:	NOP
+l1776:	NOP
+l1777:	NOP
+l1778:	NOP
+l1779:	NOP
+l1780:	NOP
+l1781:	NOP
+l1782:	NOP
+l1783:	NOP
+l1784:	NOP
+l1785:	NOP
+l1786:	NOP
+l1787:	NOP
+l1788:	NOP
+l1789:	NOP
+l1790:	NOP
+l1791:	NOP
+l1792:	NOP
+l1793:	NOP
+l1794:	NOP
+l1795:	NOP
+l1796:	NOP
+l1797:	NOP
+l1798:	NOP
+l1799:	NOP
+l1800:	NOP
+l1801:	NOP
+l1802:	NOP
+l1803:	NOP
+l1804:	NOP
+l1805:	NOP
+l1806:	NOP
+l1807:	NOP
+l1808:	NOP
+l1809:	NOP
+l1810:	NOP
+l1811:	NOP
+l1812:	NOP
+l1813:	NOP
+l1814:	NOP
+l1815:	NOP
+l1816:	NOP
+l1817:	NOP
+l1818:	NOP
+l1819:	NOP
+l1820:	NOP
+l1821:	NOP
+l1822:	NOP
+l1823:	NOP
+l1824:	NOP
+l1825:	NOP
+l1826:	NOP
+l1827:	NOP
+l1828:	NOP
+l1829:	NOP
+l1830:	NOP
+l1831:	NOP
+l1832:	NOP
+l1833:	NOP
+l1834:	NOP
+l1835:	NOP
+l1836:	NOP
+l1837:	NOP
+l1838:	NOP
+l1839:	NOP
+l1840:	NOP
+l1841:	NOP
+l1842:	NOP
+l1843:	NOP
+l1844:	NOP
+l1845:	NOP
+l1846:	NOP
+l1847:	NOP
+l1848:	NOP
+l1849:	NOP
+l1850:	NOP
+l1851:	NOP
+l1852:	NOP
+l1853:	NOP
+l1854:	NOP
+l1855:	NOP
+l1856:	NOP
+l1857:	NOP
+l1858:	NOP
+l1859:	NOP
+l1860:	NOP
+l1861:	NOP
+l1862:	NOP
+l1863:	NOP
+l1864:	NOP
+l1865:	NOP
+l1866:	NOP
+l1867:	NOP
+l1868:	NOP
+l1869:	NOP
+l1870:	NOP
+l1871:	NOP
+l1872:	NOP
+l1873:	NOP
+l1874:	NOP
+l1875:	NOP
+l1876:	NOP
+l1877:	NOP
+l1878:	NOP
+l1879:	NOP
+l1880:	NOP
+l1881:	NOP
+l1882:	NOP
+l1883:	NOP
+l1884:	NOP
+l1885:	NOP
+l1886:	NOP
+l1887:	NOP
+l1888:	NOP
+l1889:	NOP
+l1890:	NOP
+l1891:	NOP
+l1892:	NOP
+l1893:	NOP
+l1894:	NOP
+l1895:	NOP
+l1896:	NOP
+l1897:	NOP
+l1898:	NOP
+l1899:	NOP
+l1900:	NOP
+l1901:	NOP
+l1902:	NOP
+l1903:	NOP
+l1904:	NOP
+l1905:	NOP
+l1906:	NOP
+l1907:	NOP
+l1908:	NOP
+l1909:	NOP
+l1910:	NOP
+l1911:	NOP
+l1912:	NOP
+l1913:	NOP
+l1914:	NOP
+l1915:	NOP
+l1916:	NOP
+l1917:	NOP
+l1918:	NOP
+l1919:	NOP
+l1920:	NOP
+l1921:	NOP
+l1922:	NOP
+l1923:	NOP
+l1924:	NOP
+l1925:	NOP
+l1926:	NOP
+l1927:	NOP
+l1928:	NOP
+l1929:	NOP
+l1930:	NOP
+l1931:	NOP
+l1932:	NOP
+l1933:	NOP
+l1934:	NOP
+l1935:	NOP
+l1936:	NOP
+l1937:	NOP
+l1938:	NOP
+l1939:	NOP
+l1940:	NOP
+l1941:	NOP
+l1942:	NOP
+l1943:	NOP
+l1944:	NOP
+l1945:	NOP
+l1946:	NOP
+l1947:	NOP
+l1948:	NOP
+l1949:	NOP
+l1950:	NOP
+l1951:	NOP
+l1952:	NOP
+l1953:	NOP
+l1954:	NOP
+l1955:	NOP
+l1956:	NOP
+l1957:	NOP
+l1958:	NOP
+l1959:	NOP
+l1960:	NOP
+l1961:	NOP
+l1962:	NOP
+l1963:	NOP
+l1964:	NOP
+l1965:	NOP
+l1966:	NOP
+l1967:	NOP
+l1968:	NOP
+l1969:	NOP
+l1970:	NOP
+l1971:	NOP
+l1972:	NOP
+l1973:	NOP
+l1974:	NOP
+l1975:	NOP
+l1976:	NOP
+l1977:	NOP
+l1978:	NOP
+l1979:	NOP
+l1980:	NOP
+l1981:	NOP
+l1982:	NOP
+l1983:	NOP
+l1984:	NOP
+l1985:	NOP
+l1986:	NOP
+l1987:	NOP
+l1988:	NOP
+l1989:	NOP
+l1990:	NOP
+l1991:	NOP
+l1992:	NOP
+l1993:	NOP
+l1994:	NOP
+l1995:	NOP
+l1996:	NOP
+l1997:	NOP
+l1998:	NOP
+l1999:	NOP
+l2000:	NOP
+done:	EXIT 0
+	.data 4096
+	.stack 8192
+	.end
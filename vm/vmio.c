@@ -0,0 +1,259 @@
+/* $Id$ */
+// fileno, fseeko, and ftello are only declared for -std=c17
+// with _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "vmio.h"
+#include "utilities.h"
+
+// Input is mapped (when it is a regular file) or read in blocks
+// with read on hosts that have them, and otherwise read with fread
+#if defined(__unix__) || defined(__APPLE__)
+#define VMIO_POSIX 1
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// the most characters printed for an int (-2147483648)
+#define INT_CHARS 11
+
+struct vmio_s {
+    FILE *in;
+    FILE *out;
+    // should output be written whenever a newline is printed
+    // (as it is when out is a terminal)?
+    bool line_buffered;
+    // the input not yet read by the program starts at in_next
+    // and ends at in_end; it is in the mapping of the input file
+    // (mapped_bytes long), if that is not NULL, or in in_block
+    const unsigned char *in_next;
+    const unsigned char *in_end;
+    unsigned char *mapped;
+    size_t mapped_bytes;
+    // the output not yet written to out (out_len characters)
+    size_t out_len;
+    // (the buffers come last, so a machine whose system calls use
+    // callbacks only touches the first page of its vmio_t)
+    char out_buf[VMIO_BUFFER_SIZE];
+    unsigned char in_block[VMIO_BUFFER_SIZE];
+};
+
+// the vmio_t of the program running on this thread (or NULL),
+// whose output is flushed if the process exits
+static _Thread_local vmio_t *running_io = NULL;
+static atomic_flag exit_handler_registered = ATOMIC_FLAG_INIT;
+
+// Flush the output of the program running on the thread that is
+// exiting the process (registered with atexit)
+static void flush_at_exit()
+{
+    if (running_io != NULL) {
+	vmio_flush(running_io);
+    }
+}
+
+// Return a new vmio_t with no streams,
+// exiting with an error message if there is no space for it
+vmio_t *vmio_create()
+{
+    vmio_t *io = malloc(sizeof(vmio_t));
+    if (io == NULL) {
+	bail_with_error("Cannot allocate the VM's I/O buffers!");
+    }
+    io->in = NULL;
+    io->out = NULL;
+    io->line_buffered = false;
+    io->out_len = 0;
+    io->in_next = io->in_end = NULL;
+    io->mapped = NULL;
+    io->mapped_bytes = 0;
+    return io;
+}
+
+// Forget the input of io that was read ahead (but not by the program),
+// moving its input stream back to the first character not yet read
+// (if that stream can be positioned), and unmap its input file
+static void give_back_input(vmio_t *io)
+{
+#ifdef VMIO_POSIX
+    if (io->mapped != NULL) {
+	fseeko(io->in, (off_t) (io->in_next - io->mapped), SEEK_SET);
+	munmap(io->mapped, io->mapped_bytes);
+	io->mapped = NULL;
+    } else if (io->in_next < io->in_end && fileno(io->in) >= 0) {
+	lseek(fileno(io->in), -(off_t) (io->in_end - io->in_next), SEEK_CUR);
+    }
+#endif
+    io->in_next = io->in_end = NULL;
+}
+
+// Flush any buffered output of io, then free it (if it is not NULL)
+void vmio_destroy(vmio_t *io)
+{
+    if (io == NULL) {
+	return;
+    }
+    if (running_io == io) {
+	running_io = NULL;
+    }
+    vmio_flush(io);
+    give_back_input(io);
+    free(io);
+}
+
+// Flush any buffered output of io, give back any input read ahead,
+// then make it read from in and write to out
+void vmio_set_streams(vmio_t *io, FILE *in, FILE *out)
+{
+    vmio_flush(io);
+    if (io->in != in) {
+	give_back_input(io);
+    }
+    io->in = in;
+    io->out = out;
+    io->line_buffered = false;
+#ifdef VMIO_POSIX
+    if (out != NULL && fileno(out) >= 0) {
+	io->line_buffered = isatty(fileno(out));
+    }
+    // a regular file is mapped (from where in is positioned)
+    struct stat st;
+    if (in != NULL && io->mapped == NULL && io->in_next == NULL
+	&& fileno(in) >= 0 && fstat(fileno(in), &st) == 0
+	&& S_ISREG(st.st_mode) && st.st_size > 0) {
+	void *area = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE,
+			  fileno(in), 0);
+	if (area != MAP_FAILED) {
+	    off_t start = ftello(in);
+	    io->mapped = area;
+	    io->mapped_bytes = st.st_size;
+	    io->in_end = io->mapped + io->mapped_bytes;
+	    io->in_next = start < 0 || start > st.st_size
+		? io->in_end : io->mapped + start;
+	}
+    }
+#endif
+}
+
+// Make io the one whose output is flushed if this thread exits
+// the process (e.g., in bail_with_error) while running a program,
+// or, if io is NULL, make there be none
+void vmio_set_running(vmio_t *io)
+{
+    if (io != NULL && !atomic_flag_test_and_set(&exit_handler_registered)) {
+	atexit(flush_at_exit);
+    }
+    running_io = io;
+}
+
+// Write any buffered output of io to its output stream
+// (but do not flush that stream)
+void vmio_flush(vmio_t *io)
+{
+    if (io->out_len > 0) {
+	fwrite(io->out_buf, 1, io->out_len, io->out);
+	io->out_len = 0;
+    }
+}
+
+// Write the len characters at s on io
+static void put_chars(vmio_t *io, const char *s, size_t len)
+{
+    if (len > VMIO_BUFFER_SIZE - io->out_len) {
+	vmio_flush(io);
+	if (len > VMIO_BUFFER_SIZE) {
+	    fwrite(s, 1, len, io->out);
+	    return;
+	}
+    }
+    memcpy(io->out_buf + io->out_len, s, len);
+    io->out_len += len;
+}
+
+// Write the string s on io, returning the number of characters written
+int vmio_print_str(vmio_t *io, const char *s)
+{
+    size_t len = strlen(s);
+    put_chars(io, s, len);
+    if (io->line_buffered && memchr(s, '\n', len) != NULL) {
+	vmio_flush(io);
+    }
+    return (int) len;
+}
+
+// Write the integer i (in decimal) on io,
+// returning the number of characters written
+int vmio_print_int(vmio_t *io, int i)
+{
+    char digits[INT_CHARS];
+    char *p = digits + INT_CHARS;
+    // negate as unsigned, so the most negative int has a magnitude
+    unsigned int mag = i < 0 ? 0u - (unsigned int) i : (unsigned int) i;
+    do {
+	*--p = (char) ('0' + mag % 10);
+	mag /= 10;
+    } while (mag != 0);
+    if (i < 0) {
+	*--p = '-';
+    }
+    size_t len = digits + INT_CHARS - p;
+    put_chars(io, p, len);
+    return (int) len;
+}
+
+// Write the character c on io, returning it (as an unsigned char)
+int vmio_print_char(vmio_t *io, int c)
+{
+    if (io->out_len == VMIO_BUFFER_SIZE) {
+	vmio_flush(io);
+    }
+    io->out_buf[io->out_len++] = (char) c;
+    if (io->line_buffered && c == '\n') {
+	vmio_flush(io);
+    }
+    return (unsigned char) c;
+}
+
+// Read the next block of io's input into in_block, returning false
+// if there is none (at the end of the input, or after an error)
+static bool read_block(vmio_t *io)
+{
+    if (io->mapped != NULL) {
+	return false;
+    }
+    // the input may be a terminal or pipe written in reply to the output
+    vmio_flush(io);
+    fflush(io->out);
+#ifdef VMIO_POSIX
+    ssize_t count = -1;
+    if (fileno(io->in) >= 0) {
+	count = read(fileno(io->in), io->in_block, VMIO_BUFFER_SIZE);
+    } else {
+	count = fread(io->in_block, 1, VMIO_BUFFER_SIZE, io->in);
+    }
+#else
+    size_t count = fread(io->in_block, 1, VMIO_BUFFER_SIZE, io->in);
+#endif
+    if (count <= 0) {
+	return false;
+    }
+    io->in_next = io->in_block;
+    io->in_end = io->in_block + count;
+    return true;
+}
+
+// Read and return the next character from io's input stream
+// (as an unsigned char), or EOF if there are none left
+int vmio_read_char(vmio_t *io)
+{
+    if (io->in_next == io->in_end && !read_block(io)) {
+	return EOF;
+    }
+    return *io->in_next++;
+}
@@ -0,0 +1,51 @@
+/* $Id$ */
+// Buffered input and output for the VM's system calls (PSTR, PINT, PCH,
+// and RCH), which do not go through stdio for each call: output is
+// collected in a private buffer and written in large blocks, integers
+// are formatted by hand, and input is read in blocks (or mapped,
+// when it is a regular file)
+#ifndef _VMIO_H
+#define _VMIO_H
+#include <stdio.h>
+
+// the size of the output buffer and of each block of input read
+#define VMIO_BUFFER_SIZE 65536
+
+// The buffers for one machine's input and output streams
+typedef struct vmio_s vmio_t;
+
+// Return a new vmio_t with no streams,
+// exiting with an error message if there is no space for it
+extern vmio_t *vmio_create();
+
+// Flush any buffered output of io, then free it (if it is not NULL)
+extern void vmio_destroy(vmio_t *io);
+
+// Flush any buffered output of io, give back any input read ahead,
+// then make it read from in and write to out
+extern void vmio_set_streams(vmio_t *io, FILE *in, FILE *out);
+
+// Make io the one whose output is flushed if this thread exits
+// the process (e.g., in bail_with_error) while running a program,
+// or, if io is NULL, make there be none
+extern void vmio_set_running(vmio_t *io);
+
+// Write any buffered output of io to its output stream
+// (but do not flush that stream)
+extern void vmio_flush(vmio_t *io);
+
+// Write the string s on io, returning the number of characters written
+extern int vmio_print_str(vmio_t *io, const char *s);
+
+// Write the integer i (in decimal) on io,
+// returning the number of characters written
+extern int vmio_print_int(vmio_t *io, int i);
+
+// Write the character c on io, returning it (as an unsigned char)
+extern int vmio_print_char(vmio_t *io, int c);
+
+// Read and return the next character from io's input stream
+// (as an unsigned char), or EOF if there are none left
+extern int vmio_read_char(vmio_t *io);
+
+#endif